@@ -400,3 +400,8 @@ if(ASCENT_CUDA_ENABLED AND ASCENT_OCCA_ENABLED)
 endif()
 
 
+
+###############################################################################
+# flow's parallel workspace execution requires threads
+###############################################################################
+find_package(Threads REQUIRED)
@@ -63,6 +63,11 @@ int main(int argc, char **argv)
     queries["q3/params/expression"] = "binning('radial','max', [axis('x',[-1,1]), axis('y', [-1,1]), axis('z', num_bins=20)])";
     queries["q3/params/name"] = "3d_binning";
 
+    // save the query results as yaml (ascent_session.yaml)
+    // for the plotting scripts
+    Node &save_act = actions.append();
+    save_act["action"] = "save_session";
+
     // print our full actions tree
     std::cout << actions.to_yaml() << std::endl;
 
@@ -78,7 +83,7 @@ int main(int argc, char **argv)
 
     //
     // We can use the included example python scripts to plot binning results,
-    // which are stored in an ascent yaml session file:
+    // which the save_session action stored in an ascent yaml session file:
     //  plot_binning_1d.py
     //  plot_binning_2d.py
     //  plot_binning_3d.py
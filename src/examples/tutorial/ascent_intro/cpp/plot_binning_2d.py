@@ -4,7 +4,9 @@
 
 #
 # plots the 3d binning result from the session file created by
-# ascent binning example 1
+# ascent binning example 1 (its save_session action writes
+# ascent_session.yaml, use history2yaml to convert the
+# ascent_session.ascent_history file of other runs)
 #
 
 import yaml #pip install --user pyyaml
@@ -0,0 +1,290 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef APCOMP_PARTIAL_SORT_HPP
+#define APCOMP_PARTIAL_SORT_HPP
+
+#include <apcomp/apcomp_config.h>
+#include <apcomp/absorption_partial.hpp>
+#include <apcomp/emission_partial.hpp>
+#include <apcomp/volume_partial.hpp>
+
+#include <algorithm>
+#include <string.h>
+#include <utility>
+#include <vector>
+
+#ifdef APCOMP_OPENMP_ENABLED
+#include <omp.h>
+#endif
+
+//
+// Sorting and compaction helpers of the partial compositor
+//
+namespace apcomp {
+namespace detail
+{
+
+inline int
+num_threads()
+{
+#ifdef APCOMP_OPENMP_ENABLED
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+//
+// Sort keys that order as unsigned integers the same way the
+// partials order with operator <
+//
+inline unsigned int
+pixel_key(const int pixel_id)
+{
+  return static_cast<unsigned int>(pixel_id) ^ 0x80000000u;
+}
+
+inline unsigned long long
+depth_key(double depth)
+{
+  // -0 and +0 compare equal, so they need the same key
+  if(depth == 0.)
+  {
+    depth = 0.;
+  }
+  unsigned long long bits;
+  memcpy(&bits, &depth, sizeof(bits));
+  // flip all the bits of negative values and only the sign
+  // bit of positive values
+  const unsigned long long sign = 1ull << 63;
+  return (bits & sign) ? ~bits : (bits | sign);
+}
+
+template<typename T>
+double sort_depth(const VolumePartial<T> &partial)
+{
+  return partial.m_depth;
+}
+
+template<typename T>
+double sort_depth(const EmissionPartial<T> &partial)
+{
+  return partial.m_depth;
+}
+
+template<typename T>
+double sort_depth(const AbsorptionPartial<T> &)
+{
+  // absorption partials can be blended in any order
+  return 0.;
+}
+
+//
+// Structure of arrays holding the sort keys of the partials and
+// the index of the partial each key belongs to.
+//
+struct PartialKeys
+{
+  std::vector<unsigned int>       m_pixels;
+  std::vector<unsigned long long> m_depths;
+  std::vector<int>                m_index;
+
+  void resize(const int size)
+  {
+    m_pixels.resize(size);
+    m_depths.resize(size);
+    m_index.resize(size);
+  }
+
+  void swap(PartialKeys &other)
+  {
+    m_pixels.swap(other.m_pixels);
+    m_depths.swap(other.m_depths);
+    m_index.swap(other.m_index);
+  }
+
+  inline int digit(const int i, const bool pixel, const int shift) const
+  {
+    if(pixel)
+    {
+      return static_cast<int>((m_pixels[i] >> shift) & 0xff);
+    }
+    return static_cast<int>((m_depths[i] >> shift) & 0xff);
+  }
+};
+
+//
+// One stable counting sort pass over an 8 bit digit of the keys.
+// Each thread counts and scatters a contiguous chunk, so the
+// order within a bucket is preserved. Returns false if every key
+// has the same digit and the pass was skipped.
+//
+inline bool
+radix_pass(PartialKeys &keys,
+           PartialKeys &scratch,
+           const bool pixel,
+           const int shift)
+{
+  const int size = static_cast<int>(keys.m_index.size());
+  const int threads = num_threads();
+  const int chunk = (size + threads - 1) / threads;
+  std::vector<int> counts(threads * 256, 0);
+
+#ifdef APCOMP_OPENMP_ENABLED
+  #pragma omp parallel for schedule(static, 1)
+#endif
+  for(int t = 0; t < threads; ++t)
+  {
+    const int begin = t * chunk;
+    const int end = std::min(size, begin + chunk);
+    int *t_counts = &counts[t * 256];
+    for(int i = begin; i < end; ++i)
+    {
+      t_counts[keys.digit(i, pixel, shift)]++;
+    }
+  }
+
+  // bucket start of each thread, in (digit, thread) order
+  int offset = 0;
+  for(int d = 0; d < 256; ++d)
+  {
+    int digit_count = 0;
+    for(int t = 0; t < threads; ++t)
+    {
+      const int count = counts[t * 256 + d];
+      counts[t * 256 + d] = offset;
+      offset += count;
+      digit_count += count;
+    }
+    if(digit_count == size)
+    {
+      return false;
+    }
+  }
+
+#ifdef APCOMP_OPENMP_ENABLED
+  #pragma omp parallel for schedule(static, 1)
+#endif
+  for(int t = 0; t < threads; ++t)
+  {
+    const int begin = t * chunk;
+    const int end = std::min(size, begin + chunk);
+    int *t_offsets = &counts[t * 256];
+    for(int i = begin; i < end; ++i)
+    {
+      const int dest = t_offsets[keys.digit(i, pixel, shift)]++;
+      scratch.m_pixels[dest] = keys.m_pixels[i];
+      scratch.m_depths[dest] = keys.m_depths[i];
+      scratch.m_index[dest] = keys.m_index[i];
+    }
+  }
+
+  keys.swap(scratch);
+  return true;
+}
+
+//
+// Sorts the partials by (pixel id, depth) with a LSD radix sort.
+// Passes over digits that are the same for every key (e.g., the
+// high bytes of the pixel ids) are skipped.
+//
+template<typename PartialType>
+void
+radix_sort_partials(std::vector<PartialType> &partials)
+{
+  const int size = static_cast<int>(partials.size());
+  PartialKeys keys;
+  PartialKeys scratch;
+  keys.resize(size);
+  scratch.resize(size);
+
+#ifdef APCOMP_OPENMP_ENABLED
+  #pragma omp parallel for
+#endif
+  for(int i = 0; i < size; ++i)
+  {
+    keys.m_pixels[i] = pixel_key(partials[i].m_pixel_id);
+    keys.m_depths[i] = depth_key(sort_depth(partials[i]));
+    keys.m_index[i] = i;
+  }
+
+  // least significant key first
+  for(int shift = 0; shift < 64; shift += 8)
+  {
+    radix_pass(keys, scratch, false, shift);
+  }
+  for(int shift = 0; shift < 32; shift += 8)
+  {
+    radix_pass(keys, scratch, true, shift);
+  }
+
+  std::vector<PartialType> sorted(size);
+#ifdef APCOMP_OPENMP_ENABLED
+  #pragma omp parallel for
+#endif
+  for(int i = 0; i < size; ++i)
+  {
+    sorted[i] = std::move(partials[keys.m_index[i]]);
+  }
+  partials.swap(sorted);
+}
+
+//
+// Parallel stream compaction: the indices of the set flags, in order
+//
+inline void
+flagged_indices(const std::vector<unsigned char> &flags, std::vector<int> &indices)
+{
+  const int size = static_cast<int>(flags.size());
+  const int threads = num_threads();
+  const int chunk = (size + threads - 1) / threads;
+  std::vector<int> offsets(threads + 1, 0);
+
+#ifdef APCOMP_OPENMP_ENABLED
+  #pragma omp parallel for schedule(static, 1)
+#endif
+  for(int t = 0; t < threads; ++t)
+  {
+    const int begin = t * chunk;
+    const int end = std::min(size, begin + chunk);
+    int count = 0;
+    for(int i = begin; i < end; ++i)
+    {
+      count += flags[i];
+    }
+    offsets[t + 1] = count;
+  }
+
+  for(int t = 0; t < threads; ++t)
+  {
+    offsets[t + 1] += offsets[t];
+  }
+
+  indices.resize(offsets[threads]);
+
+#ifdef APCOMP_OPENMP_ENABLED
+  #pragma omp parallel for schedule(static, 1)
+#endif
+  for(int t = 0; t < threads; ++t)
+  {
+    const int begin = t * chunk;
+    const int end = std::min(size, begin + chunk);
+    int current = offsets[t];
+    for(int i = begin; i < end; ++i)
+    {
+      if(flags[i] == 1)
+      {
+        indices[current] = i;
+        ++current;
+      }
+    }
+  }
+}
+
+} // namespace detail
+} // namespace apcomp
+#endif
@@ -6,6 +6,7 @@
 
 #include "partial_compositor.hpp"
 #include <apcomp/apcomp.hpp>
+#include <apcomp/internal/apcomp_partial_sort.hpp>
 #include <algorithm>
 #include <assert.h>
 #include <limits>
@@ -19,6 +20,7 @@
 namespace apcomp {
 namespace detail
 {
+
 template<template <typename> class PartialType, typename FloatType>
 void BlendPartials(const int &total_segments,
                    const int &total_partial_comps,
@@ -298,7 +300,7 @@ PartialCompositor<PartialType>::composite_partials(std::vector<PartialType> &par
                                             std::vector<PartialType> &output_partials)
 {
   const int total_partial_comps = partials.size();
-  if(total_partial_comps == 0)
+  if(total_partial_comps < 2)
   {
     output_partials = partials;
     return;
@@ -306,7 +308,7 @@ PartialCompositor<PartialType>::composite_partials(std::vector<PartialType> &par
   //
   // Sort the composites
   //
-  std::sort(partials.begin(), partials.end());
+  detail::radix_sort_partials(partials);
   //
   // Find the number of unique pixel_ids with work
   //
@@ -368,61 +370,17 @@ PartialCompositor<PartialType>::composite_partials(std::vector<PartialType> &par
     work_flags[i]  = work_flag;
     unique_flags[i] = unique_flag;
   }
-  // count the number of of unique pixels
-  int total_segments = 0;
-
-#ifdef APCOMP_OPENMP_ENABLED
-  #pragma omp parallel for shared(work_flags) reduction(+:total_segments)
-#endif
-  for(int i = 0; i < total_partial_comps; ++i)
-  {
-    total_segments += work_flags[i];
-  }
-
-  int total_unique_pixels = 0;
-#ifdef APCOMP_OPENMP_ENABLED
-  #pragma omp parallel for shared(unique_flags) reduction(+:total_unique_pixels)
-#endif
-  for(int i = 0; i < total_partial_comps; ++i)
-  {
-    total_unique_pixels += unique_flags[i];
-  }
-
-  if(total_segments ==  0)
-  {
-    //nothing to do
-  }
-
   //
   // find the pixel indexes that have compositing work
+  // and the ones that have NO compositing work
   //
   std::vector<int> pixel_work_ids;
-  pixel_work_ids.resize(total_segments);
-  int current_index = 0;
-  for(int i = 0;  i < total_partial_comps; ++i)
-  {
-    if(work_flags[i] == 1)
-    {
-      pixel_work_ids[current_index] = i;
-      ++current_index;
-    }
-  }
-
-  //
-  // find the pixel indexes that have NO compositing work
-  //
   std::vector<int> unique_ids;
-  unique_ids.resize(total_unique_pixels);
-  current_index = 0;
-  for(int i = 0;  i < total_partial_comps; ++i)
-  {
-    if(unique_flags[i] == 1)
-    {
-      unique_ids[current_index] = i;
-      ++current_index;
-    }
-  }
+  detail::flagged_indices(work_flags, pixel_work_ids);
+  detail::flagged_indices(unique_flags, unique_ids);
 
+  const int total_segments = static_cast<int>(pixel_work_ids.size());
+  const int total_unique_pixels = static_cast<int>(unique_ids.size());
 
   const int total_output_pixels = total_unique_pixels + total_segments;
 
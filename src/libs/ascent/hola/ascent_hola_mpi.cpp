@@ -24,7 +24,11 @@
 //-----------------------------------------------------------------------------
 #include <ascent_logging.hpp>
 
+#include <algorithm>
 #include <fstream>
+#include <map>
+#include <utility>
+#include <vector>
 
 using namespace conduit;
 using namespace std;
@@ -256,10 +260,300 @@ hola_mpi_recv(MPI_Comm comm,
 }
 
 
+//-----------------------------------------------------------------------------
+// -- begin ascent::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+const int HOLA_HEADER_TAG = 9021;
+const int HOLA_SCHEMA_TAG = 9022;
+const int HOLA_DATA_TAG   = 9023;
+// MPI counts are ints, so larger payloads are sent in pieces
+const int64 HOLA_MAX_MSG_BYTES = 1 << 30;
+
+//-----------------------------------------------------------------------------
+void
+isend_chunked(const void *data,
+              int64 num_bytes,
+              int dest,
+              int tag,
+              MPI_Comm comm,
+              std::vector<MPI_Request> &requests)
+{
+    const char *ptr = static_cast<const char*>(data);
+    for(int64 offset = 0; offset < num_bytes; offset += HOLA_MAX_MSG_BYTES)
+    {
+        const int count = (int) std::min(HOLA_MAX_MSG_BYTES, num_bytes - offset);
+        MPI_Request request;
+        MPI_Isend(const_cast<char*>(ptr + offset), count, MPI_BYTE,
+                  dest, tag, comm, &request);
+        requests.push_back(request);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// messages with the same source and tag arrive in order, so the pieces
+// can be received one after the other
+void
+recv_chunked(void *data,
+             int64 num_bytes,
+             int src,
+             int tag,
+             MPI_Comm comm)
+{
+    char *ptr = static_cast<char*>(data);
+    for(int64 offset = 0; offset < num_bytes; offset += HOLA_MAX_MSG_BYTES)
+    {
+        const int count = (int) std::min(HOLA_MAX_MSG_BYTES, num_bytes - offset);
+        MPI_Recv(ptr + offset, count, MPI_BYTE,
+                 src, tag, comm, MPI_STATUS_IGNORE);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// state kept between pipelined transfers over the same comm and split
+//-----------------------------------------------------------------------------
+struct HolaPipeline
+{
+    HolaPipeline()
+    : m_has_comm_map(false)
+    {}
+
+    bool                      m_has_comm_map;
+    Node                      m_comm_map;
+    // sources: staged domains, schemas, and headers of the sends in flight
+    std::vector<Node>         m_send_data;
+    std::vector<std::string>  m_send_schemas;
+    std::vector<int64>        m_send_headers;
+    std::vector<MPI_Request>  m_send_requests;
+    // the last schema sent or received for each local domain
+    std::vector<std::string>  m_schemas;
+};
+
+//-----------------------------------------------------------------------------
+std::map<std::pair<int,int>, HolaPipeline> &
+pipelines()
+{
+    static std::map<std::pair<int,int>, HolaPipeline> hola_pipelines;
+    return hola_pipelines;
+}
+
+//-----------------------------------------------------------------------------
+void
+wait_for_sends(HolaPipeline &pipeline)
+{
+    if(!pipeline.m_send_requests.empty())
+    {
+        MPI_Waitall((int)pipeline.m_send_requests.size(),
+                    &pipeline.m_send_requests[0],
+                    MPI_STATUSES_IGNORE);
+        pipeline.m_send_requests.clear();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+hola_mpi_send_pipelined(const conduit::Node &data,
+                        MPI_Comm comm,
+                        int src_idx,
+                        HolaPipeline &pipeline)
+{
+    const Node &comm_map = pipeline.m_comm_map;
+    const int32 *src_counts  = comm_map["src_counts"].value();
+    const int32 *src_offsets = comm_map["src_offsets"].value();
+
+    const int32 *dest_counts   = comm_map["dest_counts"].value();
+    const int32 *dest_offsets  = comm_map["dest_offsets"].value();
+    const int32 *dest_to_world = comm_map["dest_to_world"].value();
+
+    const int num_doms = src_counts[src_idx];
+    if(data.number_of_children() != num_doms)
+    {
+        ASCENT_ERROR("pipelined hola_mpi requires the same number of "
+                     "domains on each source rank every cycle. Expected "
+                     << num_doms << " domains, got "
+                     << data.number_of_children());
+    }
+
+    // the staged domains of the last call can't be touched
+    // until their sends are done
+    wait_for_sends(pipeline);
+
+    pipeline.m_send_data.resize(num_doms);
+    pipeline.m_send_schemas.resize(num_doms);
+    pipeline.m_send_headers.resize(num_doms * 2);
+    pipeline.m_schemas.resize(num_doms);
+
+    int dest_idx = 0;
+    for(int d = 0; d < num_doms; d++)
+    {
+        const int i = src_offsets[src_idx] + d;
+        // find  i's dest
+        while( i >= dest_offsets[dest_idx] + dest_counts[dest_idx])
+        {
+            dest_idx++;
+        }
+        int32 dest_rank = dest_to_world[(int32)dest_idx];
+
+        // stage a compact copy, the simulation is free to change
+        // its data while the copy is in flight
+        Node &n_staged = pipeline.m_send_data[d];
+        data.child(d).compact_to(n_staged);
+
+        // only send the schema when it changed
+        std::string schema = n_staged.schema().to_json();
+        if(schema == pipeline.m_schemas[d])
+        {
+            pipeline.m_send_schemas[d].clear();
+        }
+        else
+        {
+            pipeline.m_send_schemas[d] = schema;
+            pipeline.m_schemas[d] = schema;
+        }
+
+        int64 *header = &pipeline.m_send_headers[d * 2];
+        header[0] = (int64) pipeline.m_send_schemas[d].size();
+        header[1] = (int64) n_staged.total_bytes_compact();
+
+        MPI_Request request;
+        MPI_Isend(header, 2, MPI_INT64_T,
+                  dest_rank, HOLA_HEADER_TAG, comm, &request);
+        pipeline.m_send_requests.push_back(request);
+
+        isend_chunked(pipeline.m_send_schemas[d].data(), header[0],
+                      dest_rank, HOLA_SCHEMA_TAG, comm,
+                      pipeline.m_send_requests);
+
+        isend_chunked(n_staged.contiguous_data_ptr(), header[1],
+                      dest_rank, HOLA_DATA_TAG, comm,
+                      pipeline.m_send_requests);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+hola_mpi_recv_pipelined(MPI_Comm comm,
+                        int dest_idx,
+                        HolaPipeline &pipeline,
+                        conduit::Node &data,
+                        HolaDomainCallback on_domain)
+{
+    const Node &comm_map = pipeline.m_comm_map;
+    const int32 *src_counts  = comm_map["src_counts"].value();
+    const int32 *src_offsets = comm_map["src_offsets"].value();
+    const int32 *src_to_world = comm_map["src_to_world"].value();
+
+    const int32 *dest_counts  = comm_map["dest_counts"].value();
+    const int32 *dest_offsets = comm_map["dest_offsets"].value();
+
+    const int num_doms = dest_counts[dest_idx];
+    pipeline.m_schemas.resize(num_doms);
+
+    // domains keep their global order no matter when they arrive
+    std::vector<Node*> slots(num_doms);
+    for(int d = 0; d < num_doms; d++)
+    {
+        slots[d] = &data.append();
+    }
+
+    // each source sends its domains in order, so keep track of the
+    // next and the last domain expected from each source
+    std::vector<int> src_ranks;
+    std::vector<int> next_dom;
+    std::vector<int> end_dom;
+    int src_idx = 0;
+    for(int d = 0; d < num_doms; d++)
+    {
+        const int i = dest_offsets[dest_idx] + d;
+        // find  i's src
+        while( i >= src_offsets[src_idx] + src_counts[src_idx])
+        {
+            src_idx++;
+        }
+        const int src_rank = src_to_world[(int32)src_idx];
+        if(src_ranks.empty() || src_ranks.back() != src_rank)
+        {
+            src_ranks.push_back(src_rank);
+            next_dom.push_back(d);
+            end_dom.push_back(d);
+        }
+        end_dom.back() = d + 1;
+    }
+
+    const int num_srcs = (int)src_ranks.size();
+    std::vector<int64> headers(num_srcs * 2);
+    std::vector<MPI_Request> requests(num_srcs, MPI_REQUEST_NULL);
+    for(int s = 0; s < num_srcs; s++)
+    {
+        MPI_Irecv(&headers[s * 2], 2, MPI_INT64_T,
+                  src_ranks[s], HOLA_HEADER_TAG, comm, &requests[s]);
+    }
+
+    // take the domains in the order they arrive
+    for(int num_recvd = 0; num_recvd < num_doms; num_recvd++)
+    {
+        int s = MPI_UNDEFINED;
+        MPI_Waitany(num_srcs, &requests[0], &s, MPI_STATUS_IGNORE);
+
+        const int d = next_dom[s];
+        const int64 schema_bytes = headers[s * 2];
+        const int64 data_bytes   = headers[s * 2 + 1];
+
+        if(schema_bytes > 0)
+        {
+            std::string schema((size_t)schema_bytes, ' ');
+            recv_chunked(&schema[0], schema_bytes,
+                         src_ranks[s], HOLA_SCHEMA_TAG, comm);
+            pipeline.m_schemas[d] = schema;
+        }
+        else if(pipeline.m_schemas[d].empty())
+        {
+            ASCENT_ERROR("pipelined hola_mpi: no schema for domain "
+                         << dest_offsets[dest_idx] + d
+                         << ". Sources and destinations must both"
+                         << " use pipelined mode.");
+        }
+
+        Node &n_dom = *slots[d];
+        n_dom.set(Schema(pipeline.m_schemas[d]));
+        recv_chunked(n_dom.contiguous_data_ptr(), data_bytes,
+                     src_ranks[s], HOLA_DATA_TAG, comm);
+
+        next_dom[s]++;
+        if(next_dom[s] < end_dom[s])
+        {
+            MPI_Irecv(&headers[s * 2], 2, MPI_INT64_T,
+                      src_ranks[s], HOLA_HEADER_TAG, comm, &requests[s]);
+        }
+
+        if(on_domain)
+        {
+            on_domain(n_dom);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::detail --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 void
 hola_mpi(const conduit::Node &options,
          conduit::Node &data)
+{
+    hola_mpi(options, data, HolaDomainCallback());
+}
+
+//-----------------------------------------------------------------------------
+void
+hola_mpi(const conduit::Node &options,
+         conduit::Node &data,
+         HolaDomainCallback on_domain)
 {
     MPI_Comm comm  = MPI_Comm_f2c(options["mpi_comm"].to_int());
     // get my rank
@@ -320,6 +614,42 @@ hola_mpi(const conduit::Node &options,
         data_ptr = &md_data;
     }
 
+    bool pipelined = options.has_child("pipelined") &&
+                     options["pipelined"].as_string() == "true";
+
+    if(pipelined)
+    {
+        std::pair<int,int> key(options["mpi_comm"].to_int(), rank_split);
+        detail::HolaPipeline &pipeline = detail::pipelines()[key];
+
+        // the comm map is a collective, only build it the first time
+        if(!pipeline.m_has_comm_map)
+        {
+            hola_mpi_comm_map(*data_ptr,
+                              comm,
+                              world_to_src,
+                              world_to_dest,
+                              pipeline.m_comm_map);
+            pipeline.m_has_comm_map = true;
+        }
+
+        if(is_src_rank)
+        {
+            int src_idx = world_to_src[rank];
+            detail::hola_mpi_send_pipelined(*data_ptr,comm,src_idx,pipeline);
+        }
+        else
+        {
+            int dest_idx = world_to_dest[rank];
+            detail::hola_mpi_recv_pipelined(comm,
+                                            dest_idx,
+                                            pipeline,
+                                            *data_ptr,
+                                            on_domain);
+        }
+        return;
+    }
+
     Node comm_map;
 
     hola_mpi_comm_map(*data_ptr,
@@ -337,7 +667,29 @@ hola_mpi(const conduit::Node &options,
     {
         int dest_idx = world_to_dest[rank];
         hola_mpi_recv(comm,dest_idx,comm_map,*data_ptr);
+        if(on_domain)
+        {
+            NodeIterator itr = data_ptr->children();
+            while(itr.has_next())
+            {
+                on_domain(itr.next());
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+hola_mpi_finish()
+{
+    std::map<std::pair<int,int>, detail::HolaPipeline> &hola_pipelines =
+        detail::pipelines();
+    std::map<std::pair<int,int>, detail::HolaPipeline>::iterator itr;
+    for(itr = hola_pipelines.begin(); itr != hola_pipelines.end(); ++itr)
+    {
+        detail::wait_for_sends(itr->second);
     }
+    hola_pipelines.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -17,6 +17,7 @@
 #include <ascent_config.h>
 #include <ascent_exports.h>
 
+#include <functional>
 #include <string>
 #include <conduit.hpp>
 
@@ -29,9 +30,30 @@
 namespace ascent
 {
 
+/// called by receivers for each domain as soon as it arrives
+typedef std::function<void(conduit::Node &domain)> HolaDomainCallback;
+
+/// Moves domains from the source ranks to the destination ranks.
+///
+/// With options["pipelined"] = "true" the transfer is non-blocking for
+/// the sources: the domains are staged and all sends are posted at once,
+/// so the simulation continues while they are in flight. The comm map
+/// and the schemas are only exchanged the first time (or when a schema
+/// changes), and receivers take domains in the order they arrive. Both
+/// sides have to use the same mode, and the number of domains per source
+/// rank has to stay the same between calls.
 void ASCENT_API hola_mpi(const conduit::Node &options,
                          conduit::Node &data);
 
+/// same as above, receivers call on_domain for each domain as it arrives
+void ASCENT_API hola_mpi(const conduit::Node &options,
+                         conduit::Node &data,
+                         HolaDomainCallback on_domain);
+
+/// waits for the outstanding pipelined sends and drops the cached
+/// transfer state. call before MPI_Finalize.
+void ASCENT_API hola_mpi_finish();
+
 
 /// Creates maps used for book keeping to guide sending domains
 /// from source to destination ranks.
@@ -145,6 +145,8 @@ void DataObject::reset_all()
 #if defined(ASCENT_VTKM_ENABLED)
   std::shared_ptr<VTKHCollection> null_vtkh(nullptr);
   m_vtkh = null_vtkh;
+  m_poly_bp.reset();
+  m_poly_sides.clear();
 #endif
 
 #if defined(ASCENT_DRAY_ENABLED)
@@ -165,6 +167,8 @@ void DataObject::reset(std::shared_ptr<conduit::Node> dataset)
 #if defined(ASCENT_VTKM_ENABLED)
   std::shared_ptr<VTKHCollection> null_vtkh(nullptr);
   m_vtkh = null_vtkh;
+  m_poly_bp.reset();
+  m_poly_sides.clear();
 #endif
 
 #if defined(ASCENT_DRAY_ENABLED)
@@ -196,6 +200,8 @@ void DataObject::reset(conduit::Node *dataset)
 #if defined(ASCENT_VTKM_ENABLED)
   std::shared_ptr<VTKHCollection> null_vtkh(nullptr);
   m_vtkh = null_vtkh;
+  m_poly_bp.reset();
+  m_poly_sides.clear();
 #endif
 
 #if defined(ASCENT_DRAY_ENABLED)
@@ -229,6 +235,7 @@ std::shared_ptr<dray::Collection> DataObject::as_dray_collection()
   }
   else
   {
+    detail::ConversionTimer timer;
     if(m_source == Source::HIGH_BP)
     {
       std::shared_ptr<dray::Collection> collection(new dray::Collection());
@@ -279,6 +286,7 @@ std::shared_ptr<VTKHCollection> DataObject::as_vtkh_collection()
   }
   else
   {
+    detail::ConversionTimer timer;
     if(m_source == Source::HIGH_BP && m_low_bp == nullptr)
     {
       std::shared_ptr<conduit::Node>  low_order(Transmogrifier::low_order(*m_high_bp));
@@ -286,16 +294,18 @@ std::shared_ptr<VTKHCollection> DataObject::as_vtkh_collection()
     }
 
     bool zero_copy = true;
-    conduit::Node n_poly;
     conduit::Node *to_vtkh = nullptr;
     
     if (m_low_bp != nullptr)
     {
       if (Transmogrifier::is_poly(*m_low_bp))
       {
-        Transmogrifier::to_poly(*m_low_bp, n_poly);
-        to_vtkh = &n_poly;
-        zero_copy = false;
+        // the sides and remapped fields live as long as m_vtkh,
+        // so they can be zero copied too
+        m_poly_bp = std::make_shared<conduit::Node>();
+        m_poly_sides.clear();
+        Transmogrifier::to_poly(*m_low_bp, *m_poly_bp, m_poly_sides);
+        to_vtkh = m_poly_bp.get();
       }
       else
       {
@@ -319,7 +329,11 @@ std::shared_ptr<VTKHCollection> DataObject::as_vtkh_collection()
 void DataObject::reset_vtkh_collection()
 {
   if(m_source != Source::VTKH)
+  {
     m_vtkh.reset();
+    m_poly_bp.reset();
+    m_poly_sides.clear();
+  }
 }
 #endif
 
@@ -335,6 +349,7 @@ std::shared_ptr<conduit::Node>  DataObject::as_low_order_bp()
     return m_low_bp;
   }
 
+  detail::ConversionTimer timer;
   if(m_source == Source::HIGH_BP)
   {
     std::shared_ptr<conduit::Node>  low_order(Transmogrifier::low_order(*m_high_bp));
@@ -357,6 +372,38 @@ std::shared_ptr<conduit::Node>  DataObject::as_low_order_bp()
   return m_low_bp;
 }
 
+void DataObject::refresh_state()
+{
+#if defined(ASCENT_VTKM_ENABLED)
+  if(m_source != Source::VTKH || m_vtkh == nullptr)
+  {
+    return;
+  }
+
+  const bool has_cycle = Metadata::n_metadata.has_path("cycle");
+  const bool has_time = Metadata::n_metadata.has_path("time");
+  std::vector<std::string> topos = m_vtkh->topology_names();
+  for(size_t i = 0; i < topos.size(); ++i)
+  {
+    vtkh::DataSet &dset = m_vtkh->dataset_by_topology(topos[i]);
+    if(has_cycle)
+    {
+      dset.SetCycle(Metadata::n_metadata["cycle"].to_uint64());
+    }
+    if(has_time)
+    {
+      dset.SetTime(Metadata::n_metadata["time"].to_float64());
+    }
+  }
+
+  // blueprint converted from the collection is owned by this object
+  if(m_low_bp != nullptr)
+  {
+    detail::add_metadata(*m_low_bp);
+  }
+#endif
+}
+
 std::shared_ptr<conduit::Node>  DataObject::as_high_order_bp()
 {
   if(m_source == Source::INVALID)
@@ -387,6 +434,7 @@ std::shared_ptr<conduit::Node>  DataObject::as_node()
   if(m_source == Source::VTKH && m_low_bp == nullptr)
 
   {
+    detail::ConversionTimer timer;
     conduit::Node *out_data = new conduit::Node();
     bool zero_copy = true;
     VTKHDataAdapter::VTKHCollectionToBlueprintDataSet(m_vtkh.get(), *out_data, true);
@@ -410,6 +458,11 @@ std::shared_ptr<conduit::Node>  DataObject::as_node()
   return nullptr;
 }
 
+double DataObject::conversion_time()
+{
+  return static_cast<double>(detail::conversion_nanoseconds.load()) * 1e-9;
+}
+
 DataObject::Source DataObject::source() const
 {
   return m_source;
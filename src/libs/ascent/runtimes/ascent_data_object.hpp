@@ -17,6 +17,7 @@
 #include <ascent.hpp>
 #include <conduit.hpp>
 #include <memory>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -73,11 +74,20 @@ public:
   std::shared_ptr<conduit::Node>  as_node();          // just return the coduit node
   DataObject::Source              source() const;
   std::string source_string() const;
+  // stamps the current cycle and time (from Metadata) on the
+  // representations this object owns, used when a cached filter
+  // output is reused by a later execution
+  void                            refresh_state();
+  // seconds spent converting between representations in the as_* methods
+  static double                   conversion_time();
 protected:
   std::shared_ptr<conduit::Node>  m_low_bp;
   std::shared_ptr<conduit::Node>  m_high_bp;
 #if defined(ASCENT_VTKM_ENABLED)
   std::shared_ptr<VTKHCollection> m_vtkh;
+  // side decompositions of polyhedral data, zero copied into m_vtkh
+  std::shared_ptr<conduit::Node>  m_poly_bp;
+  std::vector<std::shared_ptr<conduit::Node>> m_poly_sides;
 #endif
 #if defined(ASCENT_DRAY_ENABLED)
   std::shared_ptr<dray::Collection> m_dray;
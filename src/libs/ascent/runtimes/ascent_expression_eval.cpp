@@ -29,6 +29,8 @@
 #endif
 
 #include <ctime>
+#include <map>
+#include <set>
 #include <flow_timer.hpp>
 #include <stdio.h>
 #include <stdlib.h>
@@ -60,6 +62,131 @@ conduit::Node g_object_table;
 
 Cache ExpressionEval::m_cache;
 
+// parsed expressions keyed by expression text, name, and dataset schema
+std::map<std::string, std::shared_ptr<ExpressionPlan>> g_plan_cache;
+// number of evaluations that reused a cached plan
+size_t g_plan_cache_hits = 0;
+// upper bound on the number of cached plans, the cache is
+// flushed when it grows past this
+const size_t g_max_plans = 1024;
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::expressions::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// appends the dtype ids of the leaves under n, jitted kernels are
+// specialized on them
+//-----------------------------------------------------------------------------
+void
+append_dtype_ids(const conduit::Node &n, std::string &item)
+{
+  if(n.number_of_children() == 0)
+  {
+    item += ":" + std::to_string(n.dtype().id());
+    return;
+  }
+  conduit::NodeConstIterator itr = n.children();
+  while(itr.has_next())
+  {
+    append_dtype_ids(itr.next(), item);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// builds a signature of the names, types, associations, and data types
+// of the coordsets, topologies, and fields in the local domains. Plans
+// are only reused when this matches.
+//-----------------------------------------------------------------------------
+std::string
+schema_signature(const conduit::Node &dataset)
+{
+  std::set<std::string> items;
+  const int num_domains = dataset.number_of_children();
+  for(int i = 0; i < num_domains; ++i)
+  {
+    const conduit::Node &dom = dataset.child(i);
+    if(dom.has_child("coordsets"))
+    {
+      conduit::NodeConstIterator itr = dom["coordsets"].children();
+      while(itr.has_next())
+      {
+        const conduit::Node &coords = itr.next();
+        std::string item = "coordset:" + itr.name();
+        if(coords.has_child("type"))
+        {
+          item += ":" + coords["type"].to_string();
+        }
+        if(coords.has_child("values"))
+        {
+          append_dtype_ids(coords["values"], item);
+        }
+        items.insert(item);
+      }
+    }
+    if(dom.has_child("topologies"))
+    {
+      conduit::NodeConstIterator itr = dom["topologies"].children();
+      while(itr.has_next())
+      {
+        const conduit::Node &topo = itr.next();
+        std::string item = "topology:" + itr.name();
+        if(topo.has_child("type"))
+        {
+          item += ":" + topo["type"].to_string();
+        }
+        if(topo.has_path("elements/shape"))
+        {
+          item += ":" + topo["elements/shape"].to_string();
+        }
+        if(topo.has_path("elements/connectivity"))
+        {
+          append_dtype_ids(topo["elements/connectivity"], item);
+        }
+        items.insert(item);
+      }
+    }
+    if(dom.has_child("fields"))
+    {
+      conduit::NodeConstIterator itr = dom["fields"].children();
+      while(itr.has_next())
+      {
+        const conduit::Node &field = itr.next();
+        std::string item = "field:" + itr.name();
+        if(field.has_child("association"))
+        {
+          item += ":" + field["association"].to_string();
+        }
+        if(field.has_child("topology"))
+        {
+          item += ":" + field["topology"].to_string();
+        }
+        if(field.has_child("values"))
+        {
+          item += ":" +
+            std::to_string(field["values"].number_of_children());
+          append_dtype_ids(field["values"], item);
+        }
+        items.insert(item);
+      }
+    }
+  }
+
+  std::string res;
+  for(const auto &item : items)
+  {
+    res += item + ";";
+  }
+  return res;
+}
+
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::expressions::detail --
+//-----------------------------------------------------------------------------
+
 double
 Cache::last_known_time()
 {
@@ -81,6 +208,21 @@ void
 Cache::last_known_time(double time)
 {
   m_data["last_known_time"] = time;
+  m_history.append("last_known_time", m_data["last_known_time"]);
+}
+
+void
+Cache::add_entry(const std::string &path, const conduit::Node &entry)
+{
+  m_data[path] = entry;
+  m_history.append(path, entry);
+}
+
+void
+Cache::reset()
+{
+  m_data.reset();
+  m_history.rewrite(m_data);
 }
 
 void
@@ -150,6 +292,8 @@ Cache::filter_time(double ftime)
       << " after simulation time " << ftime << ".";
   m_data["ascent_cache_info"].append() = msg.str();
   m_filtered = true;
+  // entries were removed, so the history can't just be appended to
+  m_history.rewrite(m_data);
 }
 
 bool
@@ -171,15 +315,32 @@ Cache::load(const std::string &dir, const std::string &session)
   std::string session_file = conduit::utils::join_path(dir, file_name);
   m_session_file = session_file;
 
-  bool exists = conduit::utils::is_file(session_file);
+  const std::string history_file =
+    HistoryStore::session_file_name(session_file);
+  const std::string yaml_file = session_file + ".yaml";
 
-  if(m_rank == 0 && exists)
+  // 0 = nothing to load, 1 = binary history, 2 = yaml from older versions
+  int source = 0;
+  if(m_rank == 0)
   {
-    m_data.load(session_file + ".yaml", "yaml");
+    m_history.file_name(history_file);
+    if(HistoryStore::is_history_file(history_file))
+    {
+      source = 1;
+      HistoryStore::load(history_file, m_data);
+    }
+    else if(conduit::utils::is_file(yaml_file))
+    {
+      source = 2;
+      m_data.load(yaml_file, "yaml");
+      // start the binary history from the old session
+      m_history.rewrite(m_data);
+    }
   }
 
 #ifdef ASCENT_MPI_ENABLED
-  if(exists)
+  MPI_Bcast(&source, 1, MPI_INT, 0, mpi_comm);
+  if(source != 0)
   {
     conduit::relay::mpi::broadcast_using_schema(m_data, 0, mpi_comm);
   }
@@ -191,9 +352,9 @@ void Cache::save()
 {
   // the session file can be blank during testing,
   // since its not actually opening ascent
-  if(m_rank == 0 && !m_data.dtype().is_empty() && m_session_file != "")
+  if(m_rank == 0 && m_session_file != "")
   {
-    m_data.save(m_session_file+".yaml","yaml");
+    m_history.flush();
   }
 }
 
@@ -289,6 +450,8 @@ register_builtin()
   flow::Workspace::register_filter_type<expressions::ExprHistogramCDF>();
   flow::Workspace::register_filter_type<expressions::ExprHistogramCDFQuantile>();
   flow::Workspace::register_filter_type<expressions::ExprHistogramBinByValue>();
+  flow::Workspace::register_filter_type<expressions::ExprQuantileSketch>();
+  flow::Workspace::register_filter_type<expressions::ExprQuantileSketchQuantile>();
   flow::Workspace::register_filter_type<expressions::ExprHistogramBinByIndex>();
 
   // mesh ops
@@ -937,6 +1100,41 @@ initialize_functions()
   the axis of `cdf`. For example, if `q` is 0.5 the result is the value on the \
   x-axis which 50 percent of the data lies below.";
 
+  //---------------------------------------------------------------------------
+  // quantile_sketch()
+  //---------------------------------------------------------------------------
+  conduit::Node &sketch_sig = (*functions)["quantile_sketch"].append();
+  sketch_sig["return_type"] = "quantile_sketch";
+  sketch_sig["filter_name"] = "expr_quantile_sketch";
+  sketch_sig["args/arg1/type"] = "field";
+  sketch_sig["args/relative_accuracy/type"] = "double";
+  sketch_sig["args/relative_accuracy/optional"];
+  sketch_sig["args/relative_accuracy/description"] =
+      "Relative error of the quantiles returned from the sketch. \
+  Defaults to ``0.01``.";
+  sketch_sig["description"] = "Return a mergeable quantile sketch of the \
+  field. The sketch is built in a single pass over the field and merged \
+  across ranks. Quantiles taken from it are within `relative_accuracy` of the \
+  true value, independent of the data range, which keeps the tails accurate. \
+  Sketches are cached while the actions execute, so several quantiles of the same \
+  field only pay for one pass.";
+
+  //---------------------------------------------------------------------------
+  // quantile() from a sketch
+  //---------------------------------------------------------------------------
+  conduit::Node &sketch_quantile_sig = (*functions)["quantile"].append();
+  sketch_quantile_sig["return_type"] = "double";
+  sketch_quantile_sig["filter_name"] = "expr_quantile_sketch_quantile";
+  sketch_quantile_sig["args/sketch/type"] = "quantile_sketch";
+  sketch_quantile_sig["args/sketch/description"] = "A quantile sketch of a field.";
+  sketch_quantile_sig["args/q/type"] = "double";
+  sketch_quantile_sig["args/q/description"] =
+      "Quantile between 0 and 1 inclusive.";
+  sketch_quantile_sig["description"] = "Return the `q`-th quantile of the \
+  field summarized by `sketch`. For example, \
+  ``quantile(quantile_sketch(field('pressure')), 0.99)`` returns the 99th \
+  percentile of pressure.";
+
   //---------------------------------------------------------------------------
   // bin()
   //---------------------------------------------------------------------------
@@ -1163,6 +1361,19 @@ initialize_functions()
   binning_sig["args/component/description"] =
       "the component of a vector field to use for the reduction."
       " Example 'x' for a field defined as 'velocity/x'";
+  binning_sig["args/sparse/type"] = "bool";
+  binning_sig["args/sparse/optional"];
+  binning_sig["args/sparse/description"] =
+      "Only keep the bins that get a value instead of every bin. Use this "
+      "when the axes span many bins that are mostly empty. Defaults to "
+      "``False``.";
+  binning_sig["args/sparse_output/type"] = "bool";
+  binning_sig["args/sparse_output/optional"];
+  binning_sig["args/sparse_output/description"] =
+      "Keep the result of a sparse binning sparse. The ``bin_ids`` "
+      "attribute holds the ids of the occupied bins and ``value`` their "
+      "values. Defaults to ``False``, which expands the result to every "
+      "bin.";
   binning_sig["description"] = "Returns a multidimensional data binning.";
 
   //---------------------------------------------------------------------------
@@ -1516,6 +1727,12 @@ initialize_objects()
   histogram["num_bins/type"] = "int";
   histogram["clamp/type"] = "bool";
 
+  conduit::Node &sketch = (*objects)["quantile_sketch/attrs"];
+  sketch["count/type"] = "double";
+  sketch["min_val/type"] = "double";
+  sketch["max_val/type"] = "double";
+  sketch["relative_accuracy/type"] = "double";
+
   conduit::Node &value_position = (*objects)["value_position/attrs"];
   value_position["value/type"] = "double";
   value_position["position/type"] = "vector";
@@ -1597,6 +1814,32 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
     expr_name = expr;
   }
 
+  conduit::Node *dataset = m_data_object.as_node().get();
+
+  // The graph only depends on the expression text and the tables, but
+  // we also key on the schema of the dataset so a plan is never reused
+  // after fields or topologies change. Plans are built locally, so ranks
+  // can safely disagree on hits.
+  const std::string plan_key = expr + "\n" + expr_name + "\n" +
+                               detail::schema_signature(*dataset);
+
+  std::shared_ptr<ExpressionPlan> plan;
+  auto plan_itr = g_plan_cache.find(plan_key);
+  const bool plan_hit = plan_itr != g_plan_cache.end();
+  if(plan_hit)
+  {
+    plan = plan_itr->second;
+    g_plan_cache_hits++;
+  }
+  else
+  {
+    plan = std::make_shared<ExpressionPlan>();
+    plan->m_workspace = std::make_shared<flow::Workspace>();
+  }
+  ASCENT_DATA_ADD("plan_cache", plan_hit ? "hit" : "miss");
+
+  flow::Workspace &w = *plan->m_workspace;
+
   // stores temporary fields, topos, and coords that need to be removed after
   // the expression runs
   conduit::Node remove;
@@ -1606,47 +1849,64 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
   w.registry().add<conduit::Node>("cache", &m_cache.m_data, -1);
   w.registry().add<conduit::Node>("function_table", &g_function_table, -1);
   w.registry().add<conduit::Node>("object_table", &g_object_table, -1);
-  int cycle = get_state_var(*m_data_object.as_node().get(), "cycle").to_int32();
+  int cycle = get_state_var(*dataset, "cycle").to_int32();
   w.registry().add<int>("cycle", &cycle, -1);
 
-  try
+  if(!plan_hit)
   {
-    scan_string(expr.c_str());
+    try
+    {
+      scan_string(expr.c_str());
 
-  }
-  catch(const char *msg)
-  {
-    w.reset();
-    ASCENT_ERROR("Expression parsing error: " << msg << " in '" << expr << "'");
-  }
+    }
+    catch(const char *msg)
+    {
+      w.reset();
+      ASCENT_ERROR("Expression parsing error: " << msg << " in '" << expr << "'");
+    }
 
-  ASTNode *root_node = get_result();
+    ASTNode *root_node = get_result();
 
-  conduit::Node root;
-  conduit::Node symbol_table;
+    try
+    {
+      flow::Timer build_graph_timer;
+      // change the execution policy here
+      // change false to true to generate a graph with verbose names
+      BuildGraphVisitor build_graph(
+          w, std::make_shared<const FusePolicy>(), false);
+      // BuildGraphVisitor build_graph(
+      //     w, std::make_shared<const RoundtripPolicy>(), false);
+      root_node->accept(&build_graph);
+      plan->m_root = build_graph.get_output();
+      plan->m_symbol_table = build_graph.table();
+
+      // if root is a derived field add a JitFilter to execute it
+      if(plan->m_root["type"].as_string() == "jitable")
+      {
+        jit_root(w, plan->m_root, expr_name);
+      }
 
-  try
-  {
-    flow::Timer build_graph_timer;
-    // change the execution policy here
-    // change false to true to generate a graph with verbose names
-    BuildGraphVisitor build_graph(
-        w, std::make_shared<const FusePolicy>(), false);
-    // BuildGraphVisitor build_graph(
-    //     w, std::make_shared<const RoundtripPolicy>(), false);
-    root_node->accept(&build_graph);
-    root = build_graph.get_output();
-
-    symbol_table = build_graph.table();
-    w.registry().add<conduit::Node>("symbol_table", &symbol_table, -1);
-    // if root is a derived field add a JitFilter to execute it
-    if(root["type"].as_string() == "jitable")
+      //w.graph().save_dot_html("ascent_expressions_graph.html");
+      ASCENT_DATA_ADD("build_graph time", build_graph_timer.elapsed());
+    }
+    catch(std::exception &e)
     {
-      jit_root(root, expr_name);
+      delete root_node;
+      w.reset();
+      ASCENT_ERROR("Error while executing expression '" << expr
+                                                        << "': " << e.what());
     }
+    delete root_node;
+  }
+
+  const conduit::Node &root = plan->m_root;
+  // filters record symbol values as they execute, so each
+  // evaluation works on a fresh copy of the symbol table
+  conduit::Node symbol_table = plan->m_symbol_table;
+  w.registry().add<conduit::Node>("symbol_table", &symbol_table, -1);
 
-    //w.graph().save_dot_html("ascent_expressions_graph.html");
-    ASCENT_DATA_ADD("build_graph time", build_graph_timer.elapsed());
+  try
+  {
     flow::Timer execute_timer;
     w.execute();
 
@@ -1654,11 +1914,21 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
   }
   catch(std::exception &e)
   {
-    delete root_node;
     w.reset();
+    g_plan_cache.erase(plan_key);
     ASCENT_ERROR("Error while executing expression '" << expr
                                                       << "': " << e.what());
   }
+
+  if(!plan_hit)
+  {
+    if(g_plan_cache.size() >= g_max_plans)
+    {
+      g_plan_cache.clear();
+    }
+    g_plan_cache[plan_key] = plan;
+  }
+
   std::string filter_name = root["filter_name"].as_string();
 
   conduit::Node *n_res = w.registry().fetch<conduit::Node>(filter_name);
@@ -1669,7 +1939,6 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
 
   // remove temporary fields, topologies, and coordsets from the dataset
   // TODO: We need a way to delete the intermediate results during execution
-  conduit::Node *dataset = m_data_object.as_node().get();
   const int num_domains = dataset->number_of_children();
   for(int i = 0; i < num_domains; ++i)
   {
@@ -1728,7 +1997,7 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
   {
     std::stringstream cache_entry;
     cache_entry << expr_name << "/" << cycle;
-    m_cache.m_data[cache_entry.str()] = return_val;
+    m_cache.add_entry(cache_entry.str(), return_val);
   }
   // now we might have intermediate symbol, and
   // we also need to add them to the cache
@@ -1741,12 +2010,12 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
       const std::string symbol_name = symbol.name();
       std::stringstream cache_entry;
       cache_entry << symbol_name << "/" << cycle;
-      m_cache.m_data[cache_entry.str()] = symbol;
+      m_cache.add_entry(cache_entry.str(), symbol);
     }
   }
 
-  delete root_node;
-  w.reset();
+  // keep the graph for the next evaluation, only release the data
+  w.registry().reset();
 #ifdef ASCENT_JIT_ENABLED
   ASCENT_DATA_ADD("Device high water mark", ArrayRegistry::high_water_mark());
   ASCENT_DATA_ADD("Current Device usage ", ArrayRegistry::device_usage());
@@ -1757,7 +2026,9 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
   return return_val;
 }
 
-void ExpressionEval::jit_root(conduit::Node &root, const std::string &expr_name)
+void ExpressionEval::jit_root(flow::Workspace &w,
+                              conduit::Node &root,
+                              const std::string &expr_name)
 {
   // When the root node in the executiuon graph is a jittable
   // result, we have to complile that kernel and execute it
@@ -1791,7 +2062,22 @@ ExpressionEval::get_cache()
 void
 ExpressionEval::reset_cache()
 {
-  m_cache.m_data.reset();
+  m_cache.reset();
+  // identifier types are resolved from the cache when plans are built
+  reset_plan_cache();
+}
+
+void
+ExpressionEval::reset_plan_cache()
+{
+  g_plan_cache.clear();
+  g_plan_cache_hits = 0;
+}
+
+size_t
+ExpressionEval::plan_cache_hits()
+{
+  return g_plan_cache_hits;
 }
 
 void
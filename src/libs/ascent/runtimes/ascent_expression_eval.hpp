@@ -18,6 +18,9 @@
 #include <ascent_data_object.hpp>
 
 #include "flow_workspace.hpp"
+#include "expressions/ascent_expression_history.hpp"
+
+#include <memory>
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
 //-----------------------------------------------------------------------------
@@ -40,6 +43,8 @@ void ASCENT_API initialize_objects();
 struct Cache
 {
   conduit::Node m_data;
+  // binary session history, only written by rank 0
+  HistoryStore m_history;
   int m_rank;
   bool m_filtered = false;
   bool m_loaded = false;
@@ -53,8 +58,12 @@ struct Cache
   void filter_time(double ftime);
   bool filtered();
   bool loaded();
+  // sets an entry and queues it for the session history
+  void add_entry(const std::string &path, const conduit::Node &entry);
+  void reset();
+  // appends new entries to the session history
   void save();
-  // allow saving with an alternative name
+  // yaml export with an alternative name
   void save(const std::string &filename);
   void save(const std::string &filename,
             const std::vector<std::string> &selection);
@@ -64,13 +73,25 @@ struct Cache
 
 static conduit::Node m_function_table;
 
+// A parsed expression: the flow graph built for it (including any jit
+// filters) and the symbol table produced while building the graph.
+// Plans are reused across evaluations so repeated queries skip lexing,
+// parsing, and graph construction.
+struct ExpressionPlan
+{
+  std::shared_ptr<flow::Workspace> m_workspace;
+  conduit::Node m_root;
+  conduit::Node m_symbol_table;
+};
+
 class ASCENT_API ExpressionEval
 {
 protected:
   DataObject m_data_object;
-  flow::Workspace w;
   static Cache m_cache;
-  void jit_root(conduit::Node &root, const std::string &expr_name);
+  void jit_root(flow::Workspace &w,
+                conduit::Node &root,
+                const std::string &expr_name);
 public:
   ExpressionEval(DataObject &dataset);
   ExpressionEval(conduit::Node *dataset);
@@ -79,6 +100,10 @@ public:
   static const conduit::Node &get_cache();
   static void get_last(conduit::Node &data);
   static void reset_cache();
+  // drops all cached expression plans
+  static void reset_plan_cache();
+  // number of evaluations that reused a cached plan since the last reset
+  static size_t plan_cache_hits();
   static void load_cache(const std::string &dir,
                          const std::string &session);
 
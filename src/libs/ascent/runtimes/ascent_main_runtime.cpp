@@ -16,6 +16,7 @@
 // standard lib includes
 #include <string.h>
 #include <algorithm>
+#include <mutex>
 
 //-----------------------------------------------------------------------------
 // thirdparty includes
@@ -31,6 +32,7 @@
 // -- conduit relay mpi
 #include <conduit_relay_mpi.hpp>
 #include <conduit_blueprint_mpi.hpp>
+#include <ascent_hola_mpi.hpp>
 #endif
 
 #include <flow.hpp>
@@ -38,19 +40,26 @@
 #include <ascent_actions_utils.hpp>
 #include <ascent_metadata.hpp>
 #include <ascent_runtime_filters.hpp>
+#include <ascent_runtime_staged_writer.hpp>
+#include <ascent_runtime_trigger_filters.hpp>
 #include <ascent_expression_eval.hpp>
+#include <png_utils/ascent_png_writer.hpp>
 #include <expressions/ascent_blueprint_architect.hpp>
 #include <expressions/ascent_memory_manager.hpp>
 #include <expressions/ascent_derived_jit.hpp>
 #include <ascent_transmogrifier.hpp>
 #include <ascent_data_object.hpp>
 #include <ascent_data_logger.hpp>
+#include <ascent_mpi_utils.hpp>
 
 #if defined(ASCENT_VTKM_ENABLED)
 #include <vtkm/cont/Error.h>
 #include <vtkh/vtkh.hpp>
 #include <vtkh/Error.hpp>
 #include <vtkh/Logger.hpp>
+#include <vtkh/compositing/Compositor.hpp>
+#include <ascent_vtkh_data_adapter.hpp>
+#include <ascent_runtime_rendering_filters.hpp>
 
 #ifdef VTKM_CUDA
 #include <vtkm/cont/cuda/ChooseCudaDevice.h>
@@ -91,6 +100,31 @@ class InfoHandler
 
 int InfoHandler::m_rank = 0;
 
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// number of open runtimes created by the simulation (not by triggers).
+// Caches and writers shared by all runtimes are released when the last
+// one closes.
+//-----------------------------------------------------------------------------
+std::mutex &
+top_level_runtimes_mutex()
+{
+  static std::mutex m;
+  return m;
+}
+
+int &
+top_level_runtimes()
+{
+  static int count = 0;
+  return count;
+}
+
+};
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //
@@ -106,8 +140,16 @@ AscentRuntime::AscentRuntime()
  m_rank(0),
  m_default_output_dir("."),
  m_session_name("ascent_session"),
- m_field_filtering(false)
+ m_field_filtering(false),
+ m_incremental_execution(false),
+ m_has_published_object(false),
+ m_top_level(!runtime::filters::BasicTrigger::firing())
 {
+    if(m_top_level)
+    {
+        std::lock_guard<std::mutex> lock(detail::top_level_runtimes_mutex());
+        detail::top_level_runtimes()++;
+    }
     m_ghost_fields.append() = "ascent_ghosts";
     flow::filters::register_builtin();
     ResetInfo();
@@ -384,6 +426,15 @@ AscentRuntime::Initialize(const conduit::Node &options)
       }
     }
 
+    if(options.has_path("incremental_execution"))
+    {
+      if(options["incremental_execution"].as_string() == "true")
+      {
+        m_incremental_execution = true;
+      }
+    }
+    m_workspace.enable_output_caching(m_incremental_execution);
+
     Node msg;
     ascent::about(msg["about"]);
     msg["options"] = options;
@@ -503,12 +554,66 @@ AscentRuntime::Cleanup()
         ftimings << m_workspace.timing_info();
         ftimings.close();
     }
+    // finish writing any queued images. Cleanup runs from the
+    // destructor, so report failed writes instead of throwing
+    try
+    {
+        m_png_queue.Flush();
+    }
+    catch(conduit::Error &e)
+    {
+        DisplayError("[Error] Ascent image writes: " + e.message() + "\n");
+    }
+    // and any staged extracts
+    runtime::filters::StagedWriter::wait();
+
+    if(!m_top_level)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(detail::top_level_runtimes_mutex());
+        if(--detail::top_level_runtimes() > 0)
+        {
+            // other runtimes still use the shared state
+            return;
+        }
+    }
+
+    // release the flow graphs held by cached expression plans
+    runtime::expressions::ExpressionEval::reset_plan_cache();
+    // the refinements of high order meshes
+    Transmogrifier::clear_low_order_cache();
+    // and the sides of polyhedral meshes
+    Transmogrifier::clear_poly_cache();
+    // and the quantile sketches
+    runtime::expressions::clear_quantile_sketch_cache();
+    // stop the staged extract writer
+    runtime::filters::StagedWriter::finish();
+#ifdef ASCENT_MPI_ENABLED
+    // wait for any pipelined hola sends still in flight, the
+    // pipelines are shared by every runtime in the process
+    hola_mpi_finish();
+#endif
+    // release the runtimes kept by triggers
+    runtime::filters::BasicTrigger::reset_runtimes();
+#if defined(ASCENT_VTKM_ENABLED)
+    // release the converted topologies
+    VTKHDataAdapter::ClearTopologyCache();
+    // forget the auto camera winners of previous cycles
+    runtime::filters::DefaultRender::reset_auto_camera_seeds();
+    // and free the images kept for the next render
+    vtkh::Compositor::ReleaseImagePool();
+#endif
 }
 
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::Publish(const conduit::Node &data)
 {
+    m_has_published_object = false;
+    m_published_object.reset_all();
 
     blueprint::mesh::to_multi_domain(data, m_source);
     EnsureDomainIds();
@@ -521,6 +626,32 @@ AscentRuntime::Publish(const conduit::Node &data)
     PaintNestsets();
 }
 
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::PublishDataObject(DataObject &data_object)
+{
+    // the publishing runtime already converted the data to multi domain,
+    // checked the domain ids, and painted nestsets, so all that is left
+    // is to pick up the ghosts it settled on
+    m_source.set_external(*data_object.as_low_order_bp());
+    if(Metadata::n_metadata.has_path("ghost_field"))
+    {
+        m_ghost_fields = Metadata::n_metadata["ghost_field"];
+    }
+    m_published_object = data_object;
+    m_has_published_object = true;
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::ReleasePublishedObject()
+{
+    m_has_published_object = false;
+    m_published_object.reset_all();
+    m_data_object.reset_all();
+    m_source.reset();
+}
+
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::EnsureDomainIds()
@@ -1453,18 +1584,167 @@ AscentRuntime::PopulateMetadata()
   Metadata::n_metadata["comments"] = m_comments;
 
 }
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// appends the address and size of every leaf array (and the value of
+// every string leaf) under n to oss
+void
+append_leaf_identity(const conduit::Node &n, std::ostringstream &oss)
+{
+  const int num_children = n.number_of_children();
+  if(num_children == 0)
+  {
+    if(n.dtype().is_string())
+    {
+      oss << n.as_string() << ",";
+    }
+    else
+    {
+      oss << n.data_ptr() << ":" << n.dtype().number_of_elements() << ",";
+    }
+    return;
+  }
+
+  for(int i = 0; i < num_children; ++i)
+  {
+    append_leaf_identity(n.child(i), oss);
+  }
+}
+
+};
+
+//-----------------------------------------------------------------------------
+// Computes a revision for each published coordset, topology and field.
+//
+// Data is only considered unchanged when the simulation provides
+// a revision counter for it:
+//
+//   state/revisions/{coordsets,topologies,fields}/name
+//
+// and neither the counter nor the memory backing the data
+// changed since the last cycle. Revisions are agreed on across
+// all ranks, so filters make the same reuse decisions everywhere.
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::UpdateSourceRevisions()
+{
+  const std::string categories[3] = {"coordsets", "topologies", "fields"};
+
+  std::map<std::string,std::string> identities;
+  std::set<std::string> volatile_names;
+
+  const int num_domains = m_source.number_of_children();
+  for(int d = 0; d < num_domains; ++d)
+  {
+    const conduit::Node &dom = m_source.child(d);
+    for(int c = 0; c < 3; ++c)
+    {
+      if(!dom.has_child(categories[c]))
+      {
+        continue;
+      }
+
+      const conduit::Node &n_cat = dom[categories[c]];
+      const int num_children = n_cat.number_of_children();
+      for(int i = 0; i < num_children; ++i)
+      {
+        const std::string name = n_cat.child(i).name();
+        const std::string key = categories[c] + "/" + name;
+        const std::string rev_path = "state/revisions/" + key;
+
+        std::ostringstream oss;
+        if(dom.has_path(rev_path))
+        {
+          oss << dom[rev_path].to_int64() << "|";
+        }
+        else
+        {
+          volatile_names.insert(key);
+        }
+        detail::append_leaf_identity(n_cat.child(i), oss);
+        identities[key] += oss.str() + ";";
+      }
+    }
+  }
+
+  // encode what this rank knows as strings so we can
+  // gather them: '+' exists, '*' changed
+  std::set<std::string> names;
+  std::map<std::string,std::string>::const_iterator itr;
+  for(itr = identities.begin(); itr != identities.end(); ++itr)
+  {
+    const std::string &key = itr->first;
+    names.insert("+" + key);
+
+    std::map<std::string,std::string>::const_iterator prev;
+    prev = m_source_identities.find(key);
+    if(volatile_names.count(key) > 0 ||
+       prev == m_source_identities.end() ||
+       prev->second != itr->second)
+    {
+      names.insert("*" + key);
+    }
+  }
+
+  m_source_identities = identities;
+
+  gather_strings(names);
+
+  std::map<std::string,int> revisions;
+  std::set<std::string>::const_iterator n_itr;
+  for(n_itr = names.begin(); n_itr != names.end(); ++n_itr)
+  {
+    if((*n_itr)[0] != '+')
+    {
+      continue;
+    }
+
+    const std::string key = n_itr->substr(1);
+    std::map<std::string,int>::const_iterator prev;
+    prev = m_source_revisions.find(key);
+    int rev = prev != m_source_revisions.end() ? prev->second : 0;
+    if(names.count("*" + key) > 0)
+    {
+      rev++;
+    }
+    revisions[key] = rev;
+  }
+
+  m_source_revisions = revisions;
+
+  conduit::Node &n_revs = Metadata::n_metadata["revisions"];
+  n_revs.reset();
+  std::map<std::string,int>::const_iterator r_itr;
+  for(r_itr = revisions.begin(); r_itr != revisions.end(); ++r_itr)
+  {
+    n_revs[r_itr->first] = r_itr->second;
+  }
+}
+
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::ConnectSource()
 {
-    // There is no promise that all data can be zero copied
-    // and conversions to vtkh/low order will be invalid.
-    // We must reset the source object
-    conduit::Node *data_node = new conduit::Node();
-    data_node->set_external(m_source);
-    m_data_object.reset(data_node);
+    if(m_has_published_object)
+    {
+        // share the representations of the publishing runtime. Field
+        // filtering would remove fields from its data, so skip it
+        m_data_object = m_published_object;
+    }
+    else
+    {
+        // There is no promise that all data can be zero copied
+        // and conversions to vtkh/low order will be invalid.
+        // We must reset the source object
+        conduit::Node *data_node = new conduit::Node();
+        data_node->set_external(m_source);
+        m_data_object.reset(data_node);
 
-    SourceFieldFilter();
+        SourceFieldFilter();
+    }
 
     // note: if the reg entry for data was already added
     // the set_external updates everything,
@@ -1976,6 +2256,73 @@ AscentRuntime::Execute(const conduit::Node &actions)
 
     m_workspace.enable_timings(log_timings);
 
+    bool perf_report = false;
+    if(m_runtime_options.has_child("performance_report") &&
+       m_runtime_options["performance_report"].as_string() == "true")
+    {
+      perf_report = true;
+    }
+
+    std::string perf_trace = "";
+    if(m_runtime_options.has_child("performance_trace"))
+    {
+      perf_trace = m_runtime_options["performance_trace"].as_string();
+      perf_trace = conduit::utils::join_file_path(m_default_output_dir,
+                                                  perf_trace);
+      perf_report = true;
+    }
+
+    m_workspace.enable_performance_records(perf_report);
+    m_workspace.set_performance_probe(perf_report ? &m_perf_report : NULL);
+
+    bool parallel_exec = false;
+    if(m_runtime_options.has_child("parallel_execution") &&
+       m_runtime_options["parallel_execution"].as_string() == "true")
+    {
+      parallel_exec = true;
+    }
+
+    m_workspace.enable_parallel_execution(parallel_exec);
+
+    if(m_runtime_options.has_child("parallel_execution_threads"))
+    {
+      m_workspace.set_number_of_threads(
+        m_runtime_options["parallel_execution_threads"].to_int32());
+    }
+
+    // images from the previous call must be on disk before we
+    // start writing new ones, and any that failed are reported here
+    m_png_queue.Flush();
+
+    bool async_images = false;
+    if(m_runtime_options.has_child("async_image_writes") &&
+       m_runtime_options["async_image_writes"].as_string() == "true")
+    {
+      async_images = true;
+    }
+    m_png_queue.SetAsync(async_images);
+
+    if(m_runtime_options.has_child("async_image_threads"))
+    {
+      const int image_threads =
+        m_runtime_options["async_image_threads"].to_int32();
+      if(image_threads != m_png_queue.NumberOfThreads())
+      {
+        m_png_queue.SetNumberOfThreads(image_threads);
+      }
+    }
+
+    bool distributed_images = false;
+    if(m_runtime_options.has_child("distributed_image_writes") &&
+       m_runtime_options["distributed_image_writes"].as_string() == "true")
+    {
+      distributed_images = true;
+    }
+    m_png_queue.SetDistributed(distributed_images);
+
+    // renderers write through this runtime's queue while it executes
+    PNGWriter::Scope png_scope(m_png_queue);
+
     // catch any errors that come up here and forward
     // them up as a conduit error
 
@@ -2029,6 +2376,12 @@ AscentRuntime::Execute(const conduit::Node &actions)
         m_previous_actions = actions;
 
         PopulateMetadata(); // add metadata so filters can access it
+        if(m_incremental_execution)
+        {
+          // track what changed in the published data so
+          // filters can reuse results from previous cycles
+          UpdateSourceRevisions();
+        }
 
         // add the source to the registry so we can access information
         // about the original mesh (like bounds)
@@ -2052,9 +2405,37 @@ AscentRuntime::Execute(const conduit::Node &actions)
           vtkh::DataLogger::GetInstance()->AddLogData("cycle", cycle);
         }
 #endif
+        // allocations are only counted for the report
+        MemoryTracking memory_tracking(perf_report);
+        if(perf_report)
+        {
+          m_perf_report.begin_execute();
+        }
+
+        // quantile sketches are keyed on the arrays they were built
+        // from, which can change between calls
+        runtime::expressions::clear_quantile_sketch_cache();
+
         // now execute the data flow graph
         m_workspace.execute();
 
+        if(perf_report)
+        {
+          int cycle = 0;
+          if(Metadata::n_metadata.has_path("cycle"))
+          {
+            cycle = Metadata::n_metadata["cycle"].to_int32();
+          }
+          Node record;
+          record.set(m_workspace.performance_record());
+          m_perf_report.end_execute(record);
+          PerformanceReport::aggregate(record, cycle, m_info["performance"]);
+          if(perf_trace != "")
+          {
+            m_perf_report.trace(perf_trace, m_info["performance"]);
+          }
+        }
+
 #if defined(ASCENT_VTKM_ENABLED)
         if(log_timings)
         {
@@ -2066,6 +2447,9 @@ AscentRuntime::Execute(const conduit::Node &actions)
           SaveSession();
         }
 
+        // append this cycle's expression results to the session history
+        runtime::expressions::ExpressionEval::save_cache();
+
         // add render results to info
         Node render_file_names;
         Node renders;
@@ -2087,6 +2471,16 @@ AscentRuntime::Execute(const conduit::Node &actions)
             }
         }
 
+        // report staged extracts that finished writing
+        // since the last execute
+        Node staged_extracts;
+        runtime::filters::StagedWriter::completed(staged_extracts);
+        const int num_staged = staged_extracts.number_of_children();
+        for(int i = 0; i < num_staged; ++i)
+        {
+            m_info["extracts"].append().set(staged_extracts.child(i));
+        }
+
         // add expression results to info
         const conduit::Node &expression_cache =
           runtime::expressions::ExpressionEval::get_cache();
@@ -18,7 +18,9 @@
 #include <ascent_exports.h>
 #include <ascent_runtime.hpp>
 #include <ascent_data_object.hpp>
+#include <ascent_performance_report.hpp>
 #include <ascent_web_interface.hpp>
+#include <png_utils/ascent_png_writer.hpp>
 #include <flow.hpp>
 
 
@@ -51,6 +53,15 @@ public:
 
     void DisplayError(const std::string &msg) override;
 
+    // Publishes data that another runtime already published and
+    // checked (used by triggers). The representations held by the
+    // data object are shared instead of being rebuilt, and they must
+    // stay alive until Execute returns.
+    void  PublishDataObject(DataObject &data_object);
+    // drops the data handed over by PublishDataObject, so a runtime
+    // kept between trigger firings does not hold on to old data
+    void  ReleasePublishedObject();
+
     template <class FilterType>
     static void register_filter_type(const std::string &role_path = "",
                                      const std::string &api_name  = "")
@@ -66,6 +77,12 @@ private:
     // DataObject that (externally) holds the data from the simulation
     conduit::Node     m_source;
     DataObject        m_data_object;
+    // set by PublishDataObject, used in place of m_source
+    DataObject        m_published_object;
+    bool              m_has_published_object;
+    // false for runtimes created by triggers, only the runtimes
+    // created by the simulation release process wide state
+    bool              m_top_level;
     conduit::Node     m_connections;
     conduit::Node     m_scene_connections;
 
@@ -85,8 +102,20 @@ private:
     bool              m_field_filtering;
     std::set<std::string> m_field_list;
 
+    // incremental execution: identities and revisions of
+    // the published coordsets, topologies, and fields
+    bool              m_incremental_execution;
+    std::map<std::string,std::string> m_source_identities;
+    std::map<std::string,int>         m_source_revisions;
+
     conduit::Node     m_comments;
 
+    // per cycle performance report (options["performance_report"])
+    PerformanceReport m_perf_report;
+
+    // images rendered by this runtime (options["async_image_writes"])
+    PNGWriteQueue     m_png_queue;
+
     void              ResetInfo();
     void              AddPublishedMeshInfo();
 
@@ -130,6 +159,7 @@ private:
     void BuildGraph(const conduit::Node &actions);
     void EnsureDomainIds();
     void PopulateMetadata();
+    void UpdateSourceRevisions();
 
     std::string GetDefaultImagePrefix(const std::string scene);
 
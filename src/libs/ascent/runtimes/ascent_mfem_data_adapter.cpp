@@ -20,6 +20,7 @@
 #include <limits.h>
 #include <cstdlib>
 #include <sstream>
+#include <set>
 
 // third party includes
 #include <conduit_blueprint.hpp>
@@ -272,6 +273,258 @@ MFEMDataAdapter::IsHighOrder(const conduit::Node &n)
 
   return false;
 }
+
+//-----------------------------------------------------------------------------
+// MFEMRefinementPlan methods
+//-----------------------------------------------------------------------------
+MFEMRefinementPlan::MFEMRefinementPlan(mfem::Mesh *ho_mesh, const int refinement)
+{
+  topology_identity(ho_mesh, refinement, m_identity, m_nodes_basis);
+  m_lo_mesh = new mfem::Mesh(mfem::Mesh::MakeRefined(*ho_mesh,
+                                                     refinement,
+                                                     mfem::BasisType::GaussLobatto));
+}
+
+MFEMRefinementPlan::~MFEMRefinementPlan()
+{
+  for(auto it = m_transfers.begin(); it != m_transfers.end(); ++it)
+  {
+    Transfer *transfer = it->second;
+    // the operator refers to the space
+    transfer->m_op.Clear();
+    if(transfer->m_owns_fes)
+    {
+      delete transfer->m_fes;
+    }
+    delete transfer->m_col;
+    delete transfer;
+  }
+  delete m_lo_mesh;
+}
+
+//-----------------------------------------------------------------------------
+// everything the refined topology depends on: the element and boundary
+// element connectivity, geometries and attributes, and the nodal space
+void
+MFEMRefinementPlan::topology_identity(mfem::Mesh *mesh,
+                                      const int refinement,
+                                      std::vector<int> &identity,
+                                      std::string &nodes_basis)
+{
+  identity.clear();
+  identity.push_back(refinement);
+  identity.push_back(mesh->Dimension());
+  identity.push_back(mesh->SpaceDimension());
+  identity.push_back(mesh->GetNV());
+  identity.push_back(mesh->GetNE());
+  identity.push_back(mesh->GetNBE());
+
+  for(int e = 0; e < mesh->GetNE(); ++e)
+  {
+    const mfem::Element *ele = mesh->GetElement(e);
+    const int *verts = ele->GetVertices();
+    identity.push_back(ele->GetGeometryType());
+    identity.push_back(ele->GetAttribute());
+    identity.insert(identity.end(), verts, verts + ele->GetNVertices());
+  }
+
+  for(int e = 0; e < mesh->GetNBE(); ++e)
+  {
+    const mfem::Element *ele = mesh->GetBdrElement(e);
+    const int *verts = ele->GetVertices();
+    identity.push_back(ele->GetGeometryType());
+    identity.push_back(ele->GetAttribute());
+    identity.insert(identity.end(), verts, verts + ele->GetNVertices());
+  }
+
+  nodes_basis = "";
+  const mfem::FiniteElementSpace *nodes_fes = mesh->GetNodalFESpace();
+  if(nodes_fes != nullptr)
+  {
+    nodes_basis = nodes_fes->FEColl()->Name();
+    identity.push_back(nodes_fes->GetOrdering());
+    identity.push_back(nodes_fes->GetVSize());
+  }
+}
+
+bool
+MFEMRefinementPlan::matches(mfem::Mesh *ho_mesh, const int refinement) const
+{
+  std::vector<int> identity;
+  std::string nodes_basis;
+  topology_identity(ho_mesh, refinement, identity, nodes_basis);
+  return nodes_basis == m_nodes_basis && identity == m_identity;
+}
+
+mfem::Mesh*
+MFEMRefinementPlan::lo_mesh()
+{
+  return m_lo_mesh;
+}
+
+MFEMRefinementPlan::Transfer*
+MFEMRefinementPlan::find_transfer(const std::string &key)
+{
+  auto it = m_transfers.find(key);
+  return it != m_transfers.end() ? it->second : nullptr;
+}
+
+MFEMRefinementPlan::Transfer*
+MFEMRefinementPlan::add_transfer(const std::string &key,
+                                 const mfem::FiniteElementSpace &ho_fes,
+                                 mfem::FiniteElementCollection *lo_col,
+                                 mfem::FiniteElementSpace *lo_fes,
+                                 const bool owns_fes)
+{
+  Transfer *transfer = new Transfer;
+  transfer->m_col = lo_col;
+  transfer->m_fes = lo_fes;
+  transfer->m_owns_fes = owns_fes;
+  // the operator holds the local interpolation matrices of each
+  // refined element, so later transfers are only a sparse mat-vec
+  lo_fes->GetTransferOperator(ho_fes, transfer->m_op);
+  m_transfers[key] = transfer;
+  return transfer;
+}
+
+//-----------------------------------------------------------------------------
+// MFEMRefinementCache methods
+//-----------------------------------------------------------------------------
+MFEMRefinementCache::MFEMRefinementCache()
+{
+
+}
+
+MFEMRefinementCache::~MFEMRefinementCache()
+{
+  clear();
+}
+
+MFEMRefinementPlan*
+MFEMRefinementCache::plan(const int domain_id,
+                          mfem::Mesh *ho_mesh,
+                          const int refinement,
+                          bool &reused)
+{
+  auto it = m_plans.find(domain_id);
+  if(it != m_plans.end())
+  {
+    if(it->second->matches(ho_mesh, refinement))
+    {
+      reused = true;
+      return it->second;
+    }
+    delete it->second;
+  }
+
+  reused = false;
+  MFEMRefinementPlan *plan = new MFEMRefinementPlan(ho_mesh, refinement);
+  m_plans[domain_id] = plan;
+  return plan;
+}
+
+void
+MFEMRefinementCache::retain(const std::vector<int> &domain_ids)
+{
+  std::set<int> keep(domain_ids.begin(), domain_ids.end());
+  for(auto it = m_plans.begin(); it != m_plans.end();)
+  {
+    if(keep.count(it->first) == 0)
+    {
+      delete it->second;
+      it = m_plans.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+void
+MFEMRefinementCache::clear()
+{
+  for(auto it = m_plans.begin(); it != m_plans.end(); ++it)
+  {
+    delete it->second;
+  }
+  m_plans.clear();
+}
+
+int
+MFEMRefinementCache::size() const
+{
+  return (int) m_plans.size();
+}
+
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// moves the vertices (and nodes) of a reused refined mesh to the
+// current high order geometry
+void
+update_refined_geometry(MFEMRefinementPlan *plan, mfem::Mesh *ho_mesh)
+{
+  // give linear meshes nodes that match their vertices
+  ho_mesh->EnsureNodes();
+  const mfem::GridFunction *ho_nodes = ho_mesh->GetNodes();
+  const mfem::FiniteElementSpace *ho_nodes_fes = ho_nodes->FESpace();
+
+  mfem::Mesh *lo_mesh = plan->lo_mesh();
+  const int sdim = lo_mesh->SpaceDimension();
+
+  std::ostringstream key;
+  key << ho_nodes_fes->FEColl()->Name() << ":" << ho_nodes_fes->GetOrdering()
+      << ":" << ho_nodes_fes->GetVSize();
+
+  // the linear space's dofs are the vertices of the refined mesh
+  MFEMRefinementPlan::Transfer *vert_transfer
+    = plan->find_transfer("vertices:" + key.str());
+  if(vert_transfer == nullptr)
+  {
+    mfem::FiniteElementCollection *col = new mfem::LinearFECollection;
+    mfem::FiniteElementSpace *fes
+      = new mfem::FiniteElementSpace(lo_mesh, col, sdim, ho_nodes_fes->GetOrdering());
+    vert_transfer = plan->add_transfer("vertices:" + key.str(),
+                                       *ho_nodes_fes,
+                                       col,
+                                       fes,
+                                       true);
+  }
+
+  mfem::GridFunction lo_verts(vert_transfer->m_fes);
+  vert_transfer->m_op.Ptr()->Mult(*ho_nodes, lo_verts);
+  const int num_verts = lo_mesh->GetNV();
+  for(int v = 0; v < num_verts; ++v)
+  {
+    double *vert = lo_mesh->GetVertex(v);
+    for(int d = 0; d < sdim; ++d)
+    {
+      vert[d] = lo_verts(vert_transfer->m_fes->DofToVDof(v, d));
+    }
+  }
+
+  // refined curved meshes keep linear nodes
+  mfem::GridFunction *lo_nodes = lo_mesh->GetNodes();
+  if(lo_nodes != nullptr)
+  {
+    MFEMRefinementPlan::Transfer *node_transfer
+      = plan->find_transfer("nodes:" + key.str());
+    if(node_transfer == nullptr)
+    {
+      node_transfer = plan->add_transfer("nodes:" + key.str(),
+                                         *ho_nodes_fes,
+                                         nullptr,
+                                         lo_nodes->FESpace(),
+                                         false);
+    }
+    node_transfer->m_op.Ptr()->Mult(*ho_nodes, *lo_nodes);
+  }
+}
+
+};
+
 //                                          VDim
 // +------------+--------------------+------------------+
 // | Space Type | FE Collection Type | Vector Dimension |
@@ -291,10 +544,20 @@ MFEMDataAdapter::IsHighOrder(const conduit::Node &n)
 // | ND         | NDColl             | 1                |
 // +------------+--------------------+------------------+
 void
-MFEMDataAdapter::Linearize(MFEMDomains *ho_domains, conduit::Node &output, const int refinement)
+MFEMDataAdapter::Linearize(MFEMDomains *ho_domains,
+                           conduit::Node &output,
+                           const int refinement,
+                           MFEMRefinementCache *cache)
 {
   const int n_doms = ho_domains->m_data_sets.size();
 
+  // without a cache, the plans only live for this call
+  MFEMRefinementCache local_cache;
+  if(cache == nullptr)
+  {
+    cache = &local_cache;
+  }
+
   output.reset();
   for(int i = 0; i < n_doms; ++i)
   {
@@ -306,14 +569,21 @@ MFEMDataAdapter::Linearize(MFEMDomains *ho_domains, conduit::Node &output, const
 
     // get the high order data
     mfem::Mesh *ho_mesh = ho_domains->m_data_sets[i]->get_mesh();
-    const mfem::FiniteElementSpace *ho_fes_space = ho_mesh->GetNodalFESpace();
-    const mfem::FiniteElementCollection *ho_fes_col = ho_fes_space->FEColl();
-    // refine the mesh and convert to blueprint
-    mfem::Mesh lo_mesh = mfem::Mesh::MakeRefined(*ho_mesh, refinement, mfem::BasisType::GaussLobatto);
 
-    MeshToBlueprintMesh(&lo_mesh, n_dset);
+    // refine the mesh (or reuse the refinement of the same topology)
+    bool reused = false;
+    MFEMRefinementPlan *plan = cache->plan(ho_domains->m_domain_ids[i],
+                                           ho_mesh,
+                                           refinement,
+                                           reused);
+    mfem::Mesh *lo_mesh = plan->lo_mesh();
+    if(reused)
+    {
+      detail::update_refined_geometry(plan, ho_mesh);
+    }
 
-    int conn_size = n_dset["topologies/main/elements/connectivity"].dtype().number_of_elements();
+    // convert to blueprint
+    MeshToBlueprintMesh(lo_mesh, n_dset);
 
     conduit::Node &n_fields = n_dset["fields"];
     auto field_map = ho_domains->m_data_sets[i]->get_field_map();
@@ -331,26 +601,37 @@ MFEMDataAdapter::Linearize(MFEMDomains *ho_domains, conduit::Node &output, const
       {
         ASCENT_ERROR("Linearize: high order gf finite element space is null")
       }
-      // create the low order grid function
-      mfem::FiniteElementCollection *lo_col = nullptr;
-      if(node_centered)
-      {
-        lo_col = new mfem::LinearFECollection;
-      }
-      else
+
+      // fields on the same space share the low order space and operator
+      std::ostringstream key;
+      key << "field:" << basis << ":" << ho_fes->GetVDim()
+          << ":" << ho_fes->GetOrdering() << ":" << ho_fes->GetVSize();
+
+      MFEMRefinementPlan::Transfer *transfer = plan->find_transfer(key.str());
+      if(transfer == nullptr)
       {
-        int  p = 0; // single scalar
-        lo_col = new mfem::L2_FECollection(p, ho_mesh->Dimension(), 1);
+        // create the low order space
+        mfem::FiniteElementCollection *lo_col = nullptr;
+        if(node_centered)
+        {
+          lo_col = new mfem::LinearFECollection;
+        }
+        else
+        {
+          int  p = 0; // single scalar
+          lo_col = new mfem::L2_FECollection(p, ho_mesh->Dimension(), 1);
+        }
+        mfem::FiniteElementSpace *lo_fes
+          = new mfem::FiniteElementSpace(lo_mesh, lo_col, ho_fes->GetVDim());
+        transfer = plan->add_transfer(key.str(), *ho_fes, lo_col, lo_fes, true);
       }
-      mfem::FiniteElementSpace *lo_fes = new mfem::FiniteElementSpace(&lo_mesh, lo_col, ho_fes->GetVDim());
-      mfem::GridFunction *lo_gf = new mfem::GridFunction(lo_fes);
-      // transform the higher order function to a low order function somehow
-      mfem::OperatorHandle hi_to_lo;
-      lo_fes->GetTransferOperator(*ho_fes, hi_to_lo);
-      hi_to_lo.Ptr()->Mult(*ho_gf, *lo_gf);
+
+      // transform the higher order function to a low order function
+      mfem::GridFunction lo_gf(transfer->m_fes);
+      transfer->m_op.Ptr()->Mult(*ho_gf, lo_gf);
       // extract field
       conduit::Node &n_field = n_fields[it->first];
-      GridFunctionToBlueprintField(lo_gf, n_field);
+      GridFunctionToBlueprintField(&lo_gf, n_field);
       // all supported grid functions coming out of mfem end up being associtated with vertices
       if(node_centered)
       {
@@ -360,10 +641,6 @@ MFEMDataAdapter::Linearize(MFEMDomains *ho_domains, conduit::Node &output, const
       {
         n_field["association"] = "element";
       }
-
-      delete lo_col;
-      delete lo_fes;
-      delete lo_gf;
     }
 
     conduit::Node info;
@@ -374,6 +651,8 @@ MFEMDataAdapter::Linearize(MFEMDomains *ho_domains, conduit::Node &output, const
       ASCENT_ERROR("Linearize: failed to build a blueprint conforming data set from mfem")
     }
   }
+
+  cache->retain(ho_domains->m_domain_ids);
   //output.schema().print();
 }
 
@@ -69,6 +69,75 @@ struct ASCENT_API MFEMDomains
     }
   }
 };
+//-----------------------------------------------------------------------------
+// Refined (low order) meshes of linearized domains and the operators that
+// transfer high order grid functions onto them. Both only depend on the
+// high order topology, so while it stays the same later linearizations
+// only re-interpolate the coordinates and the field values.
+//-----------------------------------------------------------------------------
+class ASCENT_API MFEMRefinementPlan
+{
+public:
+  // a space on the refined mesh and the operator that transfers
+  // grid functions from a high order space onto it
+  struct Transfer
+  {
+    mfem::FiniteElementCollection *m_col;
+    mfem::FiniteElementSpace      *m_fes;
+    bool                           m_owns_fes;
+    mfem::OperatorHandle           m_op;
+  };
+
+  MFEMRefinementPlan(mfem::Mesh *ho_mesh, const int refinement);
+  ~MFEMRefinementPlan();
+
+  // true if the plan was built from a mesh with the same topology
+  bool matches(mfem::Mesh *ho_mesh, const int refinement) const;
+
+  mfem::Mesh* lo_mesh();
+
+  // returns nullptr if there is no transfer for the key
+  Transfer* find_transfer(const std::string &key);
+  // builds the operator from ho_fes to lo_fes. The plan owns lo_col
+  // (which can be null) and, if owns_fes is set, lo_fes
+  Transfer* add_transfer(const std::string &key,
+                         const mfem::FiniteElementSpace &ho_fes,
+                         mfem::FiniteElementCollection *lo_col,
+                         mfem::FiniteElementSpace *lo_fes,
+                         const bool owns_fes);
+private:
+  static void topology_identity(mfem::Mesh *mesh,
+                                const int refinement,
+                                std::vector<int> &identity,
+                                std::string &nodes_basis);
+
+  std::vector<int>                 m_identity;
+  std::string                      m_nodes_basis;
+  mfem::Mesh                      *m_lo_mesh;
+  std::map<std::string, Transfer*> m_transfers;
+};
+
+// refinement plans keyed by domain id
+class ASCENT_API MFEMRefinementCache
+{
+public:
+  MFEMRefinementCache();
+  ~MFEMRefinementCache();
+
+  // returns a plan for the domain, reused is set when the cached
+  // plan matched the mesh
+  MFEMRefinementPlan* plan(const int domain_id,
+                           mfem::Mesh *ho_mesh,
+                           const int refinement,
+                           bool &reused);
+  // drops the plans of domains that are not in domain_ids
+  void retain(const std::vector<int> &domain_ids);
+  void clear();
+  int size() const;
+private:
+  std::map<int, MFEMRefinementPlan*> m_plans;
+};
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 // Class that Handles Blueprint to mfem
@@ -89,7 +158,12 @@ public:
 
     static bool IsHighOrder(const conduit::Node &n);
 
-    static void Linearize(MFEMDomains *ho_domains, conduit::Node &output, const int refinement);
+    // when a cache is passed, refined meshes and transfer operators
+    // are reused for domains whose topology did not change
+    static void Linearize(MFEMDomains *ho_domains,
+                          conduit::Node &output,
+                          const int refinement,
+                          MFEMRefinementCache *cache = nullptr);
 
     static void GridFunctionToBlueprintField(mfem::GridFunction *gf,
                                             conduit::Node &out,
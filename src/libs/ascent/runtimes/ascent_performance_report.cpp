@@ -0,0 +1,360 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_performance_report.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_performance_report.hpp"
+
+#include <ascent_data_object.hpp>
+#include <ascent_mpi_utils.hpp>
+#include "expressions/ascent_memory_manager.hpp"
+
+#if defined(ASCENT_VTKM_ENABLED)
+#include "ascent_vtkh_data_adapter.hpp"
+#endif
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#ifdef ASCENT_MPI_ENABLED
+#include <mpi.h>
+#include <conduit_relay_mpi.hpp>
+#endif
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// the numeric metrics of a filter record
+//-----------------------------------------------------------------------------
+void
+record_metrics(const Node &record, std::vector<std::string> &metrics)
+{
+  NodeConstIterator itr = record.children();
+  while(itr.has_next())
+  {
+    const Node &metric = itr.next();
+    if(metric.dtype().is_number() && itr.name() != "cached")
+    {
+      metrics.push_back(itr.name());
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// describes the values being reduced: (filter, metric) pairs, with
+// the filter "" used for the execute totals
+//-----------------------------------------------------------------------------
+void
+report_layout(const Node &record, Node &layout)
+{
+  layout.reset();
+  if(record.has_child("filters"))
+  {
+    const Node &filters = record["filters"];
+    const int num_filters = filters.number_of_children();
+    for(int i = 0; i < num_filters; ++i)
+    {
+      std::vector<std::string> metrics;
+      record_metrics(filters.child(i), metrics);
+      for(size_t m = 0; m < metrics.size(); ++m)
+      {
+        Node &entry = layout.append();
+        entry["filter"] = filters.child(i).name();
+        entry["type"] = filters.child(i).has_child("type") ?
+                          filters.child(i)["type"].as_string() : "";
+        entry["metric"] = metrics[m];
+      }
+    }
+  }
+
+  if(record.has_child("total"))
+  {
+    std::vector<std::string> metrics;
+    record_metrics(record["total"], metrics);
+    for(size_t m = 0; m < metrics.size(); ++m)
+    {
+      Node &entry = layout.append();
+      entry["filter"] = "";
+      entry["type"] = "";
+      entry["metric"] = metrics[m];
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+double
+record_value(const Node &record, const Node &entry)
+{
+  const std::string filter = entry["filter"].as_string();
+  const std::string metric = entry["metric"].as_string();
+  const Node *parent = NULL;
+  if(filter == "")
+  {
+    if(record.has_child("total"))
+    {
+      parent = &record["total"];
+    }
+  }
+  else if(record.has_child("filters") &&
+          record["filters"].has_child(filter))
+  {
+    parent = &record["filters"].child(filter);
+  }
+
+  if(parent == NULL || !parent->has_child(metric))
+  {
+    return 0.0;
+  }
+  return parent->child(metric).to_float64();
+}
+
+//-----------------------------------------------------------------------------
+struct ValueRank
+{
+  double value;
+  int    rank;
+};
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+PerformanceReport::PerformanceReport()
+{
+  sample(m_execute_start);
+}
+
+//-----------------------------------------------------------------------------
+PerformanceReport::~PerformanceReport()
+{
+  m_trace.flush();
+}
+
+//-----------------------------------------------------------------------------
+void
+PerformanceReport::sample(Counters &counters)
+{
+  counters.m_host_bytes   = (double) HostMemory::total_bytes_allocated();
+  counters.m_device_bytes = (double) DeviceMemory::total_bytes_allocated();
+  counters.m_mpi_wait     = mpi_wait_time();
+  counters.m_conversion   = DataObject::conversion_time();
+  long long cell_sets = 0;
+  long long coordsets = 0;
+#if defined(ASCENT_VTKM_ENABLED)
+  VTKHDataAdapter::TopologyCacheReuse(cell_sets, coordsets);
+#endif
+  counters.m_reused_cell_sets = (double) cell_sets;
+  counters.m_reused_coordsets = (double) coordsets;
+}
+
+//-----------------------------------------------------------------------------
+void
+PerformanceReport::add_deltas(const Counters &start, Node &record)
+{
+  Counters now;
+  sample(now);
+  record["host_bytes_allocated"] = now.m_host_bytes - start.m_host_bytes;
+  record["host_peak_bytes"] = (double) HostMemory::peak_bytes();
+  record["device_bytes_allocated"] = now.m_device_bytes - start.m_device_bytes;
+  record["device_peak_bytes"] = (double) DeviceMemory::peak_bytes();
+  record["mpi_wait_time"] = now.m_mpi_wait - start.m_mpi_wait;
+  record["conversion_time"] = now.m_conversion - start.m_conversion;
+  record["reused_cell_sets"] = now.m_reused_cell_sets - start.m_reused_cell_sets;
+  record["reused_coordsets"] = now.m_reused_coordsets - start.m_reused_coordsets;
+}
+
+//-----------------------------------------------------------------------------
+void
+PerformanceReport::begin(const flow::Filter &f)
+{
+  Counters start;
+  sample(start);
+  HostMemory::reset_peak_bytes();
+  DeviceMemory::reset_peak_bytes();
+  std::lock_guard<std::mutex> lock(m_lock);
+  m_started[f.name()] = start;
+}
+
+//-----------------------------------------------------------------------------
+void
+PerformanceReport::end(const flow::Filter &f, Node &record)
+{
+  Counters start;
+  {
+    std::lock_guard<std::mutex> lock(m_lock);
+    std::map<std::string, Counters>::iterator itr = m_started.find(f.name());
+    if(itr == m_started.end())
+    {
+      return;
+    }
+    start = itr->second;
+    m_started.erase(itr);
+  }
+  add_deltas(start, record);
+}
+
+//-----------------------------------------------------------------------------
+void
+PerformanceReport::begin_execute()
+{
+  sample(m_execute_start);
+  HostMemory::reset_peak_bytes();
+  DeviceMemory::reset_peak_bytes();
+}
+
+//-----------------------------------------------------------------------------
+void
+PerformanceReport::end_execute(Node &record)
+{
+  // filters reset the peaks, so the execute's peak is the
+  // largest of the filter peaks
+  add_deltas(m_execute_start, record["total"]);
+  if(record.has_child("filters"))
+  {
+    const Node &filters = record["filters"];
+    const int num_filters = filters.number_of_children();
+    double host_peak = record["total/host_peak_bytes"].to_float64();
+    double device_peak = record["total/device_peak_bytes"].to_float64();
+    for(int i = 0; i < num_filters; ++i)
+    {
+      const Node &filter = filters.child(i);
+      if(filter.has_child("host_peak_bytes"))
+      {
+        host_peak = std::max(host_peak, filter["host_peak_bytes"].to_float64());
+      }
+      if(filter.has_child("device_peak_bytes"))
+      {
+        device_peak = std::max(device_peak, filter["device_peak_bytes"].to_float64());
+      }
+    }
+    record["total/host_peak_bytes"] = host_peak;
+    record["total/device_peak_bytes"] = device_peak;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+PerformanceReport::aggregate(const Node &record, int cycle, Node &report)
+{
+  report.reset();
+
+  // all ranks reduce the same values in the same order,
+  // so use rank 0's layout
+  Node layout;
+  detail::report_layout(record, layout);
+  int num_ranks = 1;
+  int rank = 0;
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+  MPI_Comm_size(mpi_comm, &num_ranks);
+  MPI_Comm_rank(mpi_comm, &rank);
+  relay::mpi::broadcast_using_schema(layout, 0, mpi_comm);
+#endif
+
+  const int num_values = layout.number_of_children();
+  std::vector<double> mins(num_values);
+  std::vector<double> sums(num_values);
+  std::vector<detail::ValueRank> maxs(num_values);
+  for(int i = 0; i < num_values; ++i)
+  {
+    const double value = detail::record_value(record, layout.child(i));
+    mins[i] = value;
+    sums[i] = value;
+    maxs[i].value = value;
+    maxs[i].rank = rank;
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  if(num_values > 0)
+  {
+    MPI_Allreduce(MPI_IN_PLACE, mins.data(), num_values,
+                  MPI_DOUBLE, MPI_MIN, mpi_comm);
+    MPI_Allreduce(MPI_IN_PLACE, sums.data(), num_values,
+                  MPI_DOUBLE, MPI_SUM, mpi_comm);
+    MPI_Allreduce(MPI_IN_PLACE, maxs.data(), num_values,
+                  MPI_DOUBLE_INT, MPI_MAXLOC, mpi_comm);
+  }
+#endif
+
+  report["cycle"] = cycle;
+  report["ranks"] = num_ranks;
+  report["filters"].set(DataType::object());
+  for(int i = 0; i < num_values; ++i)
+  {
+    const Node &entry = layout.child(i);
+    const std::string filter = entry["filter"].as_string();
+    Node *parent = NULL;
+    if(filter == "")
+    {
+      parent = &report["total"];
+    }
+    else
+    {
+      Node &filters = report["filters"];
+      if(!filters.has_child(filter))
+      {
+        filters.add_child(filter)["type"] = entry["type"].as_string();
+      }
+      parent = &filters.child(filter);
+    }
+
+    const double avg = sums[i] / num_ranks;
+    Node &stats = parent->add_child(entry["metric"].as_string());
+    stats["min"] = mins[i];
+    stats["max"] = maxs[i].value;
+    stats["avg"] = avg;
+    stats["imbalance"] = avg > 0.0 ? maxs[i].value / avg : 1.0;
+    stats["max_rank"] = maxs[i].rank;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+PerformanceReport::trace(const std::string &file_name, const Node &report)
+{
+  if(mpi_rank() != 0)
+  {
+    return;
+  }
+
+  if(m_trace.file_name() != file_name)
+  {
+    m_trace.flush();
+    m_trace.file_name(file_name);
+  }
+
+  std::stringstream path;
+  path << "performance/" << report["cycle"].to_int32();
+  m_trace.append(path.str(), report);
+  m_trace.flush();
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_performance_report.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef ASCENT_PERFORMANCE_REPORT_HPP
+#define ASCENT_PERFORMANCE_REPORT_HPP
+
+#include <conduit.hpp>
+#include <ascent_exports.h>
+#include <flow.hpp>
+
+#include "expressions/ascent_expression_history.hpp"
+
+#include <map>
+#include <mutex>
+#include <string>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// Builds the per cycle performance report.
+//
+// As a flow probe it adds these metrics to each filter's record:
+//   host_bytes_allocated, host_peak_bytes,
+//   device_bytes_allocated, device_peak_bytes,
+//   mpi_wait_time   (time in ascent's collectives, see MPIWaitTimer)
+//   conversion_time (time in DataObject::as_* conversions)
+//   reused_cell_sets, reused_coordsets
+//                   (VTK-h conversions that reused a cached topology)
+//
+// aggregate() reduces the workspace record across ranks. Each metric
+// is reported as min, max, avg, the rank with the max, and the
+// imbalance (max / avg, 1 is perfectly balanced).
+//
+// The counters are per process, so with parallel execution the metrics
+// of filters that run at the same time include each other's work. The
+// runtime only counts allocations (see MemoryTracking) while the report
+// is on.
+//-----------------------------------------------------------------------------
+class ASCENT_API PerformanceReport : public flow::Workspace::PerformanceProbe
+{
+public:
+  PerformanceReport();
+  virtual ~PerformanceReport();
+
+  virtual void begin(const flow::Filter &f) override;
+  virtual void end(const flow::Filter &f, conduit::Node &record) override;
+
+  // snapshots the counters for the totals of an execute
+  void begin_execute();
+  // adds the totals of the execute to record["total"]
+  void end_execute(conduit::Node &record);
+
+  // reduces a workspace record across ranks (collective)
+  static void aggregate(const conduit::Node &record,
+                        int cycle,
+                        conduit::Node &report);
+
+  // appends the report to a binary trace file (see HistoryStore),
+  // only rank 0 writes
+  void trace(const std::string &file_name, const conduit::Node &report);
+
+private:
+  struct Counters
+  {
+    double m_host_bytes;
+    double m_device_bytes;
+    double m_mpi_wait;
+    double m_conversion;
+    double m_reused_cell_sets;
+    double m_reused_coordsets;
+  };
+
+  static void sample(Counters &counters);
+  static void add_deltas(const Counters &start, conduit::Node &record);
+
+  std::mutex                      m_lock;
+  std::map<std::string, Counters> m_started;
+  Counters                        m_execute_start;
+  runtime::expressions::HistoryStore m_trace;
+};
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
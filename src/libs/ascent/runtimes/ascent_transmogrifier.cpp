@@ -19,6 +19,12 @@
 #include "ascent_logging.hpp"
 #include <conduit_blueprint.hpp>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
 
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -28,6 +34,502 @@ namespace ascent
 
 int Transmogrifier::m_refinement_level = 3;
 
+#if defined(ASCENT_MFEM_ENABLED)
+namespace detail
+{
+// refinements of the high order topologies seen so far, so
+// later cycles only re-interpolate coordinates and fields
+MFEMRefinementCache &refinement_cache()
+{
+  static MFEMRefinementCache cache;
+  return cache;
+}
+};
+#endif
+
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// side decompositions of polyhedral/polygonal topologies, keyed by
+// domain id and topology name. Entries are never changed once cached,
+// so the data objects that reference them can zero copy.
+//
+// entry layout:
+//   source/{topology,coordset}  compact copies of what was decomposed
+//   topologies/name             the sides
+//   coordsets/name              source points, then the added centers
+//   num_src_points
+//   side_elements               source element of each side (optional)
+//   center_map/{offsets,ids}    source points around each added center
+//                               (optional)
+struct PolySidesCache
+{
+  std::mutex m_lock;
+  std::map<std::string, std::shared_ptr<conduit::Node>> m_sides;
+};
+
+PolySidesCache &poly_sides_cache()
+{
+  static PolySidesCache cache;
+  return cache;
+}
+
+std::shared_ptr<conduit::Node> cached_sides(const std::string &key)
+{
+  PolySidesCache &cache = poly_sides_cache();
+  std::lock_guard<std::mutex> lock(cache.m_lock);
+  auto it = cache.m_sides.find(key);
+  return it != cache.m_sides.end() ? it->second : nullptr;
+}
+
+void cache_sides(const std::string &key, std::shared_ptr<conduit::Node> entry)
+{
+  PolySidesCache &cache = poly_sides_cache();
+  std::lock_guard<std::mutex> lock(cache.m_lock);
+  cache.m_sides[key] = entry;
+}
+
+//-----------------------------------------------------------------------------
+// true if a and b have the same structure and the same bytes in every leaf
+bool same_data(const conduit::Node &a, const conduit::Node &b)
+{
+  const int num_children = a.number_of_children();
+  if(num_children != b.number_of_children())
+  {
+    return false;
+  }
+
+  if(num_children == 0)
+  {
+    const conduit::DataType &a_dtype = a.dtype();
+    const conduit::DataType &b_dtype = b.dtype();
+    if(a_dtype.id() != b_dtype.id() ||
+       a_dtype.number_of_elements() != b_dtype.number_of_elements())
+    {
+      return false;
+    }
+    if(a_dtype.is_empty() || a_dtype.number_of_elements() == 0)
+    {
+      return true;
+    }
+
+    conduit::Node a_compact, b_compact;
+    const conduit::Node *a_ptr = &a;
+    const conduit::Node *b_ptr = &b;
+    if(!a_dtype.is_compact())
+    {
+      a.compact_to(a_compact);
+      a_ptr = &a_compact;
+    }
+    if(!b_dtype.is_compact())
+    {
+      b.compact_to(b_compact);
+      b_ptr = &b_compact;
+    }
+    return std::memcmp(a_ptr->element_ptr(0),
+                       b_ptr->element_ptr(0),
+                       a_dtype.bytes_compact()) == 0;
+  }
+
+  for(int i = 0; i < num_children; ++i)
+  {
+    if(a.child(i).name() != b.child(i).name() ||
+       !same_data(a.child(i), b.child(i)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+conduit::index_t num_values(const conduit::Node &values)
+{
+  if(values.number_of_children() == 0)
+  {
+    return values.dtype().number_of_elements();
+  }
+  return values.child(0).dtype().number_of_elements();
+}
+
+//-----------------------------------------------------------------------------
+// true if every component of the values is float32 or float64
+bool float_values(const conduit::Node &values)
+{
+  if(values.number_of_children() == 0)
+  {
+    return values.dtype().is_float32() || values.dtype().is_float64();
+  }
+  for(int i = 0; i < values.number_of_children(); ++i)
+  {
+    if(!float_values(values.child(i)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void gather_component(conduit::DataArray<T> src,
+                      const conduit::Node &side_elements,
+                      conduit::DataArray<T> dest)
+{
+  const conduit::int64 *elems = side_elements.as_int64_ptr();
+  const conduit::index_t size = dest.number_of_elements();
+  for(conduit::index_t s = 0; s < size; ++s)
+  {
+    dest[s] = src[elems[s]];
+  }
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void average_component(conduit::DataArray<T> src,
+                       const conduit::Node &center_map,
+                       conduit::DataArray<T> dest)
+{
+  const conduit::int64 *offsets = center_map["offsets"].as_int64_ptr();
+  const conduit::int64 *ids = center_map["ids"].as_int64_ptr();
+  const conduit::index_t num_src = src.number_of_elements();
+  const conduit::index_t num_centers
+    = center_map["offsets"].dtype().number_of_elements() - 1;
+
+  for(conduit::index_t i = 0; i < num_src; ++i)
+  {
+    dest[i] = src[i];
+  }
+
+  for(conduit::index_t c = 0; c < num_centers; ++c)
+  {
+    double sum = 0.;
+    for(conduit::int64 k = offsets[c]; k < offsets[c + 1]; ++k)
+    {
+      sum += src[ids[k]];
+    }
+    const conduit::int64 count = offsets[c + 1] - offsets[c];
+    dest[num_src + c] = count > 0 ? T(sum / double(count)) : T(0);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// maps source values onto the sides: element values are gathered from
+// the source element of each side, vertex values are copied for the
+// source points and averaged for the added centers
+void remap_values(const conduit::Node &src,
+                  const conduit::Node &entry,
+                  const bool vertex,
+                  conduit::Node &dest)
+{
+  if(src.number_of_children() != 0)
+  {
+    for(int i = 0; i < src.number_of_children(); ++i)
+    {
+      remap_values(src.child(i), entry, vertex, dest[src.child(i).name()]);
+    }
+    return;
+  }
+
+  const conduit::index_t size = vertex
+    ? entry["num_src_points"].to_int64()
+      + entry["center_map/offsets"].dtype().number_of_elements() - 1
+    : entry["side_elements"].dtype().number_of_elements();
+
+  if(src.dtype().is_float32())
+  {
+    dest.set(conduit::DataType::float32(size));
+    if(vertex)
+    {
+      average_component(src.as_float32_array(),
+                        entry["center_map"],
+                        dest.as_float32_array());
+    }
+    else
+    {
+      gather_component(src.as_float32_array(),
+                       entry["side_elements"],
+                       dest.as_float32_array());
+    }
+  }
+  else
+  {
+    dest.set(conduit::DataType::float64(size));
+    if(vertex)
+    {
+      average_component(src.as_float64_array(),
+                        entry["center_map"],
+                        dest.as_float64_array());
+    }
+    else
+    {
+      gather_component(src.as_float64_array(),
+                       entry["side_elements"],
+                       dest.as_float64_array());
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// true if a and b hold the same values up to float32 round off
+bool close_values(const conduit::Node &a, const conduit::Node &b)
+{
+  const int num_children = a.number_of_children();
+  if(num_children != b.number_of_children())
+  {
+    return false;
+  }
+  if(num_children != 0)
+  {
+    for(int i = 0; i < num_children; ++i)
+    {
+      if(!close_values(a.child(i), b.child(i)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  if(a.dtype().is_empty() || b.dtype().is_empty() ||
+     a.dtype().number_of_elements() != b.dtype().number_of_elements())
+  {
+    return false;
+  }
+
+  conduit::Node a_vals, b_vals;
+  a.to_float64_array(a_vals);
+  b.to_float64_array(b_vals);
+  const conduit::float64 *a_ptr = a_vals.as_float64_ptr();
+  const conduit::float64 *b_ptr = b_vals.as_float64_ptr();
+  const conduit::index_t size = a_vals.dtype().number_of_elements();
+  for(conduit::index_t i = 0; i < size; ++i)
+  {
+    const double scale = 1. + std::max(std::abs(a_ptr[i]), std::abs(b_ptr[i]));
+    if(std::abs(a_ptr[i] - b_ptr[i]) > 1e-5 * scale)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+// the source points in the sides around each added center (face and
+// element centers), which are the points the center averages
+void build_center_map(const conduit::Node &sides_topo,
+                      const conduit::index_t num_src_points,
+                      const conduit::index_t num_points,
+                      conduit::Node &center_map)
+{
+  const int side_size = sides_topo["elements/shape"].as_string() == "tet" ? 4 : 3;
+  conduit::Node n_conn;
+  sides_topo["elements/connectivity"].to_int64_array(n_conn);
+  const conduit::int64 *conn = n_conn.as_int64_ptr();
+  const conduit::index_t conn_size = n_conn.dtype().number_of_elements();
+
+  const conduit::index_t num_centers = num_points - num_src_points;
+  std::vector<std::set<conduit::int64>> around(num_centers);
+  for(conduit::index_t side = 0; side + side_size <= conn_size; side += side_size)
+  {
+    for(int c = 0; c < side_size; ++c)
+    {
+      const conduit::int64 center = conn[side + c];
+      if(center < num_src_points)
+      {
+        continue;
+      }
+      for(int p = 0; p < side_size; ++p)
+      {
+        if(conn[side + p] < num_src_points)
+        {
+          around[center - num_src_points].insert(conn[side + p]);
+        }
+      }
+    }
+  }
+
+  conduit::index_t num_ids = 0;
+  for(conduit::index_t c = 0; c < num_centers; ++c)
+  {
+    num_ids += around[c].size();
+  }
+
+  center_map["offsets"].set(conduit::DataType::int64(num_centers + 1));
+  center_map["ids"].set(conduit::DataType::int64(num_ids));
+  conduit::int64 *offsets = center_map["offsets"].as_int64_ptr();
+  conduit::int64 *ids = center_map["ids"].as_int64_ptr();
+  offsets[0] = 0;
+  for(conduit::index_t c = 0; c < num_centers; ++c)
+  {
+    conduit::int64 offset = offsets[c];
+    for(const conduit::int64 id : around[c])
+    {
+      ids[offset++] = id;
+    }
+    offsets[c + 1] = offset;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool volume_dependent(const conduit::Node &field)
+{
+  return field.has_child("volume_dependent") &&
+         field["volume_dependent"].as_string() == "true";
+}
+
+//-----------------------------------------------------------------------------
+// decomposes the topology with conduit (mapping its fields into fields)
+// and keeps the maps that reproduce it for the coordinates and fields
+// of later cycles
+std::shared_ptr<conduit::Node> build_sides(const conduit::Node &dom,
+                                           const std::string &topo_name,
+                                           conduit::Node &fields)
+{
+  std::shared_ptr<conduit::Node> entry = std::make_shared<conduit::Node>();
+  const conduit::Node &src_topo = dom["topologies/" + topo_name];
+  const std::string coordset = src_topo["coordset"].as_string();
+  const conduit::Node &src_coords = dom["coordsets/" + coordset];
+
+  src_topo.compact_to((*entry)["source/topology"]);
+  src_coords.compact_to((*entry)["source/coordset"]);
+
+  conduit::Node s2dmap, d2smap, options;
+  conduit::Node &sides_topo = (*entry)["topologies/" + topo_name];
+  conduit::Node &sides_coords = (*entry)["coordsets/" + coordset];
+  conduit::blueprint::mesh::topology::unstructured::generate_sides(
+    src_topo,
+    sides_topo,
+    sides_coords,
+    fields,
+    s2dmap,
+    d2smap,
+    options);
+
+  const conduit::index_t num_src_points = num_values(src_coords["values"]);
+  const conduit::index_t num_points = num_values(sides_coords["values"]);
+  (*entry)["num_src_points"] = (conduit::int64) num_src_points;
+
+  // keep each map only if it reproduces what conduit did
+  const int side_size = sides_topo["elements/shape"].as_string() == "tet" ? 4 : 3;
+  const conduit::index_t num_sides
+    = sides_topo["elements/connectivity"].dtype().number_of_elements() / side_size;
+  if(d2smap.has_child("values") &&
+     d2smap["values"].dtype().number_of_elements() == num_sides)
+  {
+    d2smap["values"].to_int64_array((*entry)["side_elements"]);
+  }
+  if(num_points >= num_src_points && float_values(src_coords["values"]))
+  {
+    build_center_map(sides_topo, num_src_points, num_points, (*entry)["center_map"]);
+    conduit::Node check;
+    remap_values(src_coords["values"], *entry, true, check);
+    if(!close_values(check, sides_coords["values"]))
+    {
+      entry->remove("center_map");
+    }
+  }
+
+  conduit::NodeConstIterator itr = fields.children();
+  while(itr.has_next())
+  {
+    const conduit::Node &field = itr.next();
+    const std::string field_name = itr.name();
+    if(!dom["fields"].has_child(field_name))
+    {
+      continue;
+    }
+    const conduit::Node &src_field = dom["fields/" + field_name];
+    if(!field.has_child("values") || !float_values(src_field["values"]) ||
+       volume_dependent(src_field))
+    {
+      continue;
+    }
+
+    const std::string assoc = src_field["association"].as_string();
+    const bool vertex = assoc == "vertex";
+    const std::string map_name = vertex ? "center_map" : "side_elements";
+    if(!entry->has_child(map_name))
+    {
+      continue;
+    }
+
+    conduit::Node check;
+    remap_values(src_field["values"], *entry, vertex, check);
+    if(!close_values(check, field["values"]))
+    {
+      entry->remove(map_name);
+    }
+  }
+
+  return entry;
+}
+
+//-----------------------------------------------------------------------------
+// a copy of entry with the sides moved to new source points, or nullptr
+// if the added centers can not be recomputed from the cached maps
+std::shared_ptr<conduit::Node> move_sides(const conduit::Node &entry,
+                                          const conduit::Node &src_coords)
+{
+  if(!entry.has_child("center_map") ||
+     !src_coords.has_child("values") ||
+     !float_values(src_coords["values"]) ||
+     num_values(src_coords["values"]) != entry["num_src_points"].to_int64() ||
+     !same_data(src_coords["type"], entry["source/coordset/type"]))
+  {
+    return nullptr;
+  }
+
+  // cached entries are shared with the data objects of earlier
+  // conversions, so copy rather than change them
+  std::shared_ptr<conduit::Node> moved = std::make_shared<conduit::Node>(entry);
+  (*moved)["source/coordset"].reset();
+  src_coords.compact_to((*moved)["source/coordset"]);
+
+  conduit::Node &values = (*moved)["coordsets"].child(0)["values"];
+  values.reset();
+  remap_values(src_coords["values"], *moved, true, values);
+  return moved;
+}
+
+//-----------------------------------------------------------------------------
+// maps a field of the source topology onto the cached sides, false if
+// the cached maps can not express it
+bool remap_field(const conduit::Node &field,
+                 const conduit::Node &entry,
+                 conduit::Node &dest)
+{
+  if(!field.has_child("association") || !field.has_child("values") ||
+     volume_dependent(field) || !float_values(field["values"]))
+  {
+    return false;
+  }
+
+  const std::string assoc = field["association"].as_string();
+  const bool vertex = assoc == "vertex";
+  if((vertex && !entry.has_child("center_map")) ||
+     (assoc == "element" && !entry.has_child("side_elements")) ||
+     (!vertex && assoc != "element"))
+  {
+    return false;
+  }
+
+  conduit::NodeConstIterator itr = field.children();
+  while(itr.has_next())
+  {
+    const conduit::Node &child = itr.next();
+    if(itr.name() != "values")
+    {
+      dest[itr.name()].set(child);
+    }
+  }
+  remap_values(field["values"], entry, vertex, dest["values"]);
+  return true;
+}
+
+};
+
 bool Transmogrifier::is_high_order(const conduit::Node &doms)
 {
   // treat everything as a multi-domain data set
@@ -60,7 +562,10 @@ conduit::Node* Transmogrifier::low_order(conduit::Node &dataset)
 #if defined(ASCENT_MFEM_ENABLED)
   MFEMDomains *domains = MFEMDataAdapter::BlueprintToMFEMDataSet(dataset);
   conduit::Node *lo_dset = new conduit::Node;
-  MFEMDataAdapter::Linearize(domains, *lo_dset, m_refinement_level);
+  MFEMDataAdapter::Linearize(domains,
+                             *lo_dset,
+                             m_refinement_level,
+                             &detail::refinement_cache());
   delete domains;
 
   // add a second registry entry for the output so it can be zero copied.
@@ -71,6 +576,13 @@ conduit::Node* Transmogrifier::low_order(conduit::Node &dataset)
 #endif
 }
 
+void Transmogrifier::clear_low_order_cache()
+{
+#if defined(ASCENT_MFEM_ENABLED)
+  detail::refinement_cache().clear();
+#endif
+}
+
 bool Transmogrifier::is_poly(const conduit::Node &doms)
 {
   const int num_domains = doms.number_of_children();
@@ -100,7 +612,9 @@ bool Transmogrifier::is_poly(const conduit::Node &doms)
 }
 
 // to_poly assumes that the node n is polyhedral
-void Transmogrifier::to_poly(conduit::Node &doms, conduit::Node &to_vtkh)
+void Transmogrifier::to_poly(conduit::Node &doms,
+                             conduit::Node &to_vtkh,
+                             std::vector<std::shared_ptr<conduit::Node>> &sides)
 {
   const int num_domains = doms.number_of_children();
 
@@ -130,23 +644,126 @@ void Transmogrifier::to_poly(conduit::Node &doms, conduit::Node &to_vtkh)
 
     res.set_external(dom);
 
-    std::vector<std::string> coordsets;
-    for (int i = 0; i < poly_topos.size(); i ++)
+    std::ostringstream dom_key;
+    if(dom.has_path("state/domain_id"))
     {
-      conduit::Node s2dmap, d2smap, options;
-      coordsets.push_back(dom["topologies/" + poly_topos[i] + "/coordset"].as_string());
-      conduit::blueprint::mesh::topology::unstructured::generate_sides(
-        dom["topologies/" + poly_topos[i]],
-        res["topologies/" + poly_topos[i]],
-        res["coordsets/" + coordsets[coordsets.size() - 1]],
-        res["fields"],
-        s2dmap,
-        d2smap,
-        options);
+      dom_key << dom["state/domain_id"].to_int64();
+    }
+    else
+    {
+      dom_key << i;
+    }
+
+    for (int t = 0; t < poly_topos.size(); t ++)
+    {
+      const std::string &topo_name = poly_topos[t];
+      const conduit::Node &src_topo = dom["topologies/" + topo_name];
+      const std::string coordset = src_topo["coordset"].as_string();
+      const conduit::Node &src_coords = dom["coordsets/" + coordset];
+      const std::string key = dom_key.str() + "/" + topo_name;
+
+      std::shared_ptr<conduit::Node> entry = detail::cached_sides(key);
+      // fields conduit mapped while building the entry
+      conduit::Node built_fields;
+      bool built = false;
+
+      if(entry == nullptr ||
+         !detail::same_data(src_topo, (*entry)["source/topology"]))
+      {
+        entry = detail::build_sides(dom, topo_name, built_fields);
+        built = true;
+      }
+      else if(!detail::same_data(src_coords, (*entry)["source/coordset"]))
+      {
+        // the points moved, but the sides are the same
+        std::shared_ptr<conduit::Node> moved = detail::move_sides(*entry, src_coords);
+        if(moved != nullptr)
+        {
+          entry = moved;
+        }
+        else
+        {
+          entry = detail::build_sides(dom, topo_name, built_fields);
+          built = true;
+        }
+      }
+      detail::cache_sides(key, entry);
+      sides.push_back(entry);
+
+      res["topologies/" + topo_name].set_external((*entry)["topologies/" + topo_name]);
+      res["coordsets/" + coordset].set_external((*entry)["coordsets/" + coordset]);
+
+      // the fields of the source topology go through the cached maps,
+      // the ones they cannot express through conduit
+      std::vector<std::string> conduit_fields;
+      if(dom.has_child("fields"))
+      {
+        conduit::NodeConstIterator f_itr = dom["fields"].children();
+        while(f_itr.has_next())
+        {
+          const conduit::Node &field = f_itr.next();
+          const std::string field_name = f_itr.name();
+          if(!field.has_child("topology") ||
+             field["topology"].as_string() != topo_name)
+          {
+            continue;
+          }
+
+          // the external source field must not be written to
+          if(built)
+          {
+            if(built_fields.has_child(field_name))
+            {
+              res["fields"].remove(field_name);
+              res["fields/" + field_name].set(built_fields[field_name]);
+            }
+            continue;
+          }
+
+          res["fields"].remove(field_name);
+          if(!detail::remap_field(field, *entry, res["fields/" + field_name]))
+          {
+            res["fields/" + field_name].set_external(field);
+            conduit_fields.push_back(field_name);
+          }
+        }
+      }
+
+      if(!conduit_fields.empty())
+      {
+        conduit::Node options, s2dmap, d2smap, scratch;
+        for(const std::string &field_name : conduit_fields)
+        {
+          options["field_names"].append().set(field_name);
+        }
+        conduit::blueprint::mesh::topology::unstructured::generate_sides(
+          src_topo,
+          scratch["topologies/" + topo_name],
+          scratch["coordsets/" + coordset],
+          scratch["fields"],
+          s2dmap,
+          d2smap,
+          options);
+        for(const std::string &field_name : conduit_fields)
+        {
+          if(scratch["fields"].has_child(field_name))
+          {
+            res["fields"].remove(field_name);
+            res["fields/" + field_name].set(scratch["fields/" + field_name]);
+          }
+        }
+      }
     }
   }
 }
 
+void Transmogrifier::clear_poly_cache()
+{
+  detail::PolySidesCache &cache = detail::poly_sides_cache();
+  std::lock_guard<std::mutex> lock(cache.m_lock);
+  cache.m_sides.clear();
+}
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
@@ -15,6 +15,9 @@
 #define ASCENT_TRANSMOGRIGIFIER_HPP
 
 #include <flow_filter.hpp>
+#include <ascent_exports.h>
+#include <memory>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -23,7 +26,7 @@ namespace ascent
 {
 
 // The Transmogrifier is an invention that would one thing into another.
-class Transmogrifier
+class ASCENT_API Transmogrifier
 {
 public:
 // refinement level for high order data
@@ -31,11 +34,22 @@ static int m_refinement_level;
 
 static conduit::Node* low_order(conduit::Node &dataset);
 
+// releases the refined meshes kept between low_order calls
+static void clear_low_order_cache();
+
 static bool is_high_order(const conduit::Node &doms);
 
 static bool is_poly(const conduit::Node &doms);
 
-static void to_poly(conduit::Node &doms, conduit::Node &to_vtkh);
+// decomposes the polyhedral/polygonal topologies of doms into sides.
+// Decompositions are cached across calls and to_vtkh refers to them,
+// so sides holds the ones in use for as long as to_vtkh is.
+static void to_poly(conduit::Node &doms,
+                    conduit::Node &to_vtkh,
+                    std::vector<std::shared_ptr<conduit::Node>> &sides);
+
+// releases the side decompositions kept between to_poly calls
+static void clear_poly_cache();
 
 };
 
@@ -36,12 +36,15 @@ bool global_has(bool local)
   int local_boolean = local ? 1 : 0;
   int global_boolean;
   MPI_Comm mpi_comm = MPI_Comm_f2c(vtkh::GetMPICommHandle());
-  MPI_Allreduce((void *)(&local_boolean),
-                (void *)(&global_boolean),
-                1,
-                MPI_INT,
-                MPI_SUM,
-                mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce((void *)(&local_boolean),
+                  (void *)(&global_boolean),
+                  1,
+                  MPI_INT,
+                  MPI_SUM,
+                  mpi_comm);
+  }
 
   if(global_boolean == 0)
   {
@@ -61,12 +64,15 @@ int global_max(int local)
 #if defined(ASCENT_MPI_ENABLED)
 
   MPI_Comm mpi_comm = MPI_Comm_f2c(vtkh::GetMPICommHandle());
-  MPI_Allreduce((void *)(&local),
-                (void *)(&global_count),
-                1,
-                MPI_INT,
-                MPI_MAX,
-                mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce((void *)(&local),
+                  (void *)(&global_count),
+                  1,
+                  MPI_INT,
+                  MPI_MAX,
+                  mpi_comm);
+  }
 
 #endif
   return global_count;
@@ -121,11 +127,17 @@ std::string VTKHCollection::field_topology(const std::string field_name) {
   // there is no MPI_INT_INT so shove the "small" size into double
   MaxLoc maxloc = {(double)topo_name.length(), rank};
   MaxLoc maxloc_res;
-  MPI_Allreduce( &maxloc, &maxloc_res, 1, MPI_DOUBLE_INT, MPI_MAXLOC, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce( &maxloc, &maxloc_res, 1, MPI_DOUBLE_INT, MPI_MAXLOC, mpi_comm);
+  }
 
   conduit::Node msg;
   msg["topo"] = topo_name;
-  conduit::relay::mpi::broadcast_using_schema(msg,maxloc_res.rank,mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    conduit::relay::mpi::broadcast_using_schema(msg,maxloc_res.rank,mpi_comm);
+  }
 
   if(!msg["topo"].dtype().is_string())
   {
@@ -195,19 +207,22 @@ vtkm::Bounds VTKHCollection::global_bounds() const
     global_maxs[1] = 0.0;
     global_maxs[2] = 0.0;
 
-    MPI_Allreduce((void *)(&loc_mins),
-                  (void *)(&global_mins),
-                  3,
-                  MPI_DOUBLE,
-                  MPI_MIN,
-                  mpi_comm);
-
-    MPI_Allreduce((void *)(&loc_maxs),
-                  (void *)(&global_maxs),
-                  3,
-                  MPI_DOUBLE,
-                  MPI_MAX,
-                  mpi_comm);
+    {
+      MPIWaitTimer wait_timer;
+      MPI_Allreduce((void *)(&loc_mins),
+                    (void *)(&global_mins),
+                    3,
+                    MPI_DOUBLE,
+                    MPI_MIN,
+                    mpi_comm);
+
+      MPI_Allreduce((void *)(&loc_maxs),
+                    (void *)(&global_maxs),
+                    3,
+                    MPI_DOUBLE,
+                    MPI_MAX,
+                    mpi_comm);
+    }
 
     bounds.X.Min = global_mins[0];
     bounds.X.Max = global_maxs[0];
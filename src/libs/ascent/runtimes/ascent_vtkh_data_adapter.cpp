@@ -17,6 +17,8 @@
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <type_traits>
 
@@ -99,6 +101,82 @@ vtkm::Id3 topo_origin(const conduit::Node &n_topo)
   return topo_origin;
 }
 
+//-----------------------------------------------------------------------------
+// cell sets and coordinate systems of the topologies converted so far,
+// keyed by domain id, topology name and copy mode
+struct TopologyCache
+{
+  struct Entry
+  {
+    std::string                               m_topo_identity;
+    std::string                               m_coords_identity;
+    vtkm::cont::UnknownCellSet                m_cell_set;
+    std::vector<vtkm::cont::CoordinateSystem> m_coords;
+    int                                       m_neles;
+    int                                       m_nverts;
+  };
+
+  std::mutex                   m_lock;
+  std::map<std::string, Entry> m_entries;
+  // conversions that reused a cached cell set or coordinate system
+  long long                    m_reused_cell_sets = 0;
+  long long                    m_reused_coordsets = 0;
+};
+
+TopologyCache &topology_cache()
+{
+  static TopologyCache cache;
+  return cache;
+}
+
+//-----------------------------------------------------------------------------
+// appends the address and size of every leaf array (and the value of
+// every string leaf) under n to oss
+void append_array_identity(const conduit::Node &n, std::ostringstream &oss)
+{
+  const int num_children = n.number_of_children();
+  if(num_children == 0)
+  {
+    if(n.dtype().is_string())
+    {
+      oss << n.as_string() << ",";
+    }
+    else
+    {
+      oss << n.data_ptr() << ":" << n.dtype().offset() << ":"
+          << n.dtype().number_of_elements() << ",";
+    }
+    return;
+  }
+
+  for(int i = 0; i < num_children; ++i)
+  {
+    oss << n.child(i).name() << "=";
+    append_array_identity(n.child(i), oss);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// identity of a coordset or topology of a domain. The memory behind an
+// array can be rewritten without moving, so without the simulation's
+// revision counter (state/revisions/{coordsets,topologies}/name) the
+// identity is empty and nothing is reused.
+std::string revision_identity(const conduit::Node &dom,
+                              const std::string &category,
+                              const std::string &name,
+                              const conduit::Node &n)
+{
+  const std::string rev_path = "state/revisions/" + category + "/" + name;
+  if(!dom.has_path(rev_path))
+  {
+    return "";
+  }
+  std::ostringstream oss;
+  oss << dom[rev_path].to_int64() << "|";
+  append_array_identity(n, oss);
+  return oss.str();
+}
+
 template<typename T>
 const T* GetNodePointer(const conduit::Node &node);
 
@@ -577,6 +655,25 @@ VTKHDataAdapter::BlueprintToVTKHCollection(const conduit::Node &n,
     return res;
 }
 
+//-----------------------------------------------------------------------------
+void
+VTKHDataAdapter::ClearTopologyCache()
+{
+    detail::TopologyCache &cache = detail::topology_cache();
+    std::lock_guard<std::mutex> lock(cache.m_lock);
+    cache.m_entries.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+VTKHDataAdapter::TopologyCacheReuse(long long &cell_sets, long long &coordsets)
+{
+    detail::TopologyCache &cache = detail::topology_cache();
+    std::lock_guard<std::mutex> lock(cache.m_lock);
+    cell_sets = cache.m_reused_cell_sets;
+    coordsets = cache.m_reused_coordsets;
+}
+
 //-----------------------------------------------------------------------------
 vtkh::DataSet *
 VTKHDataAdapter::BlueprintToVTKHDataSet(const Node &node,
@@ -654,62 +751,151 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
     int neles  = 0;
     int nverts = 0;
 
-    if( mesh_type ==  "uniform")
+    // reuse the cell set (and coordinates) of an unchanged topology
+    std::string cache_key;
+    std::string topo_identity;
+    std::string coords_identity;
+    if(node.has_path("state/domain_id"))
     {
-        result = UniformBlueprintToVTKmDataSet(coords_name,
-                                               n_coords,
-                                               topo_name,
-                                               n_topo,
-                                               neles,
-                                               nverts);
+        topo_identity = detail::revision_identity(node, "topologies", topo_name, n_topo);
+        coords_identity = detail::revision_identity(node, "coordsets", coords_name, n_coords);
+        std::ostringstream oss;
+        oss << node["state/domain_id"].to_int64() << "/" << topo_name
+            << (zero_copy ? "/zero_copy" : "/copy");
+        cache_key = oss.str();
     }
-    else if(mesh_type == "rectilinear")
+
+    if(topo_identity != "")
     {
-        result = RectilinearBlueprintToVTKmDataSet(coords_name,
-                                                   n_coords,
-                                                   topo_name,
-                                                   n_topo,
-                                                   neles,
-                                                   nverts,
-                                                   zero_copy);
+        detail::TopologyCache &cache = detail::topology_cache();
+        std::lock_guard<std::mutex> lock(cache.m_lock);
+        auto entry = cache.m_entries.find(cache_key);
+        if(entry != cache.m_entries.end() &&
+           entry->second.m_topo_identity == topo_identity)
+        {
+            const detail::TopologyCache::Entry &cached = entry->second;
+            if(coords_identity != "" && cached.m_coords_identity == coords_identity)
+            {
+                result = new vtkm::cont::DataSet();
+                for(const auto &coords : cached.m_coords)
+                {
+                    result->AddCoordinateSystem(coords);
+                }
+                cache.m_reused_coordsets++;
+            }
+            // explicit points can move under the same cells
+            else if(mesh_type == "unstructured" &&
+                    n_coords["values/x"].dtype().number_of_elements() == cached.m_nverts)
+            {
+                int ndims = 0;
+                result = new vtkm::cont::DataSet();
+                if(n_coords["values/x"].dtype().is_float64())
+                {
+                  result->AddCoordinateSystem(
+                    detail::GetExplicitCoordinateSystem<float64>(n_coords,
+                                                                 coords_name,
+                                                                 ndims,
+                                                                 zero_copy));
+                }
+                else if(n_coords["values/x"].dtype().is_float32())
+                {
+                  result->AddCoordinateSystem(
+                    detail::GetExplicitCoordinateSystem<float32>(n_coords,
+                                                                 coords_name,
+                                                                 ndims,
+                                                                 zero_copy));
+                }
+                else
+                {
+                  ASCENT_ERROR("Coordinate system must be floating point values");
+                }
+            }
 
+            if(result != NULL)
+            {
+                result->SetCellSet(cached.m_cell_set);
+                cache.m_reused_cell_sets++;
+                neles  = cached.m_neles;
+                nverts = cached.m_nverts;
+            }
+        }
     }
-    else if(mesh_type == "structured")
+
+    if(result == NULL)
     {
-        result =  StructuredBlueprintToVTKmDataSet(coords_name,
+        if( mesh_type ==  "uniform")
+        {
+            result = UniformBlueprintToVTKmDataSet(coords_name,
                                                    n_coords,
                                                    topo_name,
                                                    n_topo,
                                                    neles,
-                                                   nverts,
-                                                   zero_copy);
-    }
-    else if( mesh_type ==  "points")
-    {
-        result =  PointsImplicitBlueprintToVTKmDataSet(coords_name,
+                                                   nverts);
+        }
+        else if(mesh_type == "rectilinear")
+        {
+            result = RectilinearBlueprintToVTKmDataSet(coords_name,
                                                        n_coords,
                                                        topo_name,
                                                        n_topo,
                                                        neles,
                                                        nverts,
                                                        zero_copy);
+
+        }
+        else if(mesh_type == "structured")
+        {
+            result =  StructuredBlueprintToVTKmDataSet(coords_name,
+                                                       n_coords,
+                                                       topo_name,
+                                                       n_topo,
+                                                       neles,
+                                                       nverts,
+                                                       zero_copy);
+        }
+        else if( mesh_type ==  "points")
+        {
+            result =  PointsImplicitBlueprintToVTKmDataSet(coords_name,
+                                                           n_coords,
+                                                           topo_name,
+                                                           n_topo,
+                                                           neles,
+                                                           nverts,
+                                                           zero_copy);
+        }
+        else if( mesh_type ==  "unstructured")
+        {
+            result =  UnstructuredBlueprintToVTKmDataSet(coords_name,
+                                                         n_coords,
+                                                         topo_name,
+                                                         n_topo,
+                                                         neles,
+                                                         nverts,
+                                                         zero_copy);
+        }
+        else
+        {
+            ASCENT_ERROR("Unsupported topology/type:" << mesh_type);
+        }
     }
-    else if( mesh_type ==  "unstructured")
-    {
-        result =  UnstructuredBlueprintToVTKmDataSet(coords_name,
-                                                     n_coords,
-                                                     topo_name,
-                                                     n_topo,
-                                                     neles,
-                                                     nverts,
-                                                     zero_copy);
-    }
-    else
+
+    if(topo_identity != "")
     {
-        ASCENT_ERROR("Unsupported topology/type:" << mesh_type);
+        detail::TopologyCache &cache = detail::topology_cache();
+        std::lock_guard<std::mutex> lock(cache.m_lock);
+        detail::TopologyCache::Entry &entry = cache.m_entries[cache_key];
+        entry.m_topo_identity = topo_identity;
+        entry.m_coords_identity = coords_identity;
+        entry.m_cell_set = result->GetCellSet();
+        entry.m_coords.clear();
+        for(vtkm::Id i = 0; i < result->GetNumberOfCoordinateSystems(); ++i)
+        {
+            entry.m_coords.push_back(result->GetCoordinateSystem(i));
+        }
+        entry.m_neles = neles;
+        entry.m_nverts = nverts;
     }
 
-
     if(node.has_child("fields"))
     {
         // add all of the fields:
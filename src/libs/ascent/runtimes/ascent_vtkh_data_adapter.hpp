@@ -97,6 +97,14 @@ public:
     static void              VTKHCollectionToBlueprintDataSet(VTKHCollection *collection,
                                                               conduit::Node &node,
                                                               bool zero_copy = false);
+
+    // releases the cell sets and coordinate systems kept for topologies
+    // with revision counters
+    static void              ClearTopologyCache();
+    // the number of conversions so far that reused a cached cell set
+    // and a cached coordinate system
+    static void              TopologyCacheReuse(long long &cell_sets,
+                                                long long &coordsets);
 private:
     // helpers for specific conversion cases
     static vtkm::cont::DataSet  *UniformBlueprintToVTKmDataSet(const std::string &coords_name,
@@ -27,6 +27,10 @@
 #include <cmath>
 #include <cstring>
 #include <limits>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
 
 #include <flow_workspace.hpp>
 
@@ -64,12 +68,15 @@ at_least_one(bool local)
   int local_boolean = local ? 1 : 0;
   int global_count = 0;
   MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
-  MPI_Allreduce((void *)(&local_boolean),
-                (void *)(&global_count),
-                1,
-                MPI_INT,
-                MPI_SUM,
-                mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce((void *)(&local_boolean),
+                  (void *)(&global_count),
+                  1,
+                  MPI_INT,
+                  MPI_SUM,
+                  mpi_comm);
+  }
 
   if(global_count > 0)
   {
@@ -770,7 +777,10 @@ int num_components(const conduit::Node &dataset,
 #ifdef ASCENT_MPI_ENABLED
   int global_comps;
   MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
-  MPI_Allreduce(&comps, &global_comps, 1, MPI_INT, MPI_MAX, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce(&comps, &global_comps, 1, MPI_INT, MPI_MAX, mpi_comm);
+  }
   comps = global_comps;
 #endif
   return comps;
@@ -979,7 +989,10 @@ field_histogram(const conduit::Node &dataset,
   double *global_bins = new double[num_bins];
 
   MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
-  MPI_Allreduce(bins, global_bins, num_bins, MPI_DOUBLE, MPI_SUM, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce(bins, global_bins, num_bins, MPI_DOUBLE, MPI_SUM, mpi_comm);
+  }
 
   delete[] bins;
   bins = global_bins;
@@ -992,6 +1005,311 @@ field_histogram(const conduit::Node &dataset,
   return res;
 }
 
+namespace detail
+{
+
+//
+// adds the counts of store b into store a, both are windows of keys
+// starting at "offset". Like the device pass, the merged window keeps
+// at most quantile_sketch_max_keys keys and collapses the lowest ones.
+//
+void
+merge_sketch_store(conduit::Node &a, const conduit::Node &b)
+{
+  const int b_size = b["counts"].dtype().number_of_elements();
+  if(b_size == 0)
+  {
+    return;
+  }
+  const int a_size = a["counts"].dtype().number_of_elements();
+  if(a_size == 0)
+  {
+    a.set(b);
+    return;
+  }
+
+  const int a_lo = a["offset"].to_int32();
+  const int b_lo = b["offset"].to_int32();
+  const int hi = std::max(a_lo + a_size, b_lo + b_size);
+  const int lo = std::max(std::min(a_lo, b_lo), hi - quantile_sketch_max_keys);
+
+  std::vector<double> counts(hi - lo, 0.);
+  const double *a_counts = a["counts"].as_float64_ptr();
+  const double *b_counts = b["counts"].as_float64_ptr();
+  for(int i = 0; i < a_size; ++i)
+  {
+    counts[std::max(a_lo + i - lo, 0)] += a_counts[i];
+  }
+  for(int i = 0; i < b_size; ++i)
+  {
+    counts[std::max(b_lo + i - lo, 0)] += b_counts[i];
+  }
+  a["offset"] = lo;
+  a["counts"].set(counts);
+}
+
+//
+// sketches built during the current execute
+//
+std::map<std::string, conduit::Node> &
+sketch_cache()
+{
+  static std::map<std::string, conduit::Node> cache;
+  return cache;
+}
+
+//
+// merges the sketches of all ranks. The key windows are agreed on
+// first, so the counts can be summed in a single allreduce.
+//
+void
+global_sketch(conduit::Node &sketch)
+{
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+  const std::string stores[2] = {"positive", "negative"};
+  const double empty = std::numeric_limits<double>::max();
+
+  // everything is reduced with min, maxes are negated
+  double local_bounds[6];
+  for(int s = 0; s < 2; ++s)
+  {
+    const conduit::Node &store = sketch[stores[s]];
+    const int size = store["counts"].dtype().number_of_elements();
+    const int lo = store["offset"].to_int32();
+    local_bounds[s * 2 + 0] = size == 0 ? empty : lo;
+    local_bounds[s * 2 + 1] = size == 0 ? empty : -(lo + size - 1);
+  }
+  local_bounds[4] = sketch["min_val"].to_float64();
+  local_bounds[5] = -sketch["max_val"].to_float64();
+
+  double global_bounds[6];
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce(local_bounds, global_bounds, 6, MPI_DOUBLE, MPI_MIN, mpi_comm);
+  }
+
+  int lo[2], size[2];
+  int total = 2;
+  for(int s = 0; s < 2; ++s)
+  {
+    if(global_bounds[s * 2] == empty)
+    {
+      lo[s] = 0;
+      size[s] = 0;
+    }
+    else
+    {
+      const int hi = static_cast<int>(-global_bounds[s * 2 + 1]);
+      lo[s] = std::max(static_cast<int>(global_bounds[s * 2]),
+                       hi - quantile_sketch_max_keys + 1);
+      size[s] = hi - lo[s] + 1;
+    }
+    total += size[s];
+  }
+
+  // count, zero count, then both windows
+  std::vector<double> local(total, 0.);
+  local[0] = sketch["count"].to_float64();
+  local[1] = sketch["zero_count"].to_float64();
+  int start = 2;
+  for(int s = 0; s < 2; ++s)
+  {
+    const conduit::Node &store = sketch[stores[s]];
+    const int store_size = store["counts"].dtype().number_of_elements();
+    if(store_size > 0)
+    {
+      const int store_lo = store["offset"].to_int32();
+      const double *counts = store["counts"].as_float64_ptr();
+      for(int i = 0; i < store_size; ++i)
+      {
+        // keys below the window are collapsed into its lowest key
+        local[start + std::max(store_lo + i - lo[s], 0)] += counts[i];
+      }
+    }
+    start += size[s];
+  }
+
+  std::vector<double> global(total);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce(&local[0], &global[0], total, MPI_DOUBLE, MPI_SUM, mpi_comm);
+  }
+
+  sketch["count"] = (conduit::int64) global[0];
+  sketch["zero_count"] = (conduit::int64) global[1];
+  sketch["min_val"] = global_bounds[4];
+  sketch["max_val"] = -global_bounds[5];
+  start = 2;
+  for(int s = 0; s < 2; ++s)
+  {
+    conduit::Node &store = sketch[stores[s]];
+    store["offset"] = lo[s];
+    store["counts"].set(&global[start], size[s]);
+    start += size[s];
+  }
+#endif
+}
+
+} // namespace detail
+
+conduit::Node
+field_quantile_sketch(const conduit::Node &dataset,
+                      const std::string &field,
+                      const double &relative_accuracy)
+{
+  // the cache only lives for one execute, so the arrays of the
+  // dataset can't change under a key
+  std::stringstream key;
+  key << field << ":" << relative_accuracy;
+  for(int i = 0; i < dataset.number_of_children(); ++i)
+  {
+    const conduit::Node &dom = dataset.child(i);
+    if(dom.has_path("fields/" + field + "/values"))
+    {
+      const conduit::Node &values = dom["fields/" + field + "/values"];
+      key << ":" << values.data_ptr() << "/"
+          << values.dtype().number_of_elements();
+    }
+  }
+
+  // the merge is collective, so either every rank uses
+  // its cached sketch or none do
+  std::map<std::string, conduit::Node> &cache = detail::sketch_cache();
+  auto itr = cache.find(key.str());
+  if(global_agreement(itr != cache.end()))
+  {
+    return itr->second;
+  }
+
+  conduit::Node res;
+  res["relative_accuracy"] = relative_accuracy;
+  res["count"] = (conduit::int64) 0;
+  res["zero_count"] = (conduit::int64) 0;
+  res["min_val"] = std::numeric_limits<double>::max();
+  res["max_val"] = std::numeric_limits<double>::lowest();
+  res["positive/offset"] = 0;
+  res["positive/counts"].set(conduit::DataType::float64(0));
+  res["negative/offset"] = 0;
+  res["negative/counts"].set(conduit::DataType::float64(0));
+
+  for(int i = 0; i < dataset.number_of_children(); ++i)
+  {
+    const conduit::Node &dom = dataset.child(i);
+    if(dom.has_path("fields/" + field))
+    {
+      const std::string path = "fields/" + field;
+      conduit::Node dom_sketch =
+        field_reduction_quantile_sketch(dom[path], relative_accuracy);
+
+      res["count"] = res["count"].to_int64() + dom_sketch["count"].to_int64();
+      res["zero_count"] = res["zero_count"].to_int64() +
+                          dom_sketch["zero_count"].to_int64();
+      res["min_val"] = std::min(res["min_val"].to_float64(),
+                                dom_sketch["min_val"].to_float64());
+      res["max_val"] = std::max(res["max_val"].to_float64(),
+                                dom_sketch["max_val"].to_float64());
+      detail::merge_sketch_store(res["positive"], dom_sketch["positive"]);
+      detail::merge_sketch_store(res["negative"], dom_sketch["negative"]);
+    }
+  }
+
+  detail::global_sketch(res);
+
+  cache[key.str()] = res;
+  return res;
+}
+
+void
+clear_quantile_sketch_cache()
+{
+  detail::sketch_cache().clear();
+}
+
+conduit::Node
+sketch_quantile(const conduit::Node &sketch, const double val)
+{
+  const double count = sketch["count"].to_float64();
+  const double min_val = sketch["min_val"].to_float64();
+  const double max_val = sketch["max_val"].to_float64();
+
+  conduit::Node res;
+  if(count == 0)
+  {
+    res["value"] = std::numeric_limits<double>::quiet_NaN();
+    return res;
+  }
+  if(val <= 0.)
+  {
+    res["value"] = min_val;
+    return res;
+  }
+  if(val >= 1.)
+  {
+    res["value"] = max_val;
+    return res;
+  }
+
+  const double accuracy = sketch["relative_accuracy"].to_float64();
+  const double gamma = (1. + accuracy) / (1. - accuracy);
+  const double rank = val * (count - 1);
+
+  // buckets in value order: negative store from the largest key down,
+  // the zero bucket, then the positive store from the smallest key up
+  const conduit::Node &neg = sketch["negative"];
+  const conduit::Node &pos = sketch["positive"];
+  const int neg_size = neg["counts"].dtype().number_of_elements();
+  const int pos_size = pos["counts"].dtype().number_of_elements();
+
+  double result = max_val;
+  bool found = false;
+  double seen = 0.;
+
+  if(neg_size > 0)
+  {
+    const double *counts = neg["counts"].as_float64_ptr();
+    const int offset = neg["offset"].to_int32();
+    for(int i = neg_size - 1; i >= 0 && !found; --i)
+    {
+      seen += counts[i];
+      if(seen > rank)
+      {
+        result = -2. * std::pow(gamma, offset + i) / (gamma + 1.);
+        found = true;
+      }
+    }
+  }
+
+  if(!found)
+  {
+    seen += sketch["zero_count"].to_float64();
+    if(seen > rank)
+    {
+      result = 0.;
+      found = true;
+    }
+  }
+
+  if(!found && pos_size > 0)
+  {
+    const double *counts = pos["counts"].as_float64_ptr();
+    const int offset = pos["offset"].to_int32();
+    for(int i = 0; i < pos_size && !found; ++i)
+    {
+      seen += counts[i];
+      if(seen > rank)
+      {
+        result = 2. * std::pow(gamma, offset + i) / (gamma + 1.);
+        found = true;
+      }
+    }
+  }
+
+  // the bucket value can fall just outside of the data
+  res["value"] = std::max(min_val, std::min(max_val, result));
+  return res;
+}
+
 // returns a Node containing the min, max and dim for x,y,z given a topology
 conduit::Node
 global_bounds(const conduit::Node &dataset, const std::string &topo_name)
@@ -1056,8 +1374,11 @@ global_bounds(const conduit::Node &dataset, const std::string &topo_name)
   }
 #ifdef ASCENT_MPI_ENABLED
   MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
-  MPI_Allreduce(MPI_IN_PLACE, min_coords, 3, MPI_DOUBLE, MPI_MIN, mpi_comm);
-  MPI_Allreduce(MPI_IN_PLACE, max_coords, 3, MPI_DOUBLE, MPI_MAX, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce(MPI_IN_PLACE, min_coords, 3, MPI_DOUBLE, MPI_MIN, mpi_comm);
+    MPI_Allreduce(MPI_IN_PLACE, max_coords, 3, MPI_DOUBLE, MPI_MAX, mpi_comm);
+  }
 #endif
   conduit::Node res;
   res["max_coords"].set(max_coords, 3);
@@ -1122,12 +1443,18 @@ global_topo_and_assoc(const conduit::Node &dataset,
   // there is no MPI_INT_INT so shove the "small" size into double
   MaxLoc maxloc = {(double)topo_name.length(), rank};
   MaxLoc maxloc_res;
-  MPI_Allreduce(&maxloc, &maxloc_res, 1, MPI_DOUBLE_INT, MPI_MAXLOC, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce(&maxloc, &maxloc_res, 1, MPI_DOUBLE_INT, MPI_MAXLOC, mpi_comm);
+  }
 
   conduit::Node msg;
   msg["assoc_str"] = assoc_str;
   msg["topo_name"] = topo_name;
-  conduit::relay::mpi::broadcast_using_schema(msg, maxloc_res.rank, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    conduit::relay::mpi::broadcast_using_schema(msg, maxloc_res.rank, mpi_comm);
+  }
 
 
   if(assoc_str != "" && assoc_str != msg["assoc_str"].as_string())
@@ -1306,14 +1633,15 @@ populate_homes(const conduit::Node &dom,
   }
   // each domain has a homes array
   // homes maps each datapoint (or cell) to an index in bins
-  res.set(conduit::DataType::c_int(homes_size));
-  int *homes = res.value();
-  for(int i = 0; i < homes_size; ++i)
+  // homes are 64 bit, the product of the axes can get big
+  res.set(conduit::DataType::int64(homes_size));
+  conduit::int64 *homes = res.value();
+  for(conduit::index_t i = 0; i < homes_size; ++i)
   {
     homes[i] = 0;
   }
 
-  int stride = 1;
+  conduit::index_t stride = 1;
   for(int axis_index = 0; axis_index < num_axes; ++axis_index)
   {
     const conduit::Node &axis = bin_axes.child(axis_index);
@@ -1326,7 +1654,7 @@ populate_homes(const conduit::Node &dom,
         const conduit::float32_array values = dom[values_path].value();
         for(int i = 0; i < values.number_of_elements(); ++i)
         {
-          const int bin_index = get_bin_index(values[i], axis);
+          const conduit::index_t bin_index = get_bin_index(values[i], axis);
           // don't set anything if we haven't found a bin yet
           if(homes[i] != -1)
           {
@@ -1346,7 +1674,7 @@ populate_homes(const conduit::Node &dom,
         const conduit::float64_array values = dom[values_path].value();
         for(int i = 0; i < values.number_of_elements(); ++i)
         {
-          const int bin_index = get_bin_index(values[i], axis);
+          const conduit::index_t bin_index = get_bin_index(values[i], axis);
           // don't set anything if we haven't found a bin yet
           if(homes[i] != -1)
           {
@@ -1365,7 +1693,7 @@ populate_homes(const conduit::Node &dom,
     else if(is_xyz(axis_name))
     {
       int coord = axis_name[0] - 'x';
-      for(int i = 0; i < homes_size; ++i)
+      for(conduit::index_t i = 0; i < homes_size; ++i)
       {
         conduit::Node n_loc;
         if(assoc_str == "vertex")
@@ -1377,7 +1705,7 @@ populate_homes(const conduit::Node &dom,
           n_loc = element_location(dom, i, topo_name);
         }
         const double *loc = n_loc.value();
-        const int bin_index = get_bin_index(loc[coord], axis);
+        const conduit::index_t bin_index = get_bin_index(loc[coord], axis);
         // don't set anything if we haven't found a bin yet
         if(homes[i] != -1)
         {
@@ -1409,7 +1737,7 @@ populate_homes(const conduit::Node &dom,
 
 void
 update_bin(double *bins,
-           const int i,
+           const conduit::index_t i,
            const double value,
            const std::string &reduction_op)
 {
@@ -1442,7 +1770,7 @@ update_bin(double *bins,
 
 
 void init_bins(double *bins,
-               const int size,
+               const conduit::index_t size,
                const std::string reduction_op)
 {
   if(reduction_op != "max" && reduction_op != "min")
@@ -1464,7 +1792,7 @@ void init_bins(double *bins,
 #ifdef ASCENT_OPENMP_ENABLED
 #pragma omp parallel for
 #endif
-  for(int i = 0; i < size; ++i)
+  for(conduit::index_t i = 0; i < size; ++i)
   {
     bins[i] = init_val;
   }
@@ -1472,256 +1800,311 @@ void init_bins(double *bins,
 }
 
 
-//
-// NOTE THERE IS A RAJA VERSION IN ascent_data_binning
-// that we want to supercede this one, it needs more work.
-//
+namespace detail
+{
 
-conduit::Node
-binning(const conduit::Node &dataset,
-        conduit::Node &bin_axes,
-        const std::string &reduction_var,
-        const std::string &reduction_op,
-        const double empty_bin_val,
-        const std::string &component)
+// the number of bins spanned by all of the axes
+conduit::index_t
+total_bins(const conduit::Node &bin_axes)
 {
-  std::vector<std::string> var_names = bin_axes.child_names();
-  if(!reduction_var.empty())
+  conduit::index_t num_bins = 1;
+  const int num_axes = bin_axes.number_of_children();
+  for(int axis_index = 0; axis_index < num_axes; ++axis_index)
   {
-    var_names.push_back(reduction_var);
+    const conduit::Node &axis = bin_axes.child(axis_index);
+    if(axis.has_path("num_bins"))
+    {
+      // uniform axis
+      num_bins *= axis["num_bins"].to_index_t();
+    }
+    else
+    {
+      // rectilinear axis
+      num_bins *= axis["bins"].dtype().number_of_elements() - 1;
+    }
   }
-  const conduit::Node &topo_and_assoc =
-      global_topo_and_assoc(dataset, var_names);
-  const std::string topo_name = topo_and_assoc["topo_name"].as_string();
-  const std::string assoc_str = topo_and_assoc["assoc_str"].as_string();
+  return num_bins;
+}
 
-  const conduit::Node &bounds = global_bounds(dataset, topo_name);
-  const double *min_coords = bounds["min_coords"].value();
-  const double *max_coords = bounds["max_coords"].value();
-  const std::string axes[3][3] = {
-      {"x", "i", "dx"}, {"y", "j", "dy"}, {"z", "k", "dz"}};
-  // populate min_val, max_val, for x,y,z
-  for(int axis_num = 0; axis_num < 3; ++axis_num)
+// number of variables held per bin (e.g. sum and cnt for average)
+int
+num_bin_vars(const std::string &reduction_op)
+{
+  if(reduction_op == "var" || reduction_op == "std")
   {
-    if(bin_axes.has_path(axes[axis_num][0]))
+    return 3;
+  }
+  else if(reduction_op == "min" || reduction_op == "max")
+  {
+    return 1;
+  }
+  return 2;
+}
+
+//
+// The occupied bins of a sparse binning. Each occupied bin gets a slot
+// in a packed array of bin variables that has the same layout as the
+// dense bins, so update_bin works on both.
+//
+struct SparseBins
+{
+  std::unordered_map<conduit::int64, conduit::index_t> m_slots;
+  std::vector<conduit::int64> m_ids;
+  std::vector<double> m_vars;
+  std::string m_reduction_op;
+  int m_num_bin_vars;
+
+  SparseBins(const std::string &reduction_op)
+    : m_reduction_op(reduction_op),
+      m_num_bin_vars(num_bin_vars(reduction_op))
+  {}
+
+  conduit::index_t
+  slot(const conduit::int64 bin_id)
+  {
+    auto it = m_slots.find(bin_id);
+    if(it != m_slots.end())
     {
-      conduit::Node &axis = bin_axes[axes[axis_num][0]];
+      return it->second;
+    }
+    const conduit::index_t new_slot = m_ids.size();
+    m_slots[bin_id] = new_slot;
+    m_ids.push_back(bin_id);
+    m_vars.resize(m_vars.size() + m_num_bin_vars, 0.0);
+    init_bins(&m_vars[new_slot * m_num_bin_vars],
+              m_num_bin_vars,
+              m_reduction_op);
+    return new_slot;
+  }
 
-      if(axis.has_path("bins"))
-      {
-        // rectilinear binning was specified
-        continue;
-      }
+  void
+  update(const conduit::int64 bin_id, const double value)
+  {
+    const conduit::index_t s = slot(bin_id);
+    update_bin(m_vars.data(), s, value, m_reduction_op);
+  }
 
-      if(min_coords[axis_num] == std::numeric_limits<double>::max())
+  // combines the variables of the same bin from another rank
+  void
+  merge(const conduit::int64 bin_id, const double *vars)
+  {
+    double *dest = &m_vars[slot(bin_id) * m_num_bin_vars];
+    for(int v = 0; v < m_num_bin_vars; ++v)
+    {
+      if(m_reduction_op == "min")
       {
-        ASCENT_ERROR("Could not finds bounds for axis: "
-                     << axes[axis_num][0]
-                     << ". It probably doesn't exist in the topology: "
-                     << topo_name);
+        dest[v] = std::min(dest[v], vars[v]);
       }
-
-      if(!axis.has_path("min_val"))
+      else if(m_reduction_op == "max")
       {
-        axis["min_val"] = min_coords[axis_num];
+        dest[v] = std::max(dest[v], vars[v]);
       }
-
-      if(!axis.has_path("max_val"))
+      else
       {
-        // We add eps because the last bin isn't inclusive
-        double min_val = axis["min_val"].to_float64();
-        double length = max_coords[axis_num] - min_val;
-        double eps = length * 1e-8;
-        axis["max_val"] = max_coords[axis_num] + eps;
+        dest[v] += vars[v];
       }
     }
   }
 
-  int num_axes = bin_axes.number_of_children();
-
-  // create bins
-  index_t num_bins = 1;
-  for(int axis_index = 0; axis_index < num_axes; ++axis_index)
+  // orders the occupied bins by bin id
+  void
+  sort()
   {
-    conduit::Node &axis = bin_axes.child(axis_index);
-    const std::string axis_name = axis.name();
-
-    if(!bin_axes.child(axis_index).has_child("min_val"))
-    {
-      axis["min_val"] = field_min(dataset, axis_name)["value"].to_float64();
-    }
-    if(!axis.has_child("max_val"))
+    const conduit::index_t size = m_ids.size();
+    std::vector<conduit::index_t> order(size);
+    for(conduit::index_t i = 0; i < size; ++i)
     {
-      // TODO: FIXME THE BASELINES REQUIRE +1 here, not good.
-      axis["max_val"] = field_max(dataset, axis_name)["value"].to_float64() + 1.0;
+      order[i] = i;
     }
+    std::sort(order.begin(),
+              order.end(),
+              [this](conduit::index_t a, conduit::index_t b)
+              {
+                return m_ids[a] < m_ids[b];
+              });
 
-    if(bin_axes.child(axis_index).has_path("num_bins"))
-    {
-      // uniform axis
-      num_bins *= bin_axes.child(axis_index)["num_bins"].to_index_t();
-    }
-    else
+    std::vector<conduit::int64> ids(size);
+    std::vector<double> vars(size * m_num_bin_vars);
+    m_slots.clear();
+    for(conduit::index_t i = 0; i < size; ++i)
     {
-      // rectilinear axis
-      num_bins *=
-          bin_axes.child(axis_index)["bins"].dtype().number_of_elements() - 1;
+      ids[i] = m_ids[order[i]];
+      for(int v = 0; v < m_num_bin_vars; ++v)
+      {
+        vars[i * m_num_bin_vars + v] = m_vars[order[i] * m_num_bin_vars + v];
+      }
+      m_slots[ids[i]] = i;
     }
+    m_ids.swap(ids);
+    m_vars.swap(vars);
   }
-  // number of variables held per bin (e.g. sum and cnt for average)
-  int num_bin_vars = 2;
-  if(reduction_op == "var" || reduction_op == "std")
-  {
-    num_bin_vars = 3;
-  }
-  else if(reduction_op == "min" || reduction_op == "max")
-  {
-    num_bin_vars = 1;
-  }
-  const int bins_size = num_bins * num_bin_vars;
-  double *bins = new double[bins_size]();
-  init_bins(bins, bins_size, reduction_op);
+};
 
-  for(int dom_index = 0; dom_index < dataset.number_of_children(); ++dom_index)
+#ifdef ASCENT_MPI_ENABLED
+// scatters bin ids over the ranks so neighboring bins, which tend
+// to be occupied together, don't all land on the same rank
+int
+bin_owner(const conduit::int64 bin_id, const int size)
+{
+  const conduit::uint64 hash =
+      static_cast<conduit::uint64>(bin_id) * 11400714819323198485ull;
+  return static_cast<int>((hash >> 32) % static_cast<conduit::uint64>(size));
+}
+
+std::vector<int>
+exclusive_offsets(const std::vector<int> &counts, int &total)
+{
+  std::vector<int> offsets(counts.size(), 0);
+  total = 0;
+  for(size_t i = 0; i < counts.size(); ++i)
   {
-    const conduit::Node &dom = dataset.child(dom_index);
-    if(!dom.has_path("topologies/"+topo_name))
-    {
-      continue;
-    }
+    offsets[i] = total;
+    total += counts[i];
+  }
+  return offsets;
+}
 
-    conduit::Node n_homes;
-    populate_homes(dom, bin_axes, topo_name, assoc_str, n_homes);
+std::vector<int>
+scale(const std::vector<int> &counts, const int factor)
+{
+  std::vector<int> res(counts);
+  for(size_t i = 0; i < res.size(); ++i)
+  {
+    res[i] *= factor;
+  }
+  return res;
+}
+#endif
 
-    if(n_homes.has_path("error"))
-    {
-      ASCENT_INFO("Binning: not binning domain "
-                  << dom_index << " because field: '"
-                  << n_homes["error/field_name"].to_string()
-                  << "' was not found.");
-      continue;
-    }
-    const int *homes = n_homes.as_int_ptr();
-    const int homes_size = n_homes.dtype().number_of_elements();
+//
+// Sparse reduce of the occupied bins. Every bin is sent to the rank that
+// owns it (hashed all-to-all), owners merge the bins, and the merged bins
+// are gathered on all ranks. Only occupied bins ever go over the wire.
+// On return every rank holds the same bins ordered by bin id.
+//
+void
+exchange_sparse_bins(SparseBins &bins)
+{
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+  int size;
+  MPI_Comm_size(mpi_comm, &size);
 
-    // update bins
-    if(reduction_var.empty())
-    {
-//#ifdef ASCENT_OPENMP_ENABLED
-//#pragma omp parallel for
-//#endif
-      for(int i = 0; i < homes_size; ++i)
-      {
-        if(homes[i] != -1)
-        {
-          update_bin(bins, homes[i], 1, reduction_op);
-        }
-      }
-    }
-    else if(dom.has_path("fields/" + reduction_var))
-    {
-      const std::string comp_path = component == "" ? "" : "/" + component;
-      const std::string values_path
-        = "fields/" + reduction_var + "/values" + comp_path;
+  const int num_bin_vars = bins.m_num_bin_vars;
+  const conduit::index_t num_local = bins.m_ids.size();
 
-      if(dom[values_path].dtype().is_float32())
-      {
-        const conduit::float32_array values = dom[values_path].value();
-//#ifdef ASCENT_OPENMP_ENABLED
-//#pragma omp parallel for
-//#endif
-        for(int i = 0; i < homes_size; ++i)
-        {
-          if(homes[i] != -1)
-          {
-            update_bin(bins, homes[i], values[i], reduction_op);
-          }
-        }
-      }
-      else
-      {
-        const conduit::float64_array values = dom[values_path].value();
-//#ifdef ASCENT_OPENMP_ENABLED
-//#pragma omp parallel for
-//#endif
-        for(int i = 0; i < homes_size; ++i)
-        {
-          if(homes[i] != -1)
-          {
-            update_bin(bins, homes[i], values[i], reduction_op);
-          }
-        }
-      }
-    }
-    else if(is_xyz(reduction_var))
-    {
-      int coord = reduction_var[0] - 'x';
-//#ifdef ASCENT_OPENMP_ENABLED
-//#pragma omp parallel for
-//#endif
-      for(int i = 0; i < homes_size; ++i)
-      {
-        conduit::Node n_loc;
-        if(assoc_str == "vertex")
-        {
-          n_loc = vert_location(dom, i, topo_name);
-        }
-        else if(assoc_str == "element")
-        {
-          n_loc = element_location(dom, i, topo_name);
-        }
-        const double *loc = n_loc.value();
-        if(homes[i] != -1)
-        {
-          update_bin(bins, homes[i], loc[coord], reduction_op);
-        }
-      }
-    }
-    else
+  std::vector<int> send_counts(size, 0);
+  for(conduit::index_t i = 0; i < num_local; ++i)
+  {
+    send_counts[bin_owner(bins.m_ids[i], size)]++;
+  }
+  int num_send;
+  std::vector<int> send_offsets = exclusive_offsets(send_counts, num_send);
+
+  std::vector<conduit::int64> send_ids(num_send);
+  std::vector<double> send_vars(num_send * num_bin_vars);
+  std::vector<int> cursors(send_offsets);
+  for(conduit::index_t i = 0; i < num_local; ++i)
+  {
+    const int c = cursors[bin_owner(bins.m_ids[i], size)]++;
+    send_ids[c] = bins.m_ids[i];
+    for(int v = 0; v < num_bin_vars; ++v)
     {
-      ASCENT_INFO("Binning: not binning domain "
-                  << dom_index << " because field: '" << reduction_var
-                  << "' was not found.");
+      send_vars[c * num_bin_vars + v] = bins.m_vars[i * num_bin_vars + v];
     }
   }
 
-#ifdef ASCENT_MPI_ENABLED
-  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
-  double *global_bins = new double[bins_size];
-  if(reduction_op == "sum" || reduction_op == "pdf" || reduction_op == "avg" ||
-     reduction_op == "std" || reduction_op == "var" || reduction_op == "rms")
+  std::vector<int> recv_counts(size, 0);
   {
-    MPI_Allreduce(bins, global_bins, bins_size, MPI_DOUBLE, MPI_SUM, mpi_comm);
+    MPIWaitTimer wait_timer;
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT,
+                 recv_counts.data(), 1, MPI_INT,
+                 mpi_comm);
   }
-  else if(reduction_op == "min")
+  int num_recv;
+  std::vector<int> recv_offsets = exclusive_offsets(recv_counts, num_recv);
+
+  std::vector<conduit::int64> recv_ids(num_recv);
+  std::vector<double> recv_vars(num_recv * num_bin_vars);
   {
-    MPI_Allreduce(bins, global_bins, bins_size, MPI_DOUBLE, MPI_MIN, mpi_comm);
+    MPIWaitTimer wait_timer;
+    MPI_Alltoallv(send_ids.data(), send_counts.data(), send_offsets.data(),
+                  MPI_INT64_T,
+                  recv_ids.data(), recv_counts.data(), recv_offsets.data(),
+                  MPI_INT64_T,
+                  mpi_comm);
+    MPI_Alltoallv(send_vars.data(),
+                  scale(send_counts, num_bin_vars).data(),
+                  scale(send_offsets, num_bin_vars).data(),
+                  MPI_DOUBLE,
+                  recv_vars.data(),
+                  scale(recv_counts, num_bin_vars).data(),
+                  scale(recv_offsets, num_bin_vars).data(),
+                  MPI_DOUBLE,
+                  mpi_comm);
   }
-  else if(reduction_op == "max")
+
+  SparseBins owned(bins.m_reduction_op);
+  for(int i = 0; i < num_recv; ++i)
   {
-    MPI_Allreduce(bins, global_bins, bins_size, MPI_DOUBLE, MPI_MAX, mpi_comm);
+    owned.merge(recv_ids[i], &recv_vars[i * num_bin_vars]);
+  }
+
+  // the owners hold disjoint sets of bins, everyone needs all of them
+  int num_owned = static_cast<int>(owned.m_ids.size());
+  std::vector<int> owned_counts(size, 0);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allgather(&num_owned, 1, MPI_INT,
+                  owned_counts.data(), 1, MPI_INT,
+                  mpi_comm);
+  }
+  int num_global;
+  std::vector<int> owned_offsets = exclusive_offsets(owned_counts, num_global);
+
+  bins.m_ids.resize(num_global);
+  bins.m_vars.resize(num_global * num_bin_vars);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allgatherv(owned.m_ids.data(), num_owned, MPI_INT64_T,
+                   bins.m_ids.data(), owned_counts.data(), owned_offsets.data(),
+                   MPI_INT64_T,
+                   mpi_comm);
+    MPI_Allgatherv(owned.m_vars.data(), num_owned * num_bin_vars, MPI_DOUBLE,
+                   bins.m_vars.data(),
+                   scale(owned_counts, num_bin_vars).data(),
+                   scale(owned_offsets, num_bin_vars).data(),
+                   MPI_DOUBLE,
+                   mpi_comm);
   }
-  delete[] bins;
-  bins = global_bins;
 #endif
+  bins.sort();
+}
 
-  conduit::Node res;
-  res["value"].set(conduit::DataType::c_double(num_bins));
-  double *res_bins = res["value"].value();
+} // namespace detail
+
+// turns the variables held by each bin into the result of the reduction
+void
+finalize_bins(const double *bins,
+              const conduit::index_t num_bins,
+              const std::string &reduction_op,
+              const double empty_bin_val,
+              double *res_bins)
+{
   if(reduction_op == "pdf")
   {
     double total = 0;
 #ifdef ASCENT_OPENMP_ENABLED
 #pragma omp parallel for reduction(+ : total)
 #endif
-    for(int i = 0; i < num_bins; ++i)
+    for(conduit::index_t i = 0; i < num_bins; ++i)
     {
       total += bins[2 * i];
     }
 #ifdef ASCENT_OPENMP_ENABLED
 #pragma omp parallel for
 #endif
-    for(int i = 0; i < num_bins; ++i)
+    for(conduit::index_t i = 0; i < num_bins; ++i)
     {
       if(bins[2 * i + 1] == 0)
       {
@@ -1738,7 +2121,7 @@ binning(const conduit::Node &dataset,
 #ifdef ASCENT_OPENMP_ENABLED
 #pragma omp parallel for
 #endif
-    for(int i = 0; i < num_bins; ++i)
+    for(conduit::index_t i = 0; i < num_bins; ++i)
     {
       if(bins[i] == std::numeric_limits<double>::max())
       {
@@ -1755,7 +2138,7 @@ binning(const conduit::Node &dataset,
 #ifdef ASCENT_OPENMP_ENABLED
 #pragma omp parallel for
 #endif
-    for(int i = 0; i < num_bins; ++i)
+    for(conduit::index_t i = 0; i < num_bins; ++i)
     {
       if(bins[i] == std::numeric_limits<double>::lowest())
       {
@@ -1773,7 +2156,7 @@ binning(const conduit::Node &dataset,
 #ifdef ASCENT_OPENMP_ENABLED
 #pragma omp parallel for
 #endif
-    for(int i = 0; i < num_bins; ++i)
+    for(conduit::index_t i = 0; i < num_bins; ++i)
     {
       if(bins[2 * i + 1] == 0)
       {
@@ -1790,7 +2173,7 @@ binning(const conduit::Node &dataset,
 #ifdef ASCENT_OPENMP_ENABLED
 #pragma omp parallel for
 #endif
-    for(int i = 0; i < num_bins; ++i)
+    for(conduit::index_t i = 0; i < num_bins; ++i)
     {
       const double sumX = bins[2 * i];
       const double n = bins[2 * i + 1];
@@ -1809,7 +2192,7 @@ binning(const conduit::Node &dataset,
 #ifdef ASCENT_OPENMP_ENABLED
 #pragma omp parallel for
 #endif
-    for(int i = 0; i < num_bins; ++i)
+    for(conduit::index_t i = 0; i < num_bins; ++i)
     {
       const double sumX = bins[2 * i];
       const double n = bins[2 * i + 1];
@@ -1828,7 +2211,7 @@ binning(const conduit::Node &dataset,
 #ifdef ASCENT_OPENMP_ENABLED
 #pragma omp parallel for
 #endif
-    for(int i = 0; i < num_bins; ++i)
+    for(conduit::index_t i = 0; i < num_bins; ++i)
     {
       const double sumX2 = bins[3 * i];
       const double sumX = bins[3 * i + 1];
@@ -1848,7 +2231,7 @@ binning(const conduit::Node &dataset,
 #ifdef ASCENT_OPENMP_ENABLED
 #pragma omp parallel for
 #endif
-    for(int i = 0; i < num_bins; ++i)
+    for(conduit::index_t i = 0; i < num_bins; ++i)
     {
       const double sumX2 = bins[3 * i];
       const double sumX = bins[3 * i + 1];
@@ -1863,8 +2246,318 @@ binning(const conduit::Node &dataset,
       }
     }
   }
+}
+
+//
+// NOTE THERE IS A RAJA VERSION IN ascent_data_binning
+// that we want to supercede this one, it needs more work.
+//
+
+conduit::Node
+binning(const conduit::Node &dataset,
+        conduit::Node &bin_axes,
+        const std::string &reduction_var,
+        const std::string &reduction_op,
+        const double empty_bin_val,
+        const std::string &component,
+        const bool sparse,
+        const bool sparse_output)
+{
+  std::vector<std::string> var_names = bin_axes.child_names();
+  if(!reduction_var.empty())
+  {
+    var_names.push_back(reduction_var);
+  }
+  const conduit::Node &topo_and_assoc =
+      global_topo_and_assoc(dataset, var_names);
+  const std::string topo_name = topo_and_assoc["topo_name"].as_string();
+  const std::string assoc_str = topo_and_assoc["assoc_str"].as_string();
+
+  const conduit::Node &bounds = global_bounds(dataset, topo_name);
+  const double *min_coords = bounds["min_coords"].value();
+  const double *max_coords = bounds["max_coords"].value();
+  const std::string axes[3][3] = {
+      {"x", "i", "dx"}, {"y", "j", "dy"}, {"z", "k", "dz"}};
+  // populate min_val, max_val, for x,y,z
+  for(int axis_num = 0; axis_num < 3; ++axis_num)
+  {
+    if(bin_axes.has_path(axes[axis_num][0]))
+    {
+      conduit::Node &axis = bin_axes[axes[axis_num][0]];
+
+      if(axis.has_path("bins"))
+      {
+        // rectilinear binning was specified
+        continue;
+      }
+
+      if(min_coords[axis_num] == std::numeric_limits<double>::max())
+      {
+        ASCENT_ERROR("Could not finds bounds for axis: "
+                     << axes[axis_num][0]
+                     << ". It probably doesn't exist in the topology: "
+                     << topo_name);
+      }
+
+      if(!axis.has_path("min_val"))
+      {
+        axis["min_val"] = min_coords[axis_num];
+      }
+
+      if(!axis.has_path("max_val"))
+      {
+        // We add eps because the last bin isn't inclusive
+        double min_val = axis["min_val"].to_float64();
+        double length = max_coords[axis_num] - min_val;
+        double eps = length * 1e-8;
+        axis["max_val"] = max_coords[axis_num] + eps;
+      }
+    }
+  }
+
+  int num_axes = bin_axes.number_of_children();
+
+  // fill in the axis ranges
+  for(int axis_index = 0; axis_index < num_axes; ++axis_index)
+  {
+    conduit::Node &axis = bin_axes.child(axis_index);
+    const std::string axis_name = axis.name();
+
+    if(!bin_axes.child(axis_index).has_child("min_val"))
+    {
+      axis["min_val"] = field_min(dataset, axis_name)["value"].to_float64();
+    }
+    if(!axis.has_child("max_val"))
+    {
+      // TODO: FIXME THE BASELINES REQUIRE +1 here, not good.
+      axis["max_val"] = field_max(dataset, axis_name)["value"].to_float64() + 1.0;
+    }
+  }
+
+  const index_t num_bins = detail::total_bins(bin_axes);
+  const int num_bin_vars = detail::num_bin_vars(reduction_op);
+  const index_t bins_size = num_bins * num_bin_vars;
+
+  // dense bins hold every bin, sparse bins only the ones that get a value
+  double *bins = nullptr;
+  detail::SparseBins sparse_bins(reduction_op);
+  if(!sparse)
+  {
+    bins = new double[bins_size]();
+    init_bins(bins, bins_size, reduction_op);
+  }
+
+  auto add_value = [&](const conduit::int64 home, const double value)
+  {
+    if(sparse)
+    {
+      sparse_bins.update(home, value);
+    }
+    else
+    {
+      update_bin(bins, home, value, reduction_op);
+    }
+  };
+
+  for(int dom_index = 0; dom_index < dataset.number_of_children(); ++dom_index)
+  {
+    const conduit::Node &dom = dataset.child(dom_index);
+    if(!dom.has_path("topologies/"+topo_name))
+    {
+      continue;
+    }
+
+    conduit::Node n_homes;
+    populate_homes(dom, bin_axes, topo_name, assoc_str, n_homes);
+
+    if(n_homes.has_path("error"))
+    {
+      ASCENT_INFO("Binning: not binning domain "
+                  << dom_index << " because field: '"
+                  << n_homes["error/field_name"].to_string()
+                  << "' was not found.");
+      continue;
+    }
+    const conduit::int64 *homes = n_homes.as_int64_ptr();
+    const index_t homes_size = n_homes.dtype().number_of_elements();
+
+    // update bins
+    if(reduction_var.empty())
+    {
+//#ifdef ASCENT_OPENMP_ENABLED
+//#pragma omp parallel for
+//#endif
+      for(index_t i = 0; i < homes_size; ++i)
+      {
+        if(homes[i] != -1)
+        {
+          add_value(homes[i], 1);
+        }
+      }
+    }
+    else if(dom.has_path("fields/" + reduction_var))
+    {
+      const std::string comp_path = component == "" ? "" : "/" + component;
+      const std::string values_path
+        = "fields/" + reduction_var + "/values" + comp_path;
+
+      if(dom[values_path].dtype().is_float32())
+      {
+        const conduit::float32_array values = dom[values_path].value();
+//#ifdef ASCENT_OPENMP_ENABLED
+//#pragma omp parallel for
+//#endif
+        for(index_t i = 0; i < homes_size; ++i)
+        {
+          if(homes[i] != -1)
+          {
+            add_value(homes[i], values[i]);
+          }
+        }
+      }
+      else
+      {
+        const conduit::float64_array values = dom[values_path].value();
+//#ifdef ASCENT_OPENMP_ENABLED
+//#pragma omp parallel for
+//#endif
+        for(index_t i = 0; i < homes_size; ++i)
+        {
+          if(homes[i] != -1)
+          {
+            add_value(homes[i], values[i]);
+          }
+        }
+      }
+    }
+    else if(is_xyz(reduction_var))
+    {
+      int coord = reduction_var[0] - 'x';
+//#ifdef ASCENT_OPENMP_ENABLED
+//#pragma omp parallel for
+//#endif
+      for(index_t i = 0; i < homes_size; ++i)
+      {
+        conduit::Node n_loc;
+        if(assoc_str == "vertex")
+        {
+          n_loc = vert_location(dom, i, topo_name);
+        }
+        else if(assoc_str == "element")
+        {
+          n_loc = element_location(dom, i, topo_name);
+        }
+        const double *loc = n_loc.value();
+        if(homes[i] != -1)
+        {
+          add_value(homes[i], loc[coord]);
+        }
+      }
+    }
+    else
+    {
+      ASCENT_INFO("Binning: not binning domain "
+                  << dom_index << " because field: '" << reduction_var
+                  << "' was not found.");
+    }
+  }
+
+  conduit::Node res;
+  if(sparse)
+  {
+    detail::exchange_sparse_bins(sparse_bins);
+    const index_t num_occupied = sparse_bins.m_ids.size();
+    if(sparse_output)
+    {
+      res["bin_ids"].set(sparse_bins.m_ids);
+      res["value"].set(conduit::DataType::c_double(num_occupied));
+      double *res_bins = res["value"].value();
+      finalize_bins(sparse_bins.m_vars.data(),
+                    num_occupied,
+                    reduction_op,
+                    empty_bin_val,
+                    res_bins);
+    }
+    else
+    {
+      std::vector<double> occupied(num_occupied);
+      finalize_bins(sparse_bins.m_vars.data(),
+                    num_occupied,
+                    reduction_op,
+                    empty_bin_val,
+                    occupied.data());
+      res["value"].set(conduit::DataType::c_double(num_bins));
+      double *res_bins = res["value"].value();
+      std::fill(res_bins, res_bins + num_bins, empty_bin_val);
+      for(index_t i = 0; i < num_occupied; ++i)
+      {
+        res_bins[sparse_bins.m_ids[i]] = occupied[i];
+      }
+    }
+  }
+  else
+  {
+#ifdef ASCENT_MPI_ENABLED
+    MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+    double *global_bins = new double[bins_size];
+    if(reduction_op == "sum" || reduction_op == "pdf" || reduction_op == "avg" ||
+       reduction_op == "std" || reduction_op == "var" || reduction_op == "rms")
+    {
+      MPIWaitTimer wait_timer;
+      MPI_Allreduce(bins, global_bins, bins_size, MPI_DOUBLE, MPI_SUM, mpi_comm);
+    }
+    else if(reduction_op == "min")
+    {
+      MPIWaitTimer wait_timer;
+      MPI_Allreduce(bins, global_bins, bins_size, MPI_DOUBLE, MPI_MIN, mpi_comm);
+    }
+    else if(reduction_op == "max")
+    {
+      MPIWaitTimer wait_timer;
+      MPI_Allreduce(bins, global_bins, bins_size, MPI_DOUBLE, MPI_MAX, mpi_comm);
+    }
+    delete[] bins;
+    bins = global_bins;
+#endif
+    res["value"].set(conduit::DataType::c_double(num_bins));
+    double *res_bins = res["value"].value();
+    finalize_bins(bins, num_bins, reduction_op, empty_bin_val, res_bins);
+    delete[] bins;
+  }
   res["association"] = assoc_str;
-  delete[] bins;
+  res["empty_bin_val"] = empty_bin_val;
+  return res;
+}
+
+//
+// bin values of a binning with one value per bin, the occupied
+// bins of a sparse binning are spread out over the empty ones
+//
+conduit::Node
+dense_bin_values(const conduit::Node &binning)
+{
+  conduit::Node res;
+  if(!binning.has_path("attrs/bin_ids"))
+  {
+    res.set(binning["attrs/value/value"]);
+    return res;
+  }
+
+  const conduit::index_t num_bins =
+      detail::total_bins(binning["attrs/bin_axes/value"]);
+  const conduit::int64_array bin_ids = binning["attrs/bin_ids/value"].value();
+  const double *values = binning["attrs/value/value"].as_double_ptr();
+  const conduit::index_t num_occupied = bin_ids.number_of_elements();
+
+  res.set(conduit::DataType::c_double(num_bins));
+  double *res_bins = res.value();
+  std::fill(res_bins,
+            res_bins + num_bins,
+            binning["attrs/empty_bin_val/value"].to_float64());
+  for(conduit::index_t i = 0; i < num_occupied; ++i)
+  {
+    res_bins[bin_ids[i]] = values[i];
+  }
   return res;
 }
 
@@ -1901,6 +2594,18 @@ paint_binning(const conduit::Node &binning,
 
   const double *bins = binning["attrs/value/value"].as_double_ptr();
 
+  // sparse binnings only hold the occupied bins, ordered by bin id
+  const bool sparse = binning.has_path("attrs/bin_ids");
+  const conduit::int64 *bin_ids = nullptr;
+  conduit::index_t num_occupied = 0;
+  double empty_bin_val = 0.;
+  if(sparse)
+  {
+    bin_ids = binning["attrs/bin_ids/value"].as_int64_ptr();
+    num_occupied = binning["attrs/bin_ids/value"].dtype().number_of_elements();
+    empty_bin_val = binning["attrs/empty_bin_val/value"].to_float64();
+  }
+
   for(int dom_index = 0; dom_index < dataset.number_of_children(); ++dom_index)
   {
     conduit::Node &dom = dataset.child(dom_index);
@@ -1915,8 +2620,8 @@ paint_binning(const conduit::Node &binning,
                   << "' was not found.");
       continue;
     }
-    const int *homes = n_homes.as_int_ptr();
-    const int homes_size = n_homes.dtype().number_of_elements();
+    const conduit::int64 *homes = n_homes.as_int64_ptr();
+    const conduit::index_t homes_size = n_homes.dtype().number_of_elements();
 
     std::string reduction_var =
         binning["attrs/reduction_var/value"].as_string();
@@ -1942,9 +2647,25 @@ paint_binning(const conduit::Node &binning,
 #ifdef ASCENT_OPENMP_ENABLED
 #pragma omp parallel for
 #endif
-    for(int i = 0; i < homes_size; ++i)
+    for(conduit::index_t i = 0; i < homes_size; ++i)
     {
-      values[i] = bins[homes[i]];
+      if(sparse)
+      {
+        const conduit::int64 *occupied =
+            std::lower_bound(bin_ids, bin_ids + num_occupied, homes[i]);
+        if(occupied != bin_ids + num_occupied && *occupied == homes[i])
+        {
+          values[i] = bins[occupied - bin_ids];
+        }
+        else
+        {
+          values[i] = empty_bin_val;
+        }
+      }
+      else
+      {
+        values[i] = bins[homes[i]];
+      }
     }
   }
 
@@ -2019,7 +2740,7 @@ binning_mesh(const conduit::Node &binning,
   }
   mesh["fields/" + fname + "/association"] = "element";
   mesh["fields/" + fname + "/topology"] = "binning_topo";
-  mesh["fields/" + fname + "/values"].set(binning["attrs/value/value"]);
+  mesh["fields/" + fname + "/values"].set(dense_bin_values(binning));
 
   conduit::Node info;
   if(!conduit::blueprint::verify("mesh", mesh, info))
@@ -2288,17 +3009,23 @@ field_min(const conduit::Node &dataset, const std::string &field)
 
   MinLoc minloc = {min_value, rank};
   MinLoc minloc_res;
-  MPI_Allreduce(&minloc, &minloc_res, 1, MPI_DOUBLE_INT, MPI_MINLOC, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce(&minloc, &minloc_res, 1, MPI_DOUBLE_INT, MPI_MINLOC, mpi_comm);
+  }
   min_value = minloc_res.value;
 
   double *ploc = loc.as_float64_ptr();
-  MPI_Bcast(ploc, 3, MPI_DOUBLE, minloc_res.rank, mpi_comm);
-  MPI_Bcast(&domain_id, 1, MPI_INT, minloc_res.rank, mpi_comm);
-  MPI_Bcast(&index, 1, MPI_INT, minloc_res.rank, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Bcast(ploc, 3, MPI_DOUBLE, minloc_res.rank, mpi_comm);
+    MPI_Bcast(&domain_id, 1, MPI_INT, minloc_res.rank, mpi_comm);
+    MPI_Bcast(&index, 1, MPI_INT, minloc_res.rank, mpi_comm);
 
-  // make sure everyone has the same assoc even if they
-  // didn't have the data
-  MPI_Bcast(&assoc_int, 1, MPI_INT, minloc_res.rank, mpi_comm);
+    // make sure everyone has the same assoc even if they
+    // didn't have the data
+    MPI_Bcast(&assoc_int, 1, MPI_INT, minloc_res.rank, mpi_comm);
+  }
 
   loc.set(ploc, 3);
 
@@ -2343,10 +3070,12 @@ field_sum(const conduit::Node &dataset, const std::string &field)
   MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
   MPI_Comm_rank(mpi_comm, &rank);
   double global_sum;
-  MPI_Allreduce(&sum, &global_sum, 1, MPI_DOUBLE, MPI_SUM, mpi_comm);
-
   long long int global_count;
-  MPI_Allreduce(&count, &global_count, 1, MPI_LONG_LONG_INT, MPI_SUM, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce(&sum, &global_sum, 1, MPI_DOUBLE, MPI_SUM, mpi_comm);
+    MPI_Allreduce(&count, &global_count, 1, MPI_LONG_LONG_INT, MPI_SUM, mpi_comm);
+  }
 
   sum = global_sum;
   count = global_count;
@@ -2442,17 +3171,23 @@ field_max(const conduit::Node &dataset, const std::string &field)
 
   MaxLoc maxloc = {max_value, rank};
   MaxLoc maxloc_res;
-  MPI_Allreduce(&maxloc, &maxloc_res, 1, MPI_DOUBLE_INT, MPI_MAXLOC, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce(&maxloc, &maxloc_res, 1, MPI_DOUBLE_INT, MPI_MAXLOC, mpi_comm);
+  }
   max_value = maxloc_res.value;
 
   double *ploc = loc.as_float64_ptr();
-  MPI_Bcast(ploc, 3, MPI_DOUBLE, maxloc_res.rank, mpi_comm);
-  MPI_Bcast(&domain_id, 1, MPI_INT, maxloc_res.rank, mpi_comm);
-  MPI_Bcast(&index, 1, MPI_INT, maxloc_res.rank, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Bcast(ploc, 3, MPI_DOUBLE, maxloc_res.rank, mpi_comm);
+    MPI_Bcast(&domain_id, 1, MPI_INT, maxloc_res.rank, mpi_comm);
+    MPI_Bcast(&index, 1, MPI_INT, maxloc_res.rank, mpi_comm);
 
-  // make sure everyone has the same assoc even if they
-  // didn't have the data
-  MPI_Bcast(&assoc_int, 1, MPI_INT, maxloc_res.rank, mpi_comm);
+    // make sure everyone has the same assoc even if they
+    // didn't have the data
+    MPI_Bcast(&assoc_int, 1, MPI_INT, maxloc_res.rank, mpi_comm);
+  }
 
   loc.set(ploc, 3);
   rank = maxloc_res.rank;
@@ -78,6 +78,23 @@ conduit::Node field_histogram(const conduit::Node &dataset,
                               const double &max_val,
                               const int &num_bins);
 
+// mergeable quantile sketch of the field values, each bucket spans a
+// relative_accuracy neighborhood of its value. Sketches are cached until
+// clear_quantile_sketch_cache() is called, so several quantiles of the
+// same field share one pass.
+ASCENT_API
+conduit::Node field_quantile_sketch(const conduit::Node &dataset,
+                                    const std::string &field,
+                                    const double &relative_accuracy);
+
+// drops all cached sketches, the runtime calls this before every execute
+ASCENT_API
+void clear_quantile_sketch_cache();
+
+ASCENT_API
+conduit::Node sketch_quantile(const conduit::Node &sketch,
+                              const double val);
+
 ASCENT_API
 conduit::Node histogram_entropy(const conduit::Node &hist);
 
@@ -96,6 +113,10 @@ conduit::Node global_bounds(const conduit::Node &dataset,
 // of binning that needs more work, but should eventually
 // supersede these versions
 // 
+// sparse binnings only keep and exchange the bins that get a value.
+// With sparse_output the result stays sparse, "bin_ids" holds the
+// sorted ids of the occupied bins and "value" their values.
+//
 
 ASCENT_API
 conduit::Node binning(const conduit::Node &dataset,
@@ -103,7 +124,13 @@ conduit::Node binning(const conduit::Node &dataset,
                       const std::string &reduction_var,
                       const std::string &reduction_op,
                       const double empty_bin_val,
-                      const std::string &component);
+                      const std::string &component,
+                      const bool sparse = false,
+                      const bool sparse_output = false);
+
+// one value per bin, expands the occupied bins of a sparse binning
+ASCENT_API
+conduit::Node dense_bin_values(const conduit::Node &binning);
 
 ASCENT_API
 void ASCENT_API paint_binning(const conduit::Node &binning,
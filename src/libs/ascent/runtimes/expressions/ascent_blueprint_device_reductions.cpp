@@ -22,6 +22,7 @@
 
 #include <ascent_logging.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <cmath>
 #include <limits>
@@ -289,6 +290,162 @@ struct HistogramFunctor
   }
 };
 
+//
+// Fills a log bucketed quantile sketch (DDSketch) of the values.
+// Values are mapped to key ceil(log_gamma(|v|)) in a positive or a
+// negative store, so every bucket has the same relative width. A first
+// pass finds the range of keys that are hit and a second one counts
+// the values into a window over that range. The window holds at most
+// quantile_sketch_max_keys keys per store; keys below it are collapsed
+// into its lowest key, which only costs accuracy for the magnitudes
+// closest to zero when the data spans a very wide range.
+//
+struct QuantileSketchFunctor
+{
+  double m_relative_accuracy;
+  QuantileSketchFunctor(const double &relative_accuracy)
+    : m_relative_accuracy(relative_accuracy)
+  {}
+
+  template<typename T, typename Exec>
+  conduit::Node operator()(const DeviceAccessor<T> accessor,
+                           const Exec &) const
+  {
+    const int size = accessor.m_size;
+    const double gamma = (1. + m_relative_accuracy) / (1. - m_relative_accuracy);
+    const double inv_log_gamma = 1. / std::log(gamma);
+    // magnitudes below this go to the zero bucket
+    const double min_indexable = std::numeric_limits<double>::min();
+    const int key_offset = static_cast<int>(std::floor(std::log(min_indexable) * inv_log_gamma));
+    const int max_key = static_cast<int>(std::ceil(std::log(std::numeric_limits<double>::max()) *
+                                                   inv_log_gamma));
+    const int num_keys = max_key - key_offset + 1;
+
+    using for_policy    = typename Exec::for_policy;
+    using reduce_policy = typename Exec::reduce_policy;
+    using atomic_policy = typename Exec::atomic_policy;
+
+    ascent::ReduceMin<reduce_policy,int> pos_lo(num_keys);
+    ascent::ReduceMax<reduce_policy,int> pos_hi(-1);
+    ascent::ReduceMin<reduce_policy,int> neg_lo(num_keys);
+    ascent::ReduceMax<reduce_policy,int> neg_hi(-1);
+    ascent::ReduceSum<reduce_policy,index_t> zeros(0);
+    ascent::ReduceSum<reduce_policy,index_t> count(0);
+    ascent::ReduceMin<reduce_policy,double> min_val(std::numeric_limits<double>::max());
+    ascent::ReduceMax<reduce_policy,double> max_val(std::numeric_limits<double>::lowest());
+
+    ascent::forall<for_policy>(0, size, [=] ASCENT_LAMBDA(index_t i)
+    {
+      const double val = static_cast<double>(accessor[i]);
+      if(val != val)
+      {
+        // nans are not part of the distribution
+        return;
+      }
+      count += 1;
+      min_val.min(val);
+      max_val.max(val);
+      const double mag = val < 0. ? -val : val;
+      if(mag < min_indexable)
+      {
+        zeros += 1;
+        return;
+      }
+      int key = static_cast<int>(ceil(log(mag) * inv_log_gamma)) - key_offset;
+      // infs land in the last key
+      key = max(0, min(key, num_keys - 1));
+      if(val > 0.)
+      {
+        pos_lo.min(key);
+        pos_hi.max(key);
+      }
+      else
+      {
+        neg_lo.min(key);
+        neg_hi.max(key);
+      }
+    });
+    ASCENT_DEVICE_ERROR_CHECK();
+
+    // positive store then negative store
+    int lo[2] = {pos_lo.get(), neg_lo.get()};
+    const int hi[2] = {pos_hi.get(), neg_hi.get()};
+    int window[2] = {0, 0};
+    for(int s = 0; s < 2; ++s)
+    {
+      if(hi[s] >= lo[s])
+      {
+        lo[s] = std::max(lo[s], hi[s] - quantile_sketch_max_keys + 1);
+        window[s] = hi[s] - lo[s] + 1;
+      }
+    }
+
+    conduit::Node res;
+    res["relative_accuracy"] = m_relative_accuracy;
+    res["count"] = (conduit::int64) count.get();
+    res["zero_count"] = (conduit::int64) zeros.get();
+    res["min_val"] = min_val.get();
+    res["max_val"] = max_val.get();
+
+    const int num_bins = window[0] + window[1];
+    Array<double> bins;
+    if(num_bins > 0)
+    {
+      bins.resize(num_bins);
+      double *bins_ptr = bins.get_ptr(Exec::memory_space);
+      ascent::forall<for_policy>(0, num_bins, [=] ASCENT_LAMBDA(index_t i)
+      {
+        bins_ptr[i] = 0.0;
+      });
+      ASCENT_DEVICE_ERROR_CHECK();
+
+      const int pos_lo_key = lo[0];
+      const int neg_lo_key = lo[1];
+      const int neg_start = window[0];
+      ascent::forall<for_policy>(0, size, [=] ASCENT_LAMBDA(index_t i)
+      {
+        const double val = static_cast<double>(accessor[i]);
+        const double mag = val < 0. ? -val : val;
+        if(val != val || mag < min_indexable)
+        {
+          return;
+        }
+        int key = static_cast<int>(ceil(log(mag) * inv_log_gamma)) - key_offset;
+        key = min(key, num_keys - 1);
+        if(val > 0.)
+        {
+          key = max(key, pos_lo_key);
+          ascent::atomic_add<atomic_policy>(&(bins_ptr[key - pos_lo_key]), 1.);
+        }
+        else
+        {
+          key = max(key, neg_lo_key);
+          ascent::atomic_add<atomic_policy>(&(bins_ptr[neg_start + key - neg_lo_key]), 1.);
+        }
+      });
+      ASCENT_DEVICE_ERROR_CHECK();
+    }
+
+    const std::string stores[2] = {"positive", "negative"};
+    int start = 0;
+    for(int s = 0; s < 2; ++s)
+    {
+      conduit::Node &store = res[stores[s]];
+      if(window[s] == 0)
+      {
+        store["offset"] = 0;
+        store["counts"].set(conduit::DataType::float64(0));
+        continue;
+      }
+      const double *host_bins = bins.get_host_ptr_const();
+      store["offset"] = lo[s] + key_offset;
+      store["counts"].set(host_bins + start, window[s]);
+      start += window[s];
+    }
+    return res;
+  }
+};
+
 ////////////////////////////////////////////////////////////////////////////////////
 // TODO THIS NEEDS TO BE RAJAFIED
 struct HistoryGradientRangeFunctor
@@ -389,6 +546,15 @@ field_reduction_histogram(const conduit::Node &field,
   return exec_dispatch_mcarray_component(field["values"], component, histogram);
 }
 
+conduit::Node
+field_reduction_quantile_sketch(const conduit::Node &field,
+                                const double &relative_accuracy,
+                                const std::string &component)
+{
+  detail::QuantileSketchFunctor sketch(relative_accuracy);
+  return exec_dispatch_mcarray_component(field["values"], component, sketch);
+}
+
 conduit::Node
 array_max(const conduit::Node &array,
           const std::string &exec_loc,
@@ -62,6 +62,16 @@ conduit::Node ASCENT_API field_reduction_histogram(const conduit::Node &field,
                                         const int &num_bins,
                                         const std::string &component = "");
 
+// stores of a quantile sketch keep at most this many keys, lower keys
+// are collapsed into the lowest one that is kept
+const int quantile_sketch_max_keys = 1 << 16;
+
+// log bucketed quantile sketch of the field values, the stores hold the
+// counts of a window of keys starting at "offset"
+conduit::Node ASCENT_API field_reduction_quantile_sketch(const conduit::Node &field,
+                                              const double &relative_accuracy,
+                                              const std::string &component = "");
+
 conduit::Node ASCENT_API array_max(const conduit::Node &array,
                         const std::string &exec_loc,
                         const std::string &component = "");
@@ -681,6 +681,8 @@ void binning_interface(const std::string &reduction_var,
                        const std::string &reduction_op,
                        const conduit::Node &n_empty_bin_val,
                        const conduit::Node &n_component,
+                       const conduit::Node &n_sparse,
+                       const conduit::Node &n_sparse_output,
                        const conduit::Node &n_axis_list,
                        conduit::Node &dataset,
                        conduit::Node &n_binning,
@@ -794,12 +796,30 @@ void binning_interface(const std::string &reduction_var,
     empty_bin_val = n_empty_bin_val["value"].to_float64();
   }
 
+  bool sparse = false;
+  if(!n_sparse.dtype().is_empty())
+  {
+    sparse = n_sparse["value"].to_int32() != 0;
+  }
+
+  bool sparse_output = false;
+  if(!n_sparse_output.dtype().is_empty())
+  {
+    sparse_output = n_sparse_output["value"].to_int32() != 0;
+    if(sparse_output && !sparse)
+    {
+      ASCENT_ERROR("Binning: 'sparse_output' requires 'sparse' binning.");
+    }
+  }
+
   n_binning = binning(dataset,
                       n_output_axes,
                       reduction_var,
                       reduction_op,
                       empty_bin_val,
-                      component);
+                      component,
+                      sparse,
+                      sparse_output);
 
   // // TODO THIS IS THE RAJA VERSION
   // std::map<int, Array<int>> bindexes;
@@ -3153,6 +3173,154 @@ ExprHistogramCDFQuantile::execute()
 }
 
 
+//*****************************************************************************
+// ExprQuantileSketch
+//*****************************************************************************
+
+//-----------------------------------------------------------------------------
+ExprQuantileSketch::ExprQuantileSketch()
+: Filter()
+{
+  // empty
+}
+
+//-----------------------------------------------------------------------------
+ExprQuantileSketch::~ExprQuantileSketch()
+{
+  // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+ExprQuantileSketch::declare_interface(Node &i)
+{
+  i["type_name"] = "expr_quantile_sketch";
+  i["port_names"].append() = "arg1";
+  i["port_names"].append() = "relative_accuracy";
+  i["output_port"] = "true";
+}
+
+//-----------------------------------------------------------------------------
+bool
+ExprQuantileSketch::verify_params(const conduit::Node &params, conduit::Node &info)
+{
+  info.reset();
+  bool res = true;
+  return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+ExprQuantileSketch::execute()
+{
+  const conduit::Node *arg1 = input<Node>("arg1");
+  // optional inputs
+  const conduit::Node *n_accuracy = input<Node>("relative_accuracy");
+
+  const std::string field = (*arg1)["value"].as_string();
+
+  DataObject *data_object =
+    graph().workspace().registry().fetch<DataObject>("dataset");
+  const conduit::Node *const dataset = data_object->as_low_order_bp().get();
+
+  if(!is_scalar_field(*dataset, field))
+  {
+    ASCENT_ERROR("Quantile Sketch: the sketch must be of a scalar field. "
+                 "Invalid field: '"
+                 << field << "'.");
+  }
+
+  double accuracy = 0.01;
+  if(!n_accuracy->dtype().is_empty())
+  {
+    accuracy = (*n_accuracy)["value"].to_float64();
+  }
+
+  if(accuracy <= 0 || accuracy >= 1)
+  {
+    ASCENT_ERROR("Quantile Sketch: relative_accuracy must be between 0 and 1");
+  }
+
+  conduit::Node sketch = field_quantile_sketch(*dataset, field, accuracy);
+
+  conduit::Node *output = new conduit::Node();
+  (*output)["type"] = "quantile_sketch";
+  (*output)["attrs/sketch/value"] = sketch;
+  (*output)["attrs/sketch/type"] = "sketch";
+  (*output)["attrs/count/value"] = sketch["count"].to_float64();
+  (*output)["attrs/count/type"] = "double";
+  (*output)["attrs/min_val/value"] = sketch["min_val"];
+  (*output)["attrs/min_val/type"] = "double";
+  (*output)["attrs/max_val/value"] = sketch["max_val"];
+  (*output)["attrs/max_val/type"] = "double";
+  (*output)["attrs/relative_accuracy/value"] = accuracy;
+  (*output)["attrs/relative_accuracy/type"] = "double";
+
+  resolve_symbol_result(graph(), output, this->name());
+  set_output<conduit::Node>(output);
+}
+
+//*****************************************************************************
+// ExprQuantileSketchQuantile
+//*****************************************************************************
+
+//-----------------------------------------------------------------------------
+ExprQuantileSketchQuantile::ExprQuantileSketchQuantile()
+: Filter()
+{
+  // empty
+}
+
+//-----------------------------------------------------------------------------
+ExprQuantileSketchQuantile::~ExprQuantileSketchQuantile()
+{
+  // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+ExprQuantileSketchQuantile::declare_interface(Node &i)
+{
+  i["type_name"] = "expr_quantile_sketch_quantile";
+  i["port_names"].append() = "sketch";
+  i["port_names"].append() = "q";
+  i["output_port"] = "true";
+}
+
+//-----------------------------------------------------------------------------
+bool
+ExprQuantileSketchQuantile::verify_params(const conduit::Node &params,
+                                          conduit::Node &info)
+{
+  info.reset();
+  bool res = true;
+  return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+ExprQuantileSketchQuantile::execute()
+{
+  const conduit::Node *n_sketch = input<conduit::Node>("sketch");
+  const conduit::Node *n_val = input<conduit::Node>("q");
+
+  const double val = (*n_val)["value"].to_float64();
+
+  if(val < 0 || val > 1)
+  {
+    ASCENT_ERROR("Quantile: val must be between 0 and 1");
+  }
+
+  conduit::Node *output = new conduit::Node();
+  (*output)["value"] =
+    sketch_quantile((*n_sketch)["attrs/sketch/value"], val)["value"];
+  (*output)["type"] = "double";
+
+  resolve_symbol_result(graph(), output, this->name());
+  set_output<conduit::Node>(output);
+}
+
+
 //*****************************************************************************
 // ExprHistogramBinByIndex
 //*****************************************************************************
@@ -4273,6 +4441,8 @@ ExprMeshBinning::declare_interface(Node &i)
   i["port_names"].append() = "bin_axes";
   i["port_names"].append() = "empty_bin_val";
   i["port_names"].append() = "component";
+  i["port_names"].append() = "sparse";
+  i["port_names"].append() = "sparse_output";
   i["output_port"] = "true";
 }
 
@@ -4302,6 +4472,8 @@ ExprMeshBinning::execute()
   // optional arguments
   const conduit::Node *n_empty_bin_val = input<conduit::Node>("empty_bin_val");
   const conduit::Node *n_component = input<conduit::Node>("component");
+  const conduit::Node *n_sparse = input<conduit::Node>("sparse");
+  const conduit::Node *n_sparse_output = input<conduit::Node>("sparse_output");
 
   conduit::Node n_binning;
   conduit::Node n_bin_axes;
@@ -4310,6 +4482,8 @@ ExprMeshBinning::execute()
                     reduction_op,
                     *n_empty_bin_val,
                     *n_component,
+                    *n_sparse,
+                    *n_sparse_output,
                     *n_axes_list,
                     *dataset,
                     n_binning,
@@ -4327,6 +4501,13 @@ ExprMeshBinning::execute()
   //(*output)["attrs/bin_axes/type"] = "list";
   (*output)["attrs/association/value"] = n_binning["association"];
   (*output)["attrs/association/type"] = "string";
+  (*output)["attrs/empty_bin_val/value"] = n_binning["empty_bin_val"];
+  (*output)["attrs/empty_bin_val/type"] = "double";
+  if(n_binning.has_path("bin_ids"))
+  {
+    (*output)["attrs/bin_ids/value"] = n_binning["bin_ids"];
+    (*output)["attrs/bin_ids/type"] = "array";
+  }
 
   resolve_symbol_result(graph(), output, this->name());
   set_output<conduit::Node>(output);
@@ -4582,7 +4763,8 @@ ExprMeshBinningBinByIndex::execute()
   const double min_val = axis["min_val"].to_float64();
   const double max_val = axis["max_val"].to_float64();
   const double bin_size = (max_val - min_val) / double(num_bins);
-  double *bins = in_binning["attrs/value/value"].value();
+  conduit::Node n_bins = dense_bin_values(in_binning);
+  double *bins = n_bins.value();
 
   double left = min_val + double(bindex) * bin_size;
   double right = min_val + double(bindex+1) * bin_size;
@@ -4686,7 +4868,8 @@ ExprMeshBinningPointAndAxis::execute()
   const double max_val = axis["max_val"].to_float64();
   const double bin_size = (max_val - min_val) / double(num_bins);
 
-  double *bins = in_binning["attrs/value/value"].value();
+  conduit::Node n_bins = dense_bin_values(in_binning);
+  double *bins = n_bins.value();
   double min_dist = std::numeric_limits<double>::max();
   int index = -1;
   for(int i = 0; i < num_bins; ++i)
@@ -4808,7 +4991,8 @@ ExprMeshBinningMaxFromPoint::execute()
   const double max_val = axis["max_val"].to_float64();
   const double bin_size = (max_val - min_val) / double(num_bins);
 
-  double *bins = in_binning["attrs/value/value"].value();
+  conduit::Node n_bins = dense_bin_values(in_binning);
+  double *bins = n_bins.value();
   double max_bin_val = std::numeric_limits<double>::lowest();
   double dist_value = 0;
   double min_dist = std::numeric_limits<double>::max();
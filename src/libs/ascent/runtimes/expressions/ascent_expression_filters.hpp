@@ -52,6 +52,8 @@ void binning_interface(const std::string &reduction_var,
                        const std::string &reduction_op,
                        const conduit::Node &n_empty_bin_val,
                        const conduit::Node &n_component,
+                       const conduit::Node &n_sparse,
+                       const conduit::Node &n_sparse_output,
                        const conduit::Node &n_axis_list,
                        conduit::Node &dataset,
                        conduit::Node &n_binning,
@@ -511,6 +513,30 @@ public:
 };
 
 
+//-----------------------------------------------------------------------------
+class ExprQuantileSketch : public ::flow::Filter
+{
+public:
+  ExprQuantileSketch();
+  ~ExprQuantileSketch();
+
+  virtual void declare_interface(conduit::Node &i);
+  virtual bool verify_params(const conduit::Node &params, conduit::Node &info);
+  virtual void execute();
+};
+
+//-----------------------------------------------------------------------------
+class ExprQuantileSketchQuantile : public ::flow::Filter
+{
+public:
+  ExprQuantileSketchQuantile();
+  ~ExprQuantileSketchQuantile();
+
+  virtual void declare_interface(conduit::Node &i);
+  virtual bool verify_params(const conduit::Node &params, conduit::Node &info);
+  virtual void execute();
+};
+
 //-----------------------------------------------------------------------------
 class ExprHistogramBinByIndex : public ::flow::Filter
 {
@@ -0,0 +1,324 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_expression_history.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_expression_history.hpp"
+#include <ascent_logging.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <map>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+namespace expressions
+{
+
+namespace detail
+{
+
+// file header, the trailing digit is the format version
+const char history_magic[] = "ASCENT_HISTORY_1";
+const size_t history_magic_size = sizeof(history_magic) - 1;
+
+void
+append_bytes(std::vector<char> &buffer, const void *data, size_t size)
+{
+  const char *bytes = static_cast<const char*>(data);
+  buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+void
+append_block(std::vector<char> &buffer, const void *data, size_t size)
+{
+  conduit::uint64 block_size = static_cast<conduit::uint64>(size);
+  append_bytes(buffer, &block_size, sizeof(block_size));
+  append_bytes(buffer, data, size);
+}
+
+// reads a length prefixed block, returns false if the record is truncated
+bool
+read_block(const std::vector<char> &buffer,
+           size_t &offset,
+           const char *&data,
+           size_t &size)
+{
+  conduit::uint64 block_size = 0;
+  if(offset + sizeof(block_size) > buffer.size())
+  {
+    return false;
+  }
+  std::memcpy(&block_size, buffer.data() + offset, sizeof(block_size));
+  offset += sizeof(block_size);
+  if(block_size > buffer.size() - offset)
+  {
+    return false;
+  }
+  data = buffer.data() + offset;
+  size = static_cast<size_t>(block_size);
+  offset += size;
+  return true;
+}
+
+};
+
+//-----------------------------------------------------------------------------
+HistoryStore::HistoryStore()
+  : m_file_name(""),
+    m_rewrite(false)
+{
+}
+
+//-----------------------------------------------------------------------------
+HistoryStore::~HistoryStore()
+{
+}
+
+//-----------------------------------------------------------------------------
+void
+HistoryStore::file_name(const std::string &file_name)
+{
+  m_file_name = file_name;
+}
+
+//-----------------------------------------------------------------------------
+const std::string &
+HistoryStore::file_name() const
+{
+  return m_file_name;
+}
+
+//-----------------------------------------------------------------------------
+void
+HistoryStore::pack(const std::string &path, const conduit::Node &entry)
+{
+  conduit::Node compact;
+  entry.compact_to(compact);
+  const std::string schema = compact.schema().to_json();
+  std::vector<conduit::uint8> data;
+  compact.serialize(data);
+
+  detail::append_block(m_pending, path.c_str(), path.size());
+  detail::append_block(m_pending, schema.c_str(), schema.size());
+  detail::append_block(m_pending, data.data(), data.size());
+}
+
+//-----------------------------------------------------------------------------
+void
+HistoryStore::append(const std::string &path, const conduit::Node &entry)
+{
+  if(m_file_name == "")
+  {
+    return;
+  }
+  pack(path, entry);
+}
+
+//-----------------------------------------------------------------------------
+void
+HistoryStore::rewrite(const conduit::Node &data)
+{
+  if(m_file_name == "")
+  {
+    return;
+  }
+  m_pending.clear();
+  m_rewrite = true;
+
+  // entries are stored as expr_name/cycle, everything
+  // else (e.g. last_known_time) is a single record
+  const int num_entries = data.number_of_children();
+  for(int i = 0; i < num_entries; ++i)
+  {
+    const conduit::Node &entry = data.child(i);
+    const std::string name = entry.name();
+    if(entry.dtype().is_object() &&
+       name != "ascent_cache_info")
+    {
+      const int num_cycles = entry.number_of_children();
+      for(int c = 0; c < num_cycles; ++c)
+      {
+        pack(name + "/" + entry.child(c).name(), entry.child(c));
+      }
+    }
+    else
+    {
+      pack(name, entry);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+HistoryStore::flush()
+{
+  if(m_file_name == "" || (m_pending.empty() && !m_rewrite))
+  {
+    return;
+  }
+
+  const bool fresh = m_rewrite || !conduit::utils::is_file(m_file_name);
+  std::ofstream ofs;
+  if(fresh)
+  {
+    ofs.open(m_file_name.c_str(), std::ios::out | std::ios::binary);
+  }
+  else
+  {
+    ofs.open(m_file_name.c_str(),
+             std::ios::out | std::ios::binary | std::ios::app);
+  }
+
+  if(!ofs.is_open())
+  {
+    ASCENT_WARN("Failed to open expression history file '"
+                << m_file_name << "'");
+    return;
+  }
+
+  if(fresh)
+  {
+    ofs.write(detail::history_magic, detail::history_magic_size);
+  }
+  ofs.write(m_pending.data(), m_pending.size());
+  ofs.close();
+
+  m_pending.clear();
+  m_rewrite = false;
+}
+
+//-----------------------------------------------------------------------------
+void
+HistoryStore::clear()
+{
+  m_pending.clear();
+  m_rewrite = false;
+}
+
+//-----------------------------------------------------------------------------
+std::string
+HistoryStore::session_file_name(const std::string &session)
+{
+  return session + ".ascent_history";
+}
+
+//-----------------------------------------------------------------------------
+bool
+HistoryStore::is_history_file(const std::string &file_name)
+{
+  std::ifstream ifs(file_name.c_str(), std::ios::in | std::ios::binary);
+  if(!ifs.is_open())
+  {
+    return false;
+  }
+  char magic[sizeof(detail::history_magic)] = {0};
+  ifs.read(magic, detail::history_magic_size);
+  return ifs.gcount() == (std::streamsize) detail::history_magic_size &&
+         std::memcmp(magic,
+                     detail::history_magic,
+                     detail::history_magic_size) == 0;
+}
+
+//-----------------------------------------------------------------------------
+void
+HistoryStore::load(const std::string &file_name, conduit::Node &data)
+{
+  if(!is_history_file(file_name))
+  {
+    ASCENT_ERROR("'" << file_name << "' is not an expression history file");
+  }
+
+  // read everything in one pass, records are small and
+  // replaying from memory avoids lots of tiny reads
+  std::ifstream ifs(file_name.c_str(), std::ios::in | std::ios::binary);
+  ifs.seekg(0, std::ios::end);
+  const size_t file_size = static_cast<size_t>(ifs.tellg());
+  ifs.seekg(0, std::ios::beg);
+  std::vector<char> buffer(file_size);
+  ifs.read(buffer.data(), file_size);
+  ifs.close();
+
+  // most entries of a query share a schema from cycle to cycle,
+  // only parse each distinct schema once
+  std::map<std::string, conduit::Schema> schemas;
+
+  size_t offset = detail::history_magic_size;
+  while(offset < buffer.size())
+  {
+    const char *path, *schema, *bytes;
+    size_t path_size, schema_size, bytes_size;
+    if(!detail::read_block(buffer, offset, path, path_size) ||
+       !detail::read_block(buffer, offset, schema, schema_size) ||
+       !detail::read_block(buffer, offset, bytes, bytes_size))
+    {
+      // a crash while appending can leave a partial record at the end,
+      // keep everything that made it to disk
+      ASCENT_WARN("Ignoring truncated record at the end of expression "
+                  << "history file '" << file_name << "'");
+      break;
+    }
+
+    const std::string schema_json(schema, schema_size);
+    std::map<std::string, conduit::Schema>::iterator itr;
+    itr = schemas.find(schema_json);
+    if(itr == schemas.end())
+    {
+      itr = schemas.insert(std::make_pair(schema_json,
+                                          conduit::Schema(schema_json))).first;
+    }
+    conduit::Node &entry = data[std::string(path, path_size)];
+    entry.set_data_using_schema(itr->second,
+                                const_cast<char*>(bytes));
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+HistoryStore::convert(const std::string &file_name,
+                      const std::string &output_name,
+                      const std::string &protocol)
+{
+  conduit::Node data;
+  load(file_name, data);
+  data.save(output_name, protocol);
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
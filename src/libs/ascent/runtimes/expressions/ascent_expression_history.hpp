@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_expression_history.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef ASCENT_EXPRESSION_HISTORY_HPP
+#define ASCENT_EXPRESSION_HISTORY_HPP
+
+#include <conduit.hpp>
+#include <ascent_exports.h>
+
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+namespace expressions
+{
+
+//-----------------------------------------------------------------------------
+// Append-only binary store for the expression session history.
+//
+// The file starts with a short header followed by a sequence of records.
+// Each record holds the cache path it was stored under (e.g. "max_p/100")
+// and the entry itself as a compact conduit schema + data blob:
+//
+//   uint64 path length, path
+//   uint64 schema length, schema json
+//   uint64 data length, data
+//
+// Records are replayed in order on load, so a later record for the same
+// path replaces an earlier one. The history functions index the whole
+// history, so load reads every record into memory; each distinct schema
+// is only parsed once. Appending a cycle only writes the new
+// records, the existing contents of the file are never touched unless the
+// history is rewritten (e.g. after time travel removes entries).
+// Records use the native byte order.
+//-----------------------------------------------------------------------------
+class ASCENT_API HistoryStore
+{
+public:
+  HistoryStore();
+  ~HistoryStore();
+
+  // sets the file records are appended to, an empty name disables writes
+  void file_name(const std::string &file_name);
+  const std::string &file_name() const;
+
+  // queues an entry, it is written on the next flush
+  void append(const std::string &path, const conduit::Node &entry);
+  // replaces the file contents with the children of data on the next flush
+  void rewrite(const conduit::Node &data);
+  // writes any queued records to the file
+  void flush();
+  // drops queued records without writing them
+  void clear();
+
+  // the file name used for a session, i.e. session + ".ascent_history"
+  static std::string session_file_name(const std::string &session);
+  static bool is_history_file(const std::string &file_name);
+  // replays all records in file_name into data
+  static void load(const std::string &file_name, conduit::Node &data);
+  // converts a history file to yaml or json
+  static void convert(const std::string &file_name,
+                      const std::string &output_name,
+                      const std::string &protocol = "yaml");
+
+private:
+  void pack(const std::string &path, const conduit::Node &entry);
+
+  std::string        m_file_name;
+  std::vector<char>  m_pending;
+  bool               m_rewrite;
+};
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::expressions--
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
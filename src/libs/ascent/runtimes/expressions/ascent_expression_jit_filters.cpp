@@ -395,7 +395,7 @@ ExprJitFilter::execute()
             // we need to put the binning in the registry, otherwise it may get
             // deleted
             conduit::Node &binning_value = (*remove)["temporaries"].append();
-            binning_value = (*inp)["attrs/value/value"];
+            binning_value = dense_bin_values(*inp);
             for(int i = 0; i < num_domains; ++i)
             {
               conduit::Node &args = jitable.dom_info.child(i)["args"];
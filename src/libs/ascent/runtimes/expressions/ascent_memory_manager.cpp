@@ -8,12 +8,148 @@
 #include <umpire/util/MemoryResourceTraits.hpp>
 #include <umpire/strategy/DynamicPoolList.hpp>
 #endif
+#include <algorithm>
+#include <atomic>
 #include <cstring> // memcpy
+#include <mutex>
+#include <unordered_map>
 #include <conduit.hpp>
 
 namespace ascent
 {
 
+namespace detail
+{
+
+// number of live MemoryTracking scopes
+std::atomic<int> &tracking_scopes()
+{
+  static std::atomic<int> scopes(0);
+  return scopes;
+}
+
+//-----------------------------------------------------------------------------
+// tracks the size of each live allocation so we know the bytes in use.
+// Only allocations made while tracking is on are counted, otherwise
+// allocating and freeing cost two relaxed atomic loads.
+//-----------------------------------------------------------------------------
+struct MemoryCounters
+{
+  MemoryCounters()
+    : m_num_tracked(0),
+      m_total_bytes(0),
+      m_bytes_in_use(0),
+      m_peak_bytes(0)
+  {}
+
+  void allocated(void *ptr, size_t bytes)
+  {
+    if(tracking_scopes().load(std::memory_order_relaxed) == 0)
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sizes[ptr] = bytes;
+    m_num_tracked.store(m_sizes.size(), std::memory_order_relaxed);
+    m_total_bytes += bytes;
+    m_bytes_in_use += bytes;
+    m_peak_bytes = std::max(m_peak_bytes, m_bytes_in_use);
+  }
+
+  void deallocated(void *ptr)
+  {
+    // tracked allocations are still looked up after tracking is
+    // turned off, so bytes_in_use stays right
+    if(m_num_tracked.load(std::memory_order_relaxed) == 0)
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto itr = m_sizes.find(ptr);
+    if(itr != m_sizes.end())
+    {
+      m_bytes_in_use -= itr->second;
+      m_sizes.erase(itr);
+      m_num_tracked.store(m_sizes.size(), std::memory_order_relaxed);
+    }
+  }
+
+  size_t total_bytes()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_total_bytes;
+  }
+
+  size_t bytes_in_use()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_bytes_in_use;
+  }
+
+  size_t peak_bytes()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_peak_bytes;
+  }
+
+  void reset_peak_bytes()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_peak_bytes = m_bytes_in_use;
+  }
+
+  std::mutex                         m_mutex;
+  std::unordered_map<void *, size_t> m_sizes;
+  std::atomic<size_t>                m_num_tracked;
+  size_t                             m_total_bytes;
+  size_t                             m_bytes_in_use;
+  size_t                             m_peak_bytes;
+};
+
+MemoryCounters &host_counters()
+{
+  static MemoryCounters counters;
+  return counters;
+}
+
+MemoryCounters &device_counters()
+{
+  static MemoryCounters counters;
+  return counters;
+}
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// Memory Tracking
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+MemoryTracking::MemoryTracking(bool on)
+  : m_on(on)
+{
+  if(m_on)
+  {
+    detail::tracking_scopes()++;
+  }
+}
+
+//-----------------------------------------------------------------------------
+MemoryTracking::~MemoryTracking()
+{
+  if(m_on)
+  {
+    detail::tracking_scopes()--;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool
+MemoryTracking::enabled()
+{
+  return detail::tracking_scopes().load() > 0;
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 // Allocation Manager
@@ -243,7 +379,6 @@ AllocationManager::set_conduit_mem_handlers()
 // Host Memory
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
-size_t HostMemory::m_total_bytes_alloced = 0;
 size_t HostMemory::m_alloc_count = 0;
 size_t HostMemory::m_free_count = 0;
 
@@ -251,16 +386,17 @@ size_t HostMemory::m_free_count = 0;
 void *
 HostMemory::allocate(size_t bytes)
 {
-  m_total_bytes_alloced += bytes;
   m_alloc_count++;
 #if defined(ASCENT_UMPIRE_ENABLED)
   auto &rm = umpire::ResourceManager::getInstance ();
   const int allocator_id = AllocationManager::host_allocator_id();
   umpire::Allocator host_allocator = rm.getAllocator (allocator_id);
-  return host_allocator.allocate(bytes);
+  void *ptr = host_allocator.allocate(bytes);
 #else
-  return malloc(bytes);
+  void *ptr = malloc(bytes);
 #endif
+  detail::host_counters().allocated(ptr, bytes);
+  return ptr;
 }
 
 
@@ -276,6 +412,7 @@ void
 HostMemory::deallocate(void *data_ptr)
 {
   m_free_count++;
+  detail::host_counters().deallocated(data_ptr);
 #if defined(ASCENT_UMPIRE_ENABLED)
   auto &rm = umpire::ResourceManager::getInstance ();
   const int allocator_id = AllocationManager::host_allocator_id();
@@ -286,12 +423,39 @@ HostMemory::deallocate(void *data_ptr)
 #endif
 }
 
+//-----------------------------------------------------------------------------
+size_t
+HostMemory::total_bytes_allocated()
+{
+  return detail::host_counters().total_bytes();
+}
+
+//-----------------------------------------------------------------------------
+size_t
+HostMemory::bytes_in_use()
+{
+  return detail::host_counters().bytes_in_use();
+}
+
+//-----------------------------------------------------------------------------
+size_t
+HostMemory::peak_bytes()
+{
+  return detail::host_counters().peak_bytes();
+}
+
+//-----------------------------------------------------------------------------
+void
+HostMemory::reset_peak_bytes()
+{
+  detail::host_counters().reset_peak_bytes();
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 // Device Memory
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
-size_t DeviceMemory::m_total_bytes_alloced = 0;
 size_t DeviceMemory::m_alloc_count = 0;
 size_t DeviceMemory::m_free_count = 0;
 
@@ -305,12 +469,13 @@ DeviceMemory::allocate(size_t bytes)
 #endif
 
 #if defined(ASCENT_DEVICE_ENABLED) && defined(ASCENT_UMPIRE_ENABLED)
-  m_total_bytes_alloced += bytes;
   m_alloc_count++;
   auto &rm = umpire::ResourceManager::getInstance ();
   const int allocator_id = AllocationManager::device_allocator_id();
   umpire::Allocator device_allocator = rm.getAllocator (allocator_id);
-  return device_allocator.allocate(bytes);
+  void *ptr = device_allocator.allocate(bytes);
+  detail::device_counters().allocated(ptr, bytes);
+  return ptr;
 #else
   (void) bytes; // unused
   ASCENT_ERROR("Calling device allocator when no device is present.");
@@ -336,6 +501,7 @@ DeviceMemory::deallocate(void *data_ptr)
 
 #if defined(ASCENT_DEVICE_ENABLED) && defined(ASCENT_UMPIRE_ENABLED)
   m_free_count++;
+  detail::device_counters().deallocated(data_ptr);
   auto &rm = umpire::ResourceManager::getInstance ();
   const int allocator_id = AllocationManager::device_allocator_id();
   umpire::Allocator device_allocator = rm.getAllocator (allocator_id);
@@ -346,6 +512,34 @@ DeviceMemory::deallocate(void *data_ptr)
 #endif
 }
 
+//-----------------------------------------------------------------------------
+size_t
+DeviceMemory::total_bytes_allocated()
+{
+  return detail::device_counters().total_bytes();
+}
+
+//-----------------------------------------------------------------------------
+size_t
+DeviceMemory::bytes_in_use()
+{
+  return detail::device_counters().bytes_in_use();
+}
+
+//-----------------------------------------------------------------------------
+size_t
+DeviceMemory::peak_bytes()
+{
+  return detail::device_counters().peak_bytes();
+}
+
+//-----------------------------------------------------------------------------
+void
+DeviceMemory::reset_peak_bytes()
+{
+  detail::device_counters().reset_peak_bytes();
+}
+
 
 //-----------------------------------------------------------------------------
 void
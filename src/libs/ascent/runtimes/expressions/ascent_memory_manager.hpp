@@ -58,6 +58,22 @@ private:
 
 };
 
+//-----------------------------------------------------------------------------
+/// Turns on the byte counters of HostMemory and DeviceMemory while at
+/// least one MemoryTracking(true) is alive. Only allocations made while
+/// tracking is on are counted.
+//-----------------------------------------------------------------------------
+class ASCENT_API MemoryTracking
+{
+public:
+  MemoryTracking(bool on = true);
+  ~MemoryTracking();
+
+  static bool enabled();
+private:
+  bool m_on;
+};
+
 //-----------------------------------------------------------------------------
 /// Host Memory allocation / deallocation interface (singleton)
 ///  Uses AllocationManager::host_allocator_id() when Umpire is enabled,
@@ -69,8 +85,15 @@ struct ASCENT_API HostMemory
   static void *allocate(size_t items, size_t item_size);
   static void  deallocate(void *data_ptr);
 
+  /// bytes allocated while MemoryTracking was on
+  static size_t total_bytes_allocated();
+  /// bytes currently allocated
+  static size_t bytes_in_use();
+  /// high water mark of bytes_in_use() since the last reset_peak_bytes()
+  static size_t peak_bytes();
+  static void   reset_peak_bytes();
+
 private:
-  static size_t m_total_bytes_alloced;
   static size_t m_alloc_count;
   static size_t m_free_count;
 
@@ -89,8 +112,15 @@ struct ASCENT_API DeviceMemory
   static bool is_device_ptr(const void *ptr);
   static void is_device_ptr(const void *ptr, bool &is_gpu, bool &is_unified);
 
+  /// bytes allocated while MemoryTracking was on
+  static size_t total_bytes_allocated();
+  /// bytes currently allocated
+  static size_t bytes_in_use();
+  /// high water mark of bytes_in_use() since the last reset_peak_bytes()
+  static size_t peak_bytes();
+  static void   reset_peak_bytes();
+
 private:
-  static size_t m_total_bytes_alloced;
   static size_t m_alloc_count;
   static size_t m_free_count;
 
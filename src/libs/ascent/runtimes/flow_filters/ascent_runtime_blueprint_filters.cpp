@@ -122,6 +122,22 @@ BlueprintVerify::verify_params(const conduit::Node &params,
 }
 
 
+//-----------------------------------------------------------------------------
+bool
+BlueprintVerify::cache_signature(conduit::Node &sig)
+{
+    // verify reads the published data, which can only be reused
+    // if the runtime is tracking source revisions
+    if(!Metadata::n_metadata.has_path("revisions"))
+    {
+        return false;
+    }
+
+    sig["params"] = params();
+    sig["revisions"] = Metadata::n_metadata["revisions"];
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 void
 BlueprintVerify::execute()
@@ -442,6 +458,7 @@ DataBinning::verify_params(const conduit::Node &params,
     valid_paths.push_back("empty_bin_val");
     valid_paths.push_back("output_type");
     valid_paths.push_back("output_field");
+    valid_paths.push_back("sparse");
     valid_paths.push_back("var");
 
     std::vector<std::string> ignore_paths;
@@ -573,6 +590,17 @@ DataBinning::execute()
       n_empty_bin_val = params()["empty_bin_val"];
     }
 
+    // sparse binning only keeps the occupied bins. Painting works on
+    // the sparse bins directly, the bins mesh needs every bin.
+    conduit::Node n_sparse;
+    conduit::Node n_sparse_output;
+    if(params().has_path("sparse") &&
+       params()["sparse"].as_string() == "true")
+    {
+      n_sparse["value"] = 1;
+      n_sparse_output["value"] = output_type == "mesh" ? 1 : 0;
+    }
+
     conduit::Node n_axes_list;
     n_axes_list["type"] = "list";
     conduit::Node &n_axes = n_axes_list["value"];
@@ -626,6 +654,8 @@ DataBinning::execute()
                                    reduction_op,
                                    n_empty_bin_val,
                                    n_component,
+                                   n_sparse,
+                                   n_sparse_output,
                                    n_axes_list,
                                    *n_input.get(),
                                    n_binning,
@@ -644,6 +674,13 @@ DataBinning::execute()
   mesh_in["attrs/bin_axes/value"] = n_output_axes;
   mesh_in["attrs/association/value"] = n_binning["association"];
   mesh_in["attrs/association/type"] = "string";
+  mesh_in["attrs/empty_bin_val/value"] = n_binning["empty_bin_val"];
+  mesh_in["attrs/empty_bin_val/type"] = "double";
+  if(n_binning.has_path("bin_ids"))
+  {
+    mesh_in["attrs/bin_ids/value"] = n_binning["bin_ids"];
+    mesh_in["attrs/bin_ids/type"] = "array";
+  }
 
   if(output_type == "bins")
   {
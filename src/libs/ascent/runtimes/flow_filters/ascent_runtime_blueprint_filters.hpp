@@ -53,6 +53,7 @@ public:
     virtual void   declare_interface(conduit::Node &i);
     virtual bool   verify_params(const conduit::Node &params,
                                  conduit::Node &info);
+    virtual bool   cache_signature(conduit::Node &sig);
     virtual void   execute();
 };
 
@@ -31,6 +31,7 @@
 #include <ascent_runtime_utils.hpp>
 #include <ascent_resources.hpp>
 #include <png_utils/ascent_png_encoder.hpp>
+#include <png_utils/ascent_png_writer.hpp>
 #include <flow_graph.hpp>
 #include <flow_workspace.hpp>
 
@@ -88,6 +89,66 @@ namespace filters
 
 namespace detail
 {
+
+//
+// Saves the composited image on rank 0. With distributed image writes,
+// image_index picks the rank that encodes and writes it. All ranks must
+// call this for every image.
+//
+void save_framebuffer(dray::Framebuffer &fb,
+                      const std::string &image_name,
+                      const int image_index)
+{
+  const int rank = dray::dray::mpi_rank();
+  int writer_rank = 0;
+  if(PNGWriter::Distributed())
+  {
+    writer_rank = image_index % dray::dray::mpi_size();
+  }
+
+  const int width = fb.width();
+  const int height = fb.height();
+  if(writer_rank == 0)
+  {
+    if(rank == 0)
+    {
+      dray::Array<dray::Vec<dray::float32,4>> colors = fb.colors();
+      PNGWriter::Write((float *) colors.get_host_ptr(),
+                       width,
+                       height,
+                       image_name + ".png");
+    }
+    return;
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  if(rank != 0 && rank != writer_rank)
+  {
+    return;
+  }
+
+  MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
+  const int size = width * height * 4;
+  std::vector<unsigned char> rgba(size);
+  if(rank == 0)
+  {
+    // convert before sending, this matches what the encoder does
+    dray::Array<dray::Vec<dray::float32,4>> colors = fb.colors();
+    const float *color_ptr = (float *) colors.get_host_ptr();
+    for(int i = 0; i < size; ++i)
+    {
+      rgba[i] = (unsigned char)(color_ptr[i] * 255.f);
+    }
+    MPI_Send(&rgba[0], size, MPI_UNSIGNED_CHAR, writer_rank, 0, mpi_comm);
+  }
+  else
+  {
+    MPI_Recv(&rgba[0], size, MPI_UNSIGNED_CHAR, 0, 0, mpi_comm, MPI_STATUS_IGNORE);
+    PNGWriter::Write(rgba, width, height, image_name + ".png");
+  }
+#endif
+}
+
 bool is_same(const dray::AABB<3> &b1, const dray::AABB<3> &b2)
 {
   return
@@ -1312,8 +1373,8 @@ DRayPseudocolor::execute()
       if(dray::dray::mpi_rank() == 0)
       {
         fb.composite_background();
-        fb.save(image_names[i]);
       }
+      detail::save_framebuffer(fb, image_names[i], i);
     }
 
 }
@@ -1708,8 +1769,8 @@ DRay3Slice::execute()
       if(dray::dray::mpi_rank() == 0)
       {
         fb.composite_background();
-        fb.save(work[i].m_image_name);
       }
+      detail::save_framebuffer(fb, work[i].m_image_name, i);
     }
 }
 
@@ -1921,8 +1982,8 @@ DRayVolume::execute()
       if(dray::dray::mpi_rank() == 0)
       {
         fb.composite_background();
-        fb.save(image_names[i]);
       }
+      detail::save_framebuffer(fb, image_names[i], i);
     }
 
 }
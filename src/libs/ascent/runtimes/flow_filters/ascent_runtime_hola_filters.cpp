@@ -98,6 +98,12 @@ HolaMPIExtract::verify_params(const conduit::Node &params,
         info["errors"].append() = "Missing required integer parameter 'rank_split'";
     }
 
+    if( params.has_child("pipelined") &&
+        ! params["pipelined"].dtype().is_string() )
+    {
+        info["errors"].append() = "Optional parameter 'pipelined' must be a string (\"true\" or \"false\")";
+    }
+
     return res;
 }
 
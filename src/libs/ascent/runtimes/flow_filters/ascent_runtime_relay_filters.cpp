@@ -34,6 +34,7 @@
 #include <ascent_mpi_utils.hpp>
 #include <ascent_runtime_utils.hpp>
 #include <ascent_runtime_param_check.hpp>
+#include <ascent_runtime_staged_writer.hpp>
 
 #include <flow_graph.hpp>
 #include <flow_workspace.hpp>
@@ -400,6 +401,38 @@ verify_io_params(const conduit::Node &params,
                              false);
     }
 
+    if( params.has_child("async") )
+    {
+        //
+        // ASYNC Example:
+        //
+        // enabled: "true"
+        // max_staged_bytes: 1073741824
+        // policy: "block" # or "skip_cycle"
+
+        const Node &params_async = params["async"];
+
+        res &= check_object("async", params, info, false);
+
+        res &= check_bool("enabled", params_async, info, false);
+
+        res &= check_numeric("max_staged_bytes", params_async, info, false);
+
+        res &= check_string("policy", params_async, info, false);
+
+        if(params_async.has_child("policy") &&
+           params_async["policy"].dtype().is_string())
+        {
+            const std::string policy = params_async["policy"].as_string();
+            if(policy != "block" && policy != "skip_cycle")
+            {
+                info["errors"].append() = "'async/policy' must be 'block' "
+                                          "or 'skip_cycle'";
+                res = false;
+            }
+        }
+    }
+
     std::vector<std::string> valid_paths;
     std::vector<std::string> ignore_paths;
     valid_paths.push_back("path");
@@ -408,6 +441,7 @@ verify_io_params(const conduit::Node &params,
     valid_paths.push_back("num_files");
     ignore_paths.push_back("fields");
     ignore_paths.push_back("hdf5_options");
+    ignore_paths.push_back("async");
 
     std::string surprises = surprise_check(valid_paths, ignore_paths, params);
 
@@ -421,6 +455,32 @@ verify_io_params(const conduit::Node &params,
 }
 
 
+//-----------------------------------------------------------------------------
+void mesh_blueprint_write(const Node &data,
+                          const std::string &path,
+                          const std::string &file_protocol,
+                          int num_files,
+                          int mpi_comm_id)
+{
+    // setup our options
+    Node opts;
+    opts["number_of_files"] = num_files;
+#ifdef ASCENT_MPI_ENABLED
+    MPI_Comm mpi_comm = MPI_Comm_f2c(mpi_comm_id);
+    conduit::relay::mpi::io::blueprint::save_mesh(data,
+                                                  path,
+                                                  file_protocol,
+                                                  opts,
+                                                  mpi_comm);
+#else
+    (void) mpi_comm_id;
+    conduit::relay::io::blueprint::save_mesh(data,
+                                             path,
+                                             file_protocol,
+                                             opts);
+#endif
+}
+
 //-----------------------------------------------------------------------------
 void mesh_blueprint_save(const Node &data,
                          const std::string &path,
@@ -438,9 +498,10 @@ void mesh_blueprint_save(const Node &data,
       return;
     }
 
-    // setup our options
-    Node opts;
-    opts["number_of_files"] = num_files;
+    // staged extracts still being written use the same
+    // files (and hdf5), let them finish first
+    StagedWriter::wait();
+
     bool using_hdf5_opts = (file_protocol == "hdf5" &&
                             extra_opts.number_of_children() > 0);
     Node hdf5_opts_orig;
@@ -458,27 +519,18 @@ void mesh_blueprint_save(const Node &data,
         // set
         conduit::relay::io::hdf5_set_options(hdf5_opts_orig_curr);
     }
-#ifdef ASCENT_MPI_ENABLED
-    MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
-    conduit::relay::mpi::io::blueprint::save_mesh(data,
-                                                  path,
-                                                  file_protocol,
-                                                  opts,
-                                                  mpi_comm);
-#else
-    conduit::relay::io::blueprint::save_mesh(data,
-                                             path,
-                                             file_protocol,
-                                             opts);
-#endif
+
+    mesh_blueprint_write(data,
+                         path,
+                         file_protocol,
+                         num_files,
+                         Workspace::default_mpi_comm());
 
     if(using_hdf5_opts)
     {
         // pop hdf5 io settings
         conduit::relay::io::hdf5_set_options(hdf5_opts_orig);
     }
-    return;
-
 }
 
 
@@ -612,45 +664,133 @@ RelayIOSave::execute()
         extra_opts = params()["hdf5_options"];
     }
 
-    std::string result_path;
-    if(protocol.empty())
+    // blueprint protocols go through save_mesh, everything
+    // else is a plain relay save
+    std::string blueprint_protocol;
+    if( protocol == "blueprint/mesh/hdf5" || protocol == "hdf5")
     {
-        conduit::relay::io::save(selected,path);
-        result_path = path;
+        blueprint_protocol = "hdf5";
     }
-    else if( protocol == "blueprint/mesh/hdf5" || protocol == "hdf5")
+    else if( protocol == "blueprint/mesh/json" || protocol == "json")
     {
-        mesh_blueprint_save(selected,
-                            path,
-                            "hdf5",
-                            num_files,
-                            extra_opts,
-                            result_path);
+        blueprint_protocol = "json";
     }
-    else if( protocol == "blueprint/mesh/json" || protocol == "json")
+    else if( protocol == "blueprint/mesh/yaml" || protocol == "yaml")
     {
-        mesh_blueprint_save(selected,
-                            path,
-                            "json",
-                            num_files,
-                            extra_opts,
-                            result_path);
+        blueprint_protocol = "yaml";
+    }
 
+    bool async = false;
+    index_t max_staged_bytes = StagedWriter::default_max_staged_bytes();
+    std::string policy = "block";
+    if(params().has_path("async/enabled"))
+    {
+        async = params()["async/enabled"].as_string() == "true";
     }
-    else if( protocol == "blueprint/mesh/yaml" || protocol == "yaml")
+    if(params().has_path("async/max_staged_bytes"))
+    {
+        max_staged_bytes = params()["async/max_staged_bytes"].to_index_t();
+    }
+    if(params().has_path("async/policy"))
+    {
+        policy = params()["async/policy"].as_string();
+    }
+
+    if(async && !StagedWriter::available())
+    {
+        ASCENT_INFO("relay_io_save: async writes require MPI_THREAD_MULTIPLE,"
+                    " writing '" << path << "' inline");
+        async = false;
+    }
+
+    Node einfo;
+    einfo["type"] = "relay";
+    if(!protocol.empty())
+        einfo["protocol"] = protocol;
+    einfo["path"] = path;
+    einfo["cycle"] = cycle;
+
+    bool has_data = true;
+    if(async && !blueprint_protocol.empty())
+    {
+        // checked here since the io thread can't use the ascent comm
+        has_data = blueprint::mesh::number_of_domains(selected) > 0;
+        has_data = global_someone_agrees(has_data);
+        if(!has_data)
+        {
+          ASCENT_INFO("Blueprint save: no valid data exists. Skipping save");
+        }
+    }
+
+    std::string result_path = path;
+    if(async && has_data)
+    {
+        StagedWriter::WriteFunction write;
+        // hdf5 options are process wide, the staged
+        // writer sets them on this thread
+        Node hdf5_opts;
+        if(!blueprint_protocol.empty())
+        {
+            if(blueprint_protocol == "hdf5")
+            {
+                hdf5_opts.set(extra_opts);
+            }
+            write = [=](const Node &data, int mpi_comm_id)
+            {
+                mesh_blueprint_write(data,
+                                     path,
+                                     blueprint_protocol,
+                                     num_files,
+                                     mpi_comm_id);
+            };
+        }
+        else
+        {
+            write = [=](const Node &data, int)
+            {
+                if(protocol.empty())
+                {
+                    conduit::relay::io::save(data,path);
+                }
+                else
+                {
+                    conduit::relay::io::save(data,path,protocol);
+                }
+            };
+        }
+
+        // the staged copy is written by the io thread, the final
+        // status shows up in the info of a later execute
+        einfo["async/policy"] = policy;
+        einfo["async/status"] = StagedWriter::stage(selected,
+                                                    einfo,
+                                                    max_staged_bytes,
+                                                    policy,
+                                                    write,
+                                                    hdf5_opts);
+    }
+    else if(async)
+    {
+        // nothing to write
+    }
+    else if(protocol.empty())
+    {
+        StagedWriter::wait();
+        conduit::relay::io::save(selected,path);
+    }
+    else if(!blueprint_protocol.empty())
     {
         mesh_blueprint_save(selected,
                             path,
-                            "yaml",
+                            blueprint_protocol,
                             num_files,
                             extra_opts,
                             result_path);
-
     }
     else
     {
+        StagedWriter::wait();
         conduit::relay::io::save(selected,path,protocol);
-        result_path = path;
     }
 
     // add this to the extract results in the registry
@@ -664,11 +804,8 @@ RelayIOSave::execute()
 
     conduit::Node *extract_list = graph().workspace().registry().fetch<Node>("extract_list");
 
-    Node &einfo = extract_list->append();
-    einfo["type"] = "relay";
-    if(!protocol.empty())
-        einfo["protocol"] = protocol;
     einfo["path"] = result_path;
+    extract_list->append().set(einfo);
 }
 
 
@@ -717,6 +854,9 @@ RelayIOLoad::execute()
         protocol = params()["protocol"].as_string();
     }
 
+    // the file could still be in the staging queue
+    StagedWriter::wait();
+
     Node *res = new Node();
 
     if(protocol.empty())
@@ -43,6 +43,14 @@ namespace filters
 ///
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
+// writes with the given communicator, without checking for data
+// or setting hdf5 options
+void mesh_blueprint_write(const conduit::Node &data,
+                          const std::string &path,
+                          const std::string &file_protocol,
+                          int num_files,
+                          int mpi_comm_id);
+
 void mesh_blueprint_save(const conduit::Node &data,
                          const std::string &path,
                          const std::string &file_protocol,
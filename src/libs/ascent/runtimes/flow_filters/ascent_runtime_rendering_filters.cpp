@@ -175,6 +175,9 @@ check_renders_surprises(const conduit::Node &renders_node)
   r_valid_paths.push_back("auto_camera/bins");
   r_valid_paths.push_back("auto_camera/height");
   r_valid_paths.push_back("auto_camera/width");
+  r_valid_paths.push_back("auto_camera/coarse_factor");
+  r_valid_paths.push_back("auto_camera/top_k");
+  r_valid_paths.push_back("auto_camera/seed_previous");
   r_valid_paths.push_back("color_bar_position");
 
   std::vector<std::string> r_ignore_paths;
@@ -997,6 +1000,38 @@ public:
 
 std::map<std::string, CinemaManager> CinemaDatabases::m_databases;
 
+// winning auto camera samples of previous cycles, used to
+// seed the search of the next cycle
+class AutoCameraSeeds
+{
+private:
+  // render path -> (number of samples, winning sample)
+  static std::map<std::string, std::pair<int,int>> m_seeds;
+public:
+
+  static int get_seed(const std::string &render_path, int samples)
+  {
+    auto it = m_seeds.find(render_path);
+    if(it == m_seeds.end() || it->second.first != samples)
+    {
+      return -1;
+    }
+    return it->second.second;
+  }
+
+  static void set_seed(const std::string &render_path, int samples, int sample)
+  {
+    m_seeds[render_path] = std::make_pair(samples, sample);
+  }
+
+  static void clear()
+  {
+    m_seeds.clear();
+  }
+};
+
+std::map<std::string, std::pair<int,int>> AutoCameraSeeds::m_seeds;
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
@@ -1060,6 +1095,13 @@ DefaultRender::verify_params(const conduit::Node &params,
     return res;
 }
 
+//-----------------------------------------------------------------------------
+void
+DefaultRender::reset_auto_camera_seeds()
+{
+    detail::AutoCameraSeeds::clear();
+}
+
 //-----------------------------------------------------------------------------
 
 void
@@ -1300,12 +1342,35 @@ DefaultRender::execute()
               width = render_node["auto_camera/width"].as_int32();
               auto_cam.SetWidth(width); 
             }
+            if(render_node.has_path("auto_camera/coarse_factor"))
+            {
+              int coarse_factor = render_node["auto_camera/coarse_factor"].to_int32();
+              auto_cam.SetCoarseFactor(coarse_factor);
+            }
+            if(render_node.has_path("auto_camera/top_k"))
+            {
+              int top_k = render_node["auto_camera/top_k"].to_int32();
+              auto_cam.SetTopK(top_k);
+            }
+
+            std::string render_path = filter_to_path(this->name()) + "/" +
+                                      renders_node.child_names()[i];
+            bool seed_previous = render_node.has_path("auto_camera/seed_previous") &&
+                                 render_node["auto_camera/seed_previous"].as_string() == "true";
+            if(seed_previous)
+            {
+              auto_cam.SetSeedSample(detail::AutoCameraSeeds::get_seed(render_path,
+                                                                       samples));
+            }
       
             auto_cam.SetInput(&dataset);
             auto_cam.SetField(field_name);
             auto_cam.SetMetric(metric);
             auto_cam.SetNumSamples(samples);
             auto_cam.Update();
+            detail::AutoCameraSeeds::set_seed(render_path,
+                                              samples,
+                                              auto_cam.GetWinningSample());
             
             vtkm::rendering::Camera *camera = new vtkm::rendering::Camera;
             *camera = auto_cam.GetCamera();
@@ -55,6 +55,10 @@ public:
     virtual bool   verify_params(const conduit::Node &params,
                                  conduit::Node &info);
     virtual void   execute();
+
+    // forgets the auto camera winners kept to seed the next cycle.
+    // Called when the last top level runtime closes.
+    static void    reset_auto_camera_seeds();
 };
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,398 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_runtime_staged_writer.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_runtime_staged_writer.hpp"
+
+//-----------------------------------------------------------------------------
+// ascent includes
+//-----------------------------------------------------------------------------
+#include <ascent_logging.hpp>
+#include <ascent_mpi_utils.hpp>
+
+#include <flow_timer.hpp>
+#include <flow_workspace.hpp>
+
+#include <conduit_relay.hpp>
+
+#ifdef ASCENT_MPI_ENABLED
+#include <mpi.h>
+#endif
+
+// std includes
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::filters --
+//-----------------------------------------------------------------------------
+namespace filters
+{
+
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+struct StagedWrite
+{
+  Node                        m_data;
+  Node                        m_record;
+  index_t                     m_bytes;
+  StagedWriter::WriteFunction m_write;
+};
+
+//-----------------------------------------------------------------------------
+class StagedWriteService
+{
+public:
+  StagedWriteService()
+    : m_staged_bytes(0),
+      m_pending(0),
+      m_hdf5_options_set(false),
+      m_shutdown(false),
+      m_running(false),
+      m_mpi_comm_id(-1)
+  {}
+
+  ~StagedWriteService()
+  {
+    // the comm can't be freed here, mpi could already be finalized
+    Stop();
+  }
+
+  // called on the main thread of all ranks
+  void Start()
+  {
+    if(m_running)
+    {
+      return;
+    }
+#ifdef ASCENT_MPI_ENABLED
+    MPI_Comm comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+    MPI_Comm io_comm;
+    MPI_Comm_dup(comm, &io_comm);
+    m_mpi_comm_id = MPI_Comm_c2f(io_comm);
+#endif
+    m_shutdown = false;
+    m_running = true;
+    m_thread = std::thread(&StagedWriteService::Work, this);
+  }
+
+  void Stop()
+  {
+    if(!m_running)
+    {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      m_shutdown = true;
+    }
+    m_work.notify_all();
+    m_thread.join();
+    m_running = false;
+  }
+
+  // called on the main thread of all ranks
+  void FreeComm()
+  {
+#ifdef ASCENT_MPI_ENABLED
+    if(m_mpi_comm_id != -1)
+    {
+      MPI_Comm io_comm = MPI_Comm_f2c(m_mpi_comm_id);
+      MPI_Comm_free(&io_comm);
+    }
+#endif
+    m_mpi_comm_id = -1;
+  }
+
+  // must hold the lock
+  bool Fits(index_t bytes, index_t max_bytes) const
+  {
+    return m_pending == 0 || m_staged_bytes + bytes <= max_bytes;
+  }
+
+  void Submit(std::shared_ptr<StagedWrite> job)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      m_queue.push_back(job);
+      m_staged_bytes += job->m_bytes;
+      m_pending++;
+    }
+    m_work.notify_one();
+  }
+
+  void Wait()
+  {
+    std::unique_lock<std::mutex> lock(m_lock);
+    m_space.wait(lock, [this] { return m_pending == 0; });
+  }
+
+  void WaitForSpace(index_t bytes, index_t max_bytes)
+  {
+    std::unique_lock<std::mutex> lock(m_lock);
+    m_space.wait(lock, [&] { return Fits(bytes, max_bytes); });
+  }
+
+  // sets the hdf5 options of a staged write, only called on
+  // the main thread while nothing is being written
+  void SetHDF5Options(const Node &hdf5_options)
+  {
+    Node relay_io_about;
+    conduit::relay::io::about(relay_io_about);
+    m_hdf5_options_orig = relay_io_about["options/hdf5"];
+    Node hdf5_options_curr(m_hdf5_options_orig);
+    hdf5_options_curr.update(hdf5_options);
+    conduit::relay::io::hdf5_set_options(hdf5_options_curr);
+    m_hdf5_options_set = true;
+  }
+
+  // restores the hdf5 options, only called on the
+  // main thread while nothing is being written
+  void RestoreHDF5Options()
+  {
+    if(m_hdf5_options_set)
+    {
+      conduit::relay::io::hdf5_set_options(m_hdf5_options_orig);
+      m_hdf5_options_orig.reset();
+      m_hdf5_options_set = false;
+    }
+  }
+
+  std::mutex m_lock;
+  index_t    m_staged_bytes;
+  int        m_pending;
+  Node       m_completed;
+  Node       m_hdf5_options_orig;
+  bool       m_hdf5_options_set;
+
+private:
+  void Work()
+  {
+    while(true)
+    {
+      std::shared_ptr<StagedWrite> job;
+      {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_work.wait(lock, [this]
+        {
+          return m_shutdown || !m_queue.empty();
+        });
+        if(m_queue.empty())
+        {
+          // shutting down and nothing left to do
+          return;
+        }
+        job = m_queue.front();
+        m_queue.pop_front();
+      }
+
+      Node &async_info = job->m_record["async"];
+      flow::Timer write_timer;
+      try
+      {
+        job->m_write(job->m_data, m_mpi_comm_id);
+        async_info["status"] = "complete";
+      }
+      catch(conduit::Error &e)
+      {
+        async_info["status"] = "failed";
+        async_info["message"] = e.message();
+      }
+      catch(std::exception &e)
+      {
+        async_info["status"] = "failed";
+        async_info["message"] = e.what();
+      }
+      async_info["write_time"] = write_timer.elapsed();
+
+      // release the staged copy before making room for more
+      job->m_data.reset();
+
+      {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_completed.append().set(job->m_record);
+        m_staged_bytes -= job->m_bytes;
+        m_pending--;
+      }
+      m_space.notify_all();
+    }
+  }
+
+  std::deque<std::shared_ptr<StagedWrite>> m_queue;
+  std::thread              m_thread;
+  bool                     m_shutdown;
+  bool                     m_running;
+  int                      m_mpi_comm_id;
+  std::condition_variable  m_work;
+  std::condition_variable  m_space;
+};
+
+//-----------------------------------------------------------------------------
+StagedWriteService &
+service()
+{
+  static StagedWriteService write_service;
+  return write_service;
+}
+
+};
+
+//-----------------------------------------------------------------------------
+bool
+StagedWriter::available()
+{
+#ifdef ASCENT_MPI_ENABLED
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&provided);
+  return provided == MPI_THREAD_MULTIPLE;
+#else
+  return true;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+std::string
+StagedWriter::stage(const Node &data,
+                    const Node &record,
+                    index_t max_staged_bytes,
+                    const std::string &policy,
+                    WriteFunction write,
+                    const Node &hdf5_options)
+{
+  detail::StagedWriteService &write_service = detail::service();
+  write_service.Start();
+
+  const index_t bytes = data.total_bytes_compact();
+
+  if(policy == "skip_cycle")
+  {
+    bool fits;
+    {
+      std::lock_guard<std::mutex> lock(write_service.m_lock);
+      fits = write_service.Fits(bytes, max_staged_bytes);
+    }
+    // every rank has to skip, otherwise the collective
+    // writes on the io threads would not match up
+    if(global_someone_agrees(!fits))
+    {
+      return "skipped";
+    }
+  }
+  else
+  {
+    write_service.WaitForSpace(bytes, max_staged_bytes);
+  }
+
+  std::shared_ptr<detail::StagedWrite> job =
+    std::make_shared<detail::StagedWrite>();
+  data.compact_to(job->m_data);
+  job->m_record.set(record);
+  job->m_record["async/staged_bytes"] = bytes;
+  job->m_bytes = bytes;
+  job->m_write = write;
+
+  if(write_service.m_hdf5_options_set ||
+     hdf5_options.number_of_children() > 0)
+  {
+    // earlier writes may still use the current options
+    write_service.Wait();
+    write_service.RestoreHDF5Options();
+    if(hdf5_options.number_of_children() > 0)
+    {
+      write_service.SetHDF5Options(hdf5_options);
+    }
+  }
+
+  write_service.Submit(job);
+  return "staged";
+}
+
+//-----------------------------------------------------------------------------
+void
+StagedWriter::completed(Node &out)
+{
+  detail::StagedWriteService &write_service = detail::service();
+  std::lock_guard<std::mutex> lock(write_service.m_lock);
+  const int num_completed = write_service.m_completed.number_of_children();
+  for(int i = 0; i < num_completed; ++i)
+  {
+    out.append().set(write_service.m_completed.child(i));
+  }
+  write_service.m_completed.reset();
+}
+
+//-----------------------------------------------------------------------------
+void
+StagedWriter::wait()
+{
+  detail::StagedWriteService &write_service = detail::service();
+  write_service.Wait();
+  write_service.RestoreHDF5Options();
+}
+
+//-----------------------------------------------------------------------------
+void
+StagedWriter::finish()
+{
+  detail::StagedWriteService &write_service = detail::service();
+  write_service.Wait();
+  write_service.RestoreHDF5Options();
+  write_service.Stop();
+  write_service.FreeComm();
+  std::lock_guard<std::mutex> lock(write_service.m_lock);
+  write_service.m_completed.reset();
+}
+
+//-----------------------------------------------------------------------------
+index_t
+StagedWriter::default_max_staged_bytes()
+{
+  // 1 GiB per rank
+  return 1 << 30;
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::filters --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
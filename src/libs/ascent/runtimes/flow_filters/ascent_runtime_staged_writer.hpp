@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_runtime_staged_writer.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef ASCENT_RUNTIME_STAGED_WRITER_HPP
+#define ASCENT_RUNTIME_STAGED_WRITER_HPP
+
+#include <conduit.hpp>
+#include <ascent_exports.h>
+
+#include <functional>
+#include <string>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime --
+//-----------------------------------------------------------------------------
+namespace runtime
+{
+
+//-----------------------------------------------------------------------------
+// -- begin ascent::runtime::filters --
+//-----------------------------------------------------------------------------
+namespace filters
+{
+
+//-----------------------------------------------------------------------------
+// Writes extracts from a dedicated I/O thread.
+//
+// stage() deep copies the data into a staging buffer and returns, the copy
+// is written by the I/O thread while the simulation continues. Writes are
+// done in the order they were staged. Since every rank stages the same
+// extracts in the same order, collective writes on the I/O threads match
+// up across ranks. The I/O threads use their own duplicate of the ascent
+// communicator, which requires MPI_THREAD_MULTIPLE. When MPI was not
+// initialized with MPI_THREAD_MULTIPLE, available() returns false and
+// extracts are written inline.
+//
+// The total size of the staged copies is capped per rank. When a new copy
+// does not fit, the policy decides what happens:
+//
+//   "block"      : wait for earlier writes to finish (default)
+//   "skip_cycle" : skip the extract for this cycle
+//
+// A copy larger than the cap is staged once all earlier writes are done.
+//
+// hdf5 options are process wide, so the I/O thread never sets them. When
+// an extract needs its own hdf5 options, stage() waits for earlier writes
+// and sets them on the calling thread, and they stay in effect until the
+// next call to stage(), wait(), or finish() restores them.
+//-----------------------------------------------------------------------------
+class ASCENT_API StagedWriter
+{
+public:
+  // writes the staged data, the communicator is the I/O thread's
+  // communicator (-1 without mpi)
+  typedef std::function<void(const conduit::Node &data,
+                             int mpi_comm_id)> WriteFunction;
+
+  // false if writes cannot be moved off the main thread
+  static bool available();
+
+  // stages a copy of data. record describes the extract and is reported
+  // back by completed() once the write finishes. returns "staged" or
+  // "skipped". Must be called on all ranks.
+  static std::string stage(const conduit::Node &data,
+                           const conduit::Node &record,
+                           conduit::index_t max_staged_bytes,
+                           const std::string &policy,
+                           WriteFunction write,
+                           const conduit::Node &hdf5_options = conduit::Node());
+
+  // moves the records of writes that finished since the last call into out
+  static void completed(conduit::Node &out);
+
+  // blocks until every staged write is on disk
+  static void wait();
+
+  // waits for all writes and stops the I/O thread. Must be called on all
+  // ranks, once no runtime stages writes anymore.
+  static void finish();
+
+  static conduit::index_t default_max_staged_bytes();
+};
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime::filters --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::runtime --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
@@ -27,11 +27,23 @@
 #include <ascent_expression_eval.hpp>
 #include <ascent_data_object.hpp>
 #include <ascent_logging.hpp>
+#include <ascent_main_runtime.hpp>
 #include <ascent_runtime_param_check.hpp>
 
 #include <flow_graph.hpp>
 #include <flow_workspace.hpp>
 
+#ifdef ASCENT_MPI_ENABLED
+#include <mpi.h>
+#include <conduit_relay_mpi.hpp>
+#endif
+
+// std includes
+#include <exception>
+#include <map>
+#include <memory>
+#include <sstream>
+
 using namespace conduit;
 using namespace std;
 
@@ -55,6 +67,91 @@ namespace runtime
 namespace filters
 {
 
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// runtime kept alive between firings of a trigger. Its flow graph
+// is only rebuilt when the actions change.
+struct TriggerRuntime
+{
+  std::shared_ptr<AscentRuntime> m_runtime;
+  std::string                    m_actions_file;
+  conduit::Node                  m_file_actions;
+};
+
+//-----------------------------------------------------------------------------
+std::map<std::string, TriggerRuntime> &
+trigger_runtimes()
+{
+  static std::map<std::string, TriggerRuntime> runtimes;
+  return runtimes;
+}
+
+//-----------------------------------------------------------------------------
+// > 0 while a trigger executes its actions
+int &
+firing_depth()
+{
+  static int depth = 0;
+  return depth;
+}
+
+//-----------------------------------------------------------------------------
+// loads the file on rank 0 and shares it with the other ranks
+void
+load_actions_file(const std::string &file_name, conduit::Node &actions)
+{
+  int rank = 0;
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
+  MPI_Comm_rank(mpi_comm, &rank);
+#endif
+
+  int valid = 0;
+  std::string emsg = "";
+  if(rank == 0)
+  {
+    std::string curr, next;
+    std::string protocol = "json";
+    conduit::utils::rsplit_string(file_name, ".", curr, next);
+    if(curr == "yaml")
+    {
+      protocol = "yaml";
+    }
+
+    if(!conduit::utils::is_file(file_name))
+    {
+      emsg = "file does not exist";
+    }
+    else
+    {
+      try
+      {
+        actions.load(file_name, protocol);
+        valid = 1;
+      }
+      catch(conduit::Error &e)
+      {
+        emsg = e.message();
+      }
+    }
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Bcast(&valid, 1, MPI_INT, 0, mpi_comm);
+#endif
+  if(valid == 0)
+  {
+    ASCENT_ERROR("Failed to load trigger actions file: "<<file_name
+                 <<"\n"<<emsg);
+  }
+#ifdef ASCENT_MPI_ENABLED
+  conduit::relay::mpi::broadcast_using_schema(actions, 0, mpi_comm);
+#endif
+}
+
+};
 
 //-----------------------------------------------------------------------------
 BasicTrigger::BasicTrigger()
@@ -193,21 +290,88 @@ BasicTrigger::execute()
     bool fire = res["value"].to_uint8() != 0;
     if(fire)
     {
-      Ascent ascent;
+      // every rank fires together, so every rank creates (or
+      // reuses) the runtime for this trigger together
+      // triggers inside of triggers can have the same name, so
+      // key the runtimes by nesting level as well
+      std::stringstream key;
+      key << detail::firing_depth() << "/" << name();
+      detail::TriggerRuntime &trigger = detail::trigger_runtimes()[key.str()];
+      if(trigger.m_runtime == nullptr || trigger.m_actions_file != actions_file)
+      {
+        // the new runtime is owned by the trigger. The replaced one
+        // is idle: a trigger only replaces its own runtime, and a
+        // runtime never executes the trigger that owns it
+        detail::firing_depth()++;
+        trigger.m_runtime.reset();
 
-      Node ascent_opts;
-      ascent_opts["runtime/type"] = "ascent";
+        Node runtime_opts;
 #ifdef ASCENT_MPI_ENABLED
-      ascent_opts["mpi_comm"] = Workspace::default_mpi_comm();
+        runtime_opts["mpi_comm"] = Workspace::default_mpi_comm();
 #endif
-      ascent_opts["actions_file"] = actions_file;
-      ascent.open(ascent_opts);
-      ascent.publish(*n_input);
-      ascent.execute(actions);
-      ascent.close();
+        trigger.m_runtime = std::make_shared<AscentRuntime>();
+        detail::firing_depth()--;
+        trigger.m_runtime->Initialize(runtime_opts);
+        trigger.m_actions_file = actions_file;
+        trigger.m_file_actions.reset();
+        if(actions_file != "")
+        {
+          detail::load_actions_file(actions_file, trigger.m_file_actions);
+        }
+      }
+
+      // hold a reference, nested triggers can add to the map
+      std::shared_ptr<AscentRuntime> trigger_runtime = trigger.m_runtime;
+      const conduit::Node &trigger_actions = actions_file != "" ?
+                                             trigger.m_file_actions :
+                                             actions;
+
+      detail::firing_depth()++;
+      try
+      {
+        // hand over the data as is, it was already checked
+        // when the simulation published it
+        trigger_runtime->PublishDataObject(*data_object);
+        trigger_runtime->Execute(trigger_actions);
+      }
+      catch(conduit::Error &e)
+      {
+        std::stringstream msg;
+        msg << "[Error] Trigger '" << name() << "' "
+            << e.message() << std::endl;
+        trigger_runtime->DisplayError(msg.str());
+      }
+      catch(std::exception &e)
+      {
+        std::stringstream msg;
+        msg << "[Error] Trigger '" << name() << "' "
+            << e.what() << std::endl;
+        trigger_runtime->DisplayError(msg.str());
+      }
+      // the runtime is kept for the next firing, but the
+      // data belongs to this one
+      trigger_runtime->ReleasePublishedObject();
+      detail::firing_depth()--;
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+BasicTrigger::reset_runtimes()
+{
+    // swap first, closing the runtimes calls back into here
+    std::map<std::string, detail::TriggerRuntime> runtimes;
+    runtimes.swap(detail::trigger_runtimes());
+    runtimes.clear();
+}
+
+//-----------------------------------------------------------------------------
+bool
+BasicTrigger::firing()
+{
+    return detail::firing_depth() > 0;
+}
+
 
 //-----------------------------------------------------------------------------
 };
@@ -54,6 +54,13 @@ public:
     virtual bool   verify_params(const conduit::Node &params,
                                  conduit::Node &info);
     virtual void   execute();
+
+    // releases the runtimes kept by fired triggers. Called when the
+    // last top level runtime closes.
+    static void    reset_runtimes();
+    // true while a trigger executes its actions, runtimes
+    // created then are owned by the trigger
+    static bool    firing();
 };
 
 
@@ -163,6 +163,26 @@ VTKHMarchingCubes::verify_params(const conduit::Node &params,
     return res;
 }
 
+//-----------------------------------------------------------------------------
+bool
+VTKHMarchingCubes::cache_signature(conduit::Node &sig)
+{
+    // output only depends on params and input
+    sig["params"] = params();
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void
+VTKHMarchingCubes::cached_output_reused(flow::Data &output)
+{
+    // the cached result was stamped with the cycle it was made in
+    if(output.check_type<DataObject>())
+    {
+        output.value<DataObject>()->refresh_state();
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 VTKHMarchingCubes::execute()
@@ -637,6 +657,26 @@ VTKHCleanGrid::verify_params(const conduit::Node &params,
     return res;
 }
 
+//-----------------------------------------------------------------------------
+bool
+VTKHCleanGrid::cache_signature(conduit::Node &sig)
+{
+    // output only depends on params and input
+    sig["params"] = params();
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void
+VTKHCleanGrid::cached_output_reused(flow::Data &output)
+{
+    // the cached result was stamped with the cycle it was made in
+    if(output.check_type<DataObject>())
+    {
+        output.value<DataObject>()->refresh_state();
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 VTKHCleanGrid::execute()
@@ -1123,6 +1163,26 @@ VTKHGhostStripper::verify_params(const conduit::Node &params,
     return res;
 }
 
+//-----------------------------------------------------------------------------
+bool
+VTKHGhostStripper::cache_signature(conduit::Node &sig)
+{
+    // output only depends on params and input
+    sig["params"] = params();
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void
+VTKHGhostStripper::cached_output_reused(flow::Data &output)
+{
+    // the cached result was stamped with the cycle it was made in
+    if(output.check_type<DataObject>())
+    {
+        output.value<DataObject>()->refresh_state();
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 VTKHGhostStripper::execute()
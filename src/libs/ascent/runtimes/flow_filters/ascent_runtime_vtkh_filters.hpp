@@ -53,6 +53,8 @@ public:
     virtual void   declare_interface(conduit::Node &i);
     virtual bool   verify_params(const conduit::Node &params,
                                  conduit::Node &info);
+    virtual bool   cache_signature(conduit::Node &sig);
+    virtual void   cached_output_reused(flow::Data &output);
     virtual void   execute();
 };
 
@@ -130,6 +132,8 @@ public:
     virtual void   declare_interface(conduit::Node &i);
     virtual bool   verify_params(const conduit::Node &params,
                                  conduit::Node &info);
+    virtual bool   cache_signature(conduit::Node &sig);
+    virtual void   cached_output_reused(flow::Data &output);
     virtual void   execute();
 };
 
@@ -392,6 +396,8 @@ public:
     virtual void   declare_interface(conduit::Node &i);
     virtual bool   verify_params(const conduit::Node &params,
                                  conduit::Node &info);
+    virtual bool   cache_signature(conduit::Node &sig);
+    virtual void   cached_output_reused(flow::Data &output);
     virtual void   execute();
 };
 
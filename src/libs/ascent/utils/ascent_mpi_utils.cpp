@@ -12,6 +12,7 @@
 
 #include "ascent_mpi_utils.hpp"
 #include <flow.hpp>
+#include <atomic>
 #ifdef ASCENT_MPI_ENABLED
 #include <conduit_relay_mpi.hpp>
 #endif
@@ -21,6 +22,30 @@
 //-----------------------------------------------------------------------------
 namespace ascent
 {
+
+namespace detail
+{
+// nanoseconds, so threads can add to it without a lock
+std::atomic<long long> mpi_wait_nanoseconds(0);
+} // namespace detail
+
+MPIWaitTimer::MPIWaitTimer()
+  : m_start(std::chrono::steady_clock::now())
+{
+}
+
+MPIWaitTimer::~MPIWaitTimer()
+{
+  const auto elapsed = std::chrono::steady_clock::now() - m_start;
+  detail::mpi_wait_nanoseconds +=
+    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+double mpi_wait_time()
+{
+  return static_cast<double>(detail::mpi_wait_nanoseconds.load()) * 1e-9;
+}
+
 bool global_agreement(bool vote)
 {
   bool agreement = vote;
@@ -30,12 +55,15 @@ bool global_agreement(bool vote)
 
   int comm_id = flow::Workspace::default_mpi_comm();
   MPI_Comm mpi_comm = MPI_Comm_f2c(comm_id);
-  MPI_Allreduce((void *)(&local_boolean),
-                (void *)(&global_boolean),
-                1,
-                MPI_INT,
-                MPI_SUM,
-                mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce((void *)(&local_boolean),
+                  (void *)(&global_boolean),
+                  1,
+                  MPI_INT,
+                  MPI_SUM,
+                  mpi_comm);
+  }
 
   if(global_boolean != mpi_size())
   {
@@ -54,12 +82,15 @@ bool global_someone_agrees(bool vote)
 
   int comm_id = flow::Workspace::default_mpi_comm();
   MPI_Comm mpi_comm = MPI_Comm_f2c(comm_id);
-  MPI_Allreduce((void *)(&local_boolean),
-                (void *)(&global_boolean),
-                1,
-                MPI_INT,
-                MPI_SUM,
-                mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    MPI_Allreduce((void *)(&local_boolean),
+                  (void *)(&global_boolean),
+                  1,
+                  MPI_INT,
+                  MPI_SUM,
+                  mpi_comm);
+  }
 
   if(global_boolean > 0)
   {
@@ -109,7 +140,10 @@ void gather_strings(std::set<std::string> &string_set)
   conduit::Node res;
   // this is going to give us a list (one item for each rank) of
   // lists (of string for each rank).
-  conduit::relay::mpi::all_gather_using_schema(n_strings, res, mpi_comm);
+  {
+    MPIWaitTimer wait_timer;
+    conduit::relay::mpi::all_gather_using_schema(n_strings, res, mpi_comm);
+  }
   int ranks = res.number_of_children();
   for(int r = 0; r < ranks; ++r)
   {
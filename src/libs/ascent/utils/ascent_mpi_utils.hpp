@@ -12,6 +12,7 @@
 #ifndef ASCENT_MPI_UTILS_HPP
 #define ASCENT_MPI_UTILS_HPP
 
+#include <chrono>
 #include <set>
 #include <string>
 #ifdef ASCENT_MPI_ENABLED
@@ -41,6 +42,25 @@ void gather_strings(std::set<std::string> &set);
 int mpi_rank();
 int mpi_size();
 
+//
+// adds the time it is alive to mpi_wait_time(). declare one in a block
+// that holds only the collective calls, so the time counted is the
+// time this rank is blocked in them.
+//
+class MPIWaitTimer
+{
+public:
+  MPIWaitTimer();
+  ~MPIWaitTimer();
+private:
+  std::chrono::steady_clock::time_point m_start;
+};
+
+//
+// seconds this rank has spent in MPIWaitTimer scopes
+//
+double mpi_wait_time();
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
@@ -16,6 +16,7 @@
 #include <ascent_config.h>
 #include <ascent_logging.hpp>
 #include <ascent_resources.hpp>
+#include <png_utils/ascent_png_writer.hpp>
 
 // thirdparty includes
 #include <lodepng.h>
@@ -190,6 +191,9 @@ WebInterface::PushRenders(const Node &renders)
     {
         return;
     }
+    // make sure queued images are on disk before we read them
+    PNGWriter::Flush();
+
     Node msg;
 
     NodeConstIterator itr = renders.children();
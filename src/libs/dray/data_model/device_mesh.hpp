@@ -60,6 +60,9 @@ template <class ElemT> struct DeviceMesh
 
   DRAY_EXEC_ONLY ElemT get_elem (int32 el_idx) const;
   DRAY_EXEC_ONLY Location locate (const Vec<Float, 3> &point) const;
+  // tries the element of a nearby location (e.g., the previous sample
+  // along a ray) before searching the bvh
+  DRAY_EXEC_ONLY Location locate (const Vec<Float, 3> &point, const Location &hint) const;
 };
 
 
@@ -355,6 +358,40 @@ DRAY_EXEC_ONLY Location DeviceMesh<ElemT>::locate (const Vec<Float, 3> &point) c
   return loc;
 }
 
+template <class ElemT>
+DRAY_EXEC_ONLY Location DeviceMesh<ElemT>::locate (const Vec<Float, 3> &point,
+                                                   const Location &hint) const
+{
+  if (hint.m_cell_id != -1)
+  {
+    Vec<Float, dim> el_coords;
+    for (int32 d = 0; d < dim; ++d)
+    {
+      el_coords[d] = hint.m_ref_pt[d];
+    }
+    // the hint's reference point is the initial guess, so the guess
+    // domain is never used
+    SubRef<dim, etype> unused_box;
+    const bool use_init_guess = true;
+
+    const bool found = detail::LocateHack<ElemT::get_dim ()>::template eval_inverse<ElemT> (
+    get_elem (hint.m_cell_id), point, unused_box, el_coords, use_init_guess);
+
+    if (found)
+    {
+      Location loc{ hint.m_cell_id, { -1.f, -1.f, -1.f } };
+      loc.m_ref_pt[0] = el_coords[0];
+      loc.m_ref_pt[1] = el_coords[1];
+      if (dim == 3)
+      {
+        loc.m_ref_pt[2] = el_coords[2];
+      }
+      return loc;
+    }
+  }
+  return locate (point);
+}
+
 } // namespace dray
 
 
@@ -0,0 +1,298 @@
+// Copyright 2019 Lawrence Livermore National Security, LLC and other
+// Devil Ray Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef DRAY_DEVICE_STRUCTURED_HPP
+#define DRAY_DEVICE_STRUCTURED_HPP
+
+#include <dray/dray_config.h>
+#include <dray/dray_exports.h>
+
+#include <dray/data_model/structured_field.hpp>
+#include <dray/data_model/structured_mesh.hpp>
+#include <dray/location.hpp>
+#include <dray/vec.hpp>
+
+namespace dray
+{
+
+/*
+ * @class DeviceStructuredMesh
+ * @brief Device-safe access to a StructuredMesh.
+ */
+struct DeviceStructuredMesh
+{
+  Vec<int32,3> m_point_dims;
+  int32 m_dims;
+  bool m_is_uniform;
+  Vec<Float,3> m_origin;
+  Vec<Float,3> m_spacing;
+  const Float *m_x_ptr;
+  const Float *m_y_ptr;
+  const Float *m_z_ptr;
+
+  DeviceStructuredMesh() = delete;
+  DeviceStructuredMesh(StructuredMesh &mesh);
+
+  DRAY_EXEC const Float *axis_coords(const int32 axis) const
+  {
+    return axis == 0 ? m_x_ptr : (axis == 1 ? m_y_ptr : m_z_ptr);
+  }
+
+  DRAY_EXEC Vec<int32,3> logical_cell(const int32 cell_id) const
+  {
+    const int32 cells_x = m_point_dims[0] - 1;
+    const int32 cells_y = m_point_dims[1] - 1;
+    Vec<int32,3> idx;
+    idx[0] = cell_id % cells_x;
+    idx[1] = (cell_id / cells_x) % cells_y;
+    idx[2] = cell_id / (cells_x * cells_y);
+    return idx;
+  }
+
+  // finds the cell and reference coordinate of coord along one axis
+  DRAY_EXEC bool locate_axis(const int32 axis,
+                             const Float coord,
+                             int32 &idx,
+                             Float &ref) const
+  {
+    const int32 cells = m_point_dims[axis] - 1;
+    if(cells < 1)
+    {
+      return false;
+    }
+
+    if(m_is_uniform)
+    {
+      const Float t = (coord - m_origin[axis]) / m_spacing[axis];
+      if(!(t >= Float(0.f) && t <= Float(cells)))
+      {
+        return false;
+      }
+      idx = int32(t);
+      // points on the max face belong to the last cell
+      if(idx > cells - 1)
+      {
+        idx = cells - 1;
+      }
+      ref = t - Float(idx);
+      return true;
+    }
+
+    const Float *coords = axis_coords(axis);
+    if(!(coord >= coords[0] && coord <= coords[cells]))
+    {
+      return false;
+    }
+    // largest point index with coords[low] <= coord
+    int32 low = 0;
+    int32 high = cells - 1;
+    while(low < high)
+    {
+      const int32 mid = (low + high + 1) / 2;
+      if(coords[mid] <= coord)
+      {
+        low = mid;
+      }
+      else
+      {
+        high = mid - 1;
+      }
+    }
+    idx = low;
+    ref = (coord - coords[low]) / (coords[low + 1] - coords[low]);
+    return true;
+  }
+
+  DRAY_EXEC Location locate(const Vec<Float,3> &point) const
+  {
+    Location loc{ -1, { -1.f, -1.f, -1.f } };
+    Vec<int32,3> idx = {{0, 0, 0}};
+    Vec<Float,3> ref = {{0.f, 0.f, 0.f}};
+    for(int32 axis = 0; axis < m_dims; ++axis)
+    {
+      if(!locate_axis(axis, point[axis], idx[axis], ref[axis]))
+      {
+        return loc;
+      }
+    }
+
+    const int32 cells_x = m_point_dims[0] - 1;
+    const int32 cells_y = m_point_dims[1] - 1;
+    loc.m_cell_id = (idx[2] * cells_y + idx[1]) * cells_x + idx[0];
+    loc.m_ref_pt[0] = ref[0];
+    loc.m_ref_pt[1] = ref[1];
+    if(m_dims == 3)
+    {
+      loc.m_ref_pt[2] = ref[2];
+    }
+    return loc;
+  }
+
+  // the location of the previous sample does not help here, point
+  // location is already direct
+  DRAY_EXEC Location locate(const Vec<Float,3> &point, const Location &) const
+  {
+    return locate(point);
+  }
+
+  // coordinate of the idx-th point along one axis
+  DRAY_EXEC Float point_coord(const int32 axis, const int32 idx) const
+  {
+    if(m_is_uniform)
+    {
+      return m_origin[axis] + Float(idx) * m_spacing[axis];
+    }
+    return axis_coords(axis)[idx];
+  }
+
+  // size of the cell along each axis
+  DRAY_EXEC Vec<Float,3> cell_size(const int32 cell_id) const
+  {
+    Vec<Float,3> size = {{1.f, 1.f, 1.f}};
+    const Vec<int32,3> idx = logical_cell(cell_id);
+    for(int32 axis = 0; axis < m_dims; ++axis)
+    {
+      if(m_is_uniform)
+      {
+        size[axis] = m_spacing[axis];
+      }
+      else
+      {
+        const Float *coords = axis_coords(axis);
+        size[axis] = coords[idx[axis] + 1] - coords[idx[axis]];
+      }
+    }
+    return size;
+  }
+
+  DRAY_EXEC Vec<Float,3> world_point(const Location &loc) const
+  {
+    Vec<Float,3> point = {{0.f, 0.f, 0.f}};
+    const Vec<int32,3> idx = logical_cell(loc.m_cell_id);
+    for(int32 axis = 0; axis < m_dims; ++axis)
+    {
+      if(m_is_uniform)
+      {
+        point[axis] = m_origin[axis]
+                      + (Float(idx[axis]) + loc.m_ref_pt[axis]) * m_spacing[axis];
+      }
+      else
+      {
+        const Float *coords = axis_coords(axis);
+        const Float lo = coords[idx[axis]];
+        point[axis] = lo + loc.m_ref_pt[axis] * (coords[idx[axis] + 1] - lo);
+      }
+    }
+    return point;
+  }
+};
+
+inline
+DeviceStructuredMesh::DeviceStructuredMesh(StructuredMesh &mesh)
+  : m_point_dims(mesh.m_point_dims),
+    m_dims(mesh.m_dims),
+    m_is_uniform(mesh.m_is_uniform),
+    m_origin(mesh.m_origin),
+    m_spacing(mesh.m_spacing),
+    m_x_ptr(mesh.m_x_coords.get_device_ptr_const()),
+    m_y_ptr(mesh.m_y_coords.get_device_ptr_const()),
+    m_z_ptr(mesh.m_z_coords.get_device_ptr_const())
+{
+}
+
+/*
+ * @class DeviceStructuredField
+ * @brief Device-safe access to a StructuredField.
+ */
+template <int32 ncomp> struct DeviceStructuredField
+{
+  const Vec<Float, ncomp> *m_val_ptr;
+  Vec<int32,3> m_point_dims;
+  int32 m_dims;
+  bool m_vertex_assoc;
+
+  DeviceStructuredField() = delete;
+  DeviceStructuredField(StructuredField<ncomp> &field)
+    : m_val_ptr(field.m_values.get_device_ptr_const()),
+      m_point_dims(field.m_topology->point_dims()),
+      m_dims(field.m_topology->dims()),
+      m_vertex_assoc(field.m_vertex_assoc)
+  {
+  }
+
+  // value and derivatives with respect to the reference coordinates
+  DRAY_EXEC Vec<Float, ncomp> eval_d(const Location &loc,
+                                     Vec<Vec<Float, ncomp>, 3> &ref_deriv) const
+  {
+    for(int32 d = 0; d < 3; ++d)
+    {
+      ref_deriv[d] = 0.f;
+    }
+
+    if(!m_vertex_assoc)
+    {
+      return m_val_ptr[loc.m_cell_id];
+    }
+
+    const int32 cells_x = m_point_dims[0] - 1;
+    const int32 cells_y = m_point_dims[1] - 1;
+    const int32 i = loc.m_cell_id % cells_x;
+    const int32 j = (loc.m_cell_id / cells_x) % cells_y;
+    const int32 k = loc.m_cell_id / (cells_x * cells_y);
+
+    const int32 stride_y = m_point_dims[0];
+    const int32 stride_z = m_point_dims[0] * m_point_dims[1];
+    const int32 base = k * stride_z + j * stride_y + i;
+
+    const Float x = loc.m_ref_pt[0];
+    const Float y = loc.m_ref_pt[1];
+
+    const Vec<Float, ncomp> v00 = m_val_ptr[base];
+    const Vec<Float, ncomp> v10 = m_val_ptr[base + 1];
+    const Vec<Float, ncomp> v01 = m_val_ptr[base + stride_y];
+    const Vec<Float, ncomp> v11 = m_val_ptr[base + stride_y + 1];
+
+    // bilinear on the z = 0 face
+    const Vec<Float, ncomp> lo_y0 = v00 + (v10 - v00) * x;
+    const Vec<Float, ncomp> lo_y1 = v01 + (v11 - v01) * x;
+    const Vec<Float, ncomp> lo = lo_y0 + (lo_y1 - lo_y0) * y;
+
+    if(m_dims == 2)
+    {
+      ref_deriv[0] = (v10 - v00) * (1.f - y) + (v11 - v01) * y;
+      ref_deriv[1] = lo_y1 - lo_y0;
+      return lo;
+    }
+
+    const Float z = loc.m_ref_pt[2];
+    const Vec<Float, ncomp> w00 = m_val_ptr[base + stride_z];
+    const Vec<Float, ncomp> w10 = m_val_ptr[base + stride_z + 1];
+    const Vec<Float, ncomp> w01 = m_val_ptr[base + stride_z + stride_y];
+    const Vec<Float, ncomp> w11 = m_val_ptr[base + stride_z + stride_y + 1];
+
+    // bilinear on the z = 1 face
+    const Vec<Float, ncomp> hi_y0 = w00 + (w10 - w00) * x;
+    const Vec<Float, ncomp> hi_y1 = w01 + (w11 - w01) * x;
+    const Vec<Float, ncomp> hi = hi_y0 + (hi_y1 - hi_y0) * y;
+
+    const Vec<Float, ncomp> lo_dx = (v10 - v00) * (1.f - y) + (v11 - v01) * y;
+    const Vec<Float, ncomp> hi_dx = (w10 - w00) * (1.f - y) + (w11 - w01) * y;
+
+    ref_deriv[0] = lo_dx + (hi_dx - lo_dx) * z;
+    ref_deriv[1] = (lo_y1 - lo_y0) + ((hi_y1 - hi_y0) - (lo_y1 - lo_y0)) * z;
+    ref_deriv[2] = hi - lo;
+    return lo + (hi - lo) * z;
+  }
+
+  DRAY_EXEC Vec<Float, ncomp> eval(const Location &loc) const
+  {
+    Vec<Vec<Float, ncomp>, 3> ref_deriv;
+    return eval_d(loc, ref_deriv);
+  }
+};
+
+} // namespace dray
+
+#endif // DRAY_DEVICE_STRUCTURED_HPP
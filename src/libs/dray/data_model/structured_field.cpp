@@ -0,0 +1,303 @@
+// Copyright 2019 Lawrence Livermore National Security, LLC and other
+// Devil Ray Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <RAJA/RAJA.hpp>
+#include <dray/data_model/structured_field.hpp>
+#include <dray/data_model/device_structured.hpp>
+#include <dray/data_model/unstructured_field.hpp>
+#include <dray/error.hpp>
+#include <dray/error_check.hpp>
+#include <dray/policies.hpp>
+
+namespace dray
+{
+
+namespace detail
+{
+
+template <int32 dim, int32 ncomp>
+struct MakeUnstructuredField
+{
+  static std::shared_ptr<Field> make(const GridFunction<ncomp> &gf,
+                                     const int32 order,
+                                     const std::string &name)
+  {
+    using ElemP0 = Element<dim, ncomp, ElemType::Tensor, Order::Constant>;
+    using ElemP1 = Element<dim, ncomp, ElemType::Tensor, Order::Linear>;
+    std::shared_ptr<Field> res;
+    if(order == 1)
+    {
+      res = std::make_shared<UnstructuredField<ElemP1>>(gf, order, name);
+    }
+    else
+    {
+      res = std::make_shared<UnstructuredField<ElemP0>>(gf, order, name);
+    }
+    return res;
+  }
+};
+
+// there are no 2 component fields on hexes
+template <>
+struct MakeUnstructuredField<3, 2>
+{
+  static std::shared_ptr<Field> make(const GridFunction<2> &,
+                                     const int32,
+                                     const std::string &name)
+  {
+    DRAY_ERROR("Field '"<<name<<"': 2 component fields on 3d meshes are not supported");
+    return nullptr;
+  }
+};
+
+} // namespace detail
+
+template <int32 ncomp>
+StructuredField<ncomp>::StructuredField(const Array<Vec<Float, ncomp>> &values,
+                                        std::shared_ptr<StructuredMesh> mesh,
+                                        bool vertex_assoc,
+                                        const std::string name)
+  : m_values(values),
+    m_topology(mesh),
+    m_vertex_assoc(vertex_assoc),
+    m_range_calculated(false)
+{
+  this->name(name);
+  const int32 expected = m_vertex_assoc ? m_topology->points() : m_topology->cells();
+  if((int32) m_values.size() != expected)
+  {
+    DRAY_ERROR("Field '"<<name<<"' has "<<m_values.size()<<" values, expected "
+               <<expected);
+  }
+}
+
+template <int32 ncomp>
+StructuredField<ncomp>::~StructuredField()
+{
+}
+
+template <int32 ncomp>
+std::vector<Range>
+StructuredField<ncomp>::range() const
+{
+  if(m_range_calculated)
+  {
+    return m_ranges;
+  }
+
+  const int32 size = m_values.size();
+  const Vec<Float, ncomp> *values_ptr = m_values.get_device_ptr_const();
+
+  m_ranges.clear();
+  for(int32 c = 0; c < ncomp; ++c)
+  {
+    RAJA::ReduceMin<reduce_policy, Float> comp_min (infinity<Float>());
+    RAJA::ReduceMax<reduce_policy, Float> comp_max (neg_infinity<Float>());
+
+    RAJA::forall<for_policy> (RAJA::RangeSegment (0, size), [=] DRAY_LAMBDA (int32 ii)
+    {
+      const Float value = values_ptr[ii][c];
+      comp_min.min (value);
+      comp_max.max (value);
+    });
+    DRAY_ERROR_CHECK();
+
+    Range range;
+    if(size > 0)
+    {
+      range.include (comp_min.get ());
+      range.include (comp_max.get ());
+    }
+    m_ranges.push_back(range);
+  }
+
+  m_range_calculated = true;
+  return m_ranges;
+}
+
+template <int32 ncomp>
+int32
+StructuredField<ncomp>::order() const
+{
+  return m_vertex_assoc ? 1 : 0;
+}
+
+template <int32 ncomp>
+int32
+StructuredField<ncomp>::components() const
+{
+  return ncomp;
+}
+
+template <int32 ncomp>
+std::string
+StructuredField<ncomp>::type_name() const
+{
+  std::string name = m_topology->dims() == 3 ? "3D_Structured" : "2D_Structured";
+  name += "_C" + std::to_string(ncomp);
+  return name + (m_vertex_assoc ? "_P1" : "_P0");
+}
+
+template <int32 ncomp>
+void
+StructuredField<ncomp>::to_node(conduit::Node &n_field)
+{
+  unstructured()->to_node(n_field);
+}
+
+template <int32 ncomp>
+void
+StructuredField<ncomp>::eval(const Array<Location> locs, Array<Float> &values)
+{
+  const int32 size = locs.size();
+  // allow people to pass in values
+  if(values.size() != size)
+  {
+    values.resize(size);
+  }
+
+  DeviceStructuredField<ncomp> d_field(*this);
+
+  const Location *locs_ptr = locs.get_device_ptr_const();
+  Float * values_ptr = values.get_device_ptr();
+
+  RAJA::forall<for_policy> (RAJA::RangeSegment (0, size), [=] DRAY_LAMBDA (int32 ii)
+  {
+    const Location loc = locs_ptr[ii];
+    if(loc.m_cell_id != -1)
+    {
+      // like UnstructuredField, only the first component is evaluated
+      values_ptr[ii] = d_field.eval(loc)[0];
+    }
+  });
+  DRAY_ERROR_CHECK();
+}
+
+template <int32 ncomp>
+bool
+StructuredField<ncomp>::is_vertex_assoc() const
+{
+  return m_vertex_assoc;
+}
+
+template <int32 ncomp>
+Array<Vec<Float, ncomp>>
+StructuredField<ncomp>::values() const
+{
+  return m_values;
+}
+
+template <int32 ncomp>
+std::shared_ptr<StructuredMesh>
+StructuredField<ncomp>::structured_mesh() const
+{
+  return m_topology;
+}
+
+template <int32 ncomp>
+Array<Vec<Float,2>>
+StructuredField<ncomp>::macrocell_ranges() const
+{
+  if(m_macrocell_ranges.size() != 0)
+  {
+    return m_macrocell_ranges;
+  }
+
+  const Vec<int32,3> mc_dims = m_topology->macrocell_dims();
+  const int32 num_macrocells = mc_dims[0] * mc_dims[1] * mc_dims[2];
+
+  // vertex values span the points on both sides of the macrocell,
+  // element values only the cells inside it
+  const Vec<int32,3> point_dims = m_topology->point_dims();
+  Vec<int32,3> value_dims = point_dims;
+  if(!m_vertex_assoc)
+  {
+    for(int32 axis = 0; axis < m_topology->dims(); ++axis)
+    {
+      value_dims[axis] = point_dims[axis] - 1;
+    }
+  }
+  const int32 extra = m_vertex_assoc ? 1 : 0;
+  const int32 dims = m_topology->dims();
+  constexpr int32 mc_size = StructuredMesh::macrocell_size;
+
+  const Vec<Float, ncomp> *values_ptr = m_values.get_device_ptr_const();
+
+  m_macrocell_ranges.resize(num_macrocells);
+  Vec<Float,2> *ranges_ptr = m_macrocell_ranges.get_device_ptr();
+
+  RAJA::forall<for_policy> (RAJA::RangeSegment (0, num_macrocells), [=] DRAY_LAMBDA (int32 mc)
+  {
+    Vec<int32,3> mc_idx;
+    mc_idx[0] = mc % mc_dims[0];
+    mc_idx[1] = (mc / mc_dims[0]) % mc_dims[1];
+    mc_idx[2] = mc / (mc_dims[0] * mc_dims[1]);
+
+    Vec<int32,3> start = {{0, 0, 0}};
+    Vec<int32,3> end = {{1, 1, 1}};
+    for(int32 axis = 0; axis < dims; ++axis)
+    {
+      start[axis] = mc_idx[axis] * mc_size;
+      end[axis] = start[axis] + mc_size + extra;
+      if(end[axis] > value_dims[axis])
+      {
+        end[axis] = value_dims[axis];
+      }
+    }
+
+    Vec<Float,2> range = {{infinity<Float>(), neg_infinity<Float>()}};
+    for(int32 k = start[2]; k < end[2]; ++k)
+    {
+      for(int32 j = start[1]; j < end[1]; ++j)
+      {
+        for(int32 i = start[0]; i < end[0]; ++i)
+        {
+          const int32 index = (k * value_dims[1] + j) * value_dims[0] + i;
+          const Float value = values_ptr[index][0];
+          range[0] = min(range[0], value);
+          range[1] = max(range[1], value);
+        }
+      }
+    }
+    ranges_ptr[mc] = range;
+  });
+  DRAY_ERROR_CHECK();
+
+  return m_macrocell_ranges;
+}
+
+template <int32 ncomp>
+std::shared_ptr<Field>
+StructuredField<ncomp>::unstructured()
+{
+  Array<int32> ctrl_idx = m_vertex_assoc ? m_topology->connectivity()
+                                         : m_topology->element_connectivity();
+
+  GridFunction<ncomp> gf;
+  gf.m_values    = m_values;
+  gf.m_ctrl_idx  = ctrl_idx;
+  gf.m_el_dofs   = m_vertex_assoc ? (m_topology->dims() == 3 ? 8 : 4) : 1;
+  gf.m_size_el   = m_topology->cells();
+  gf.m_size_ctrl = ctrl_idx.size();
+
+  const int32 order = this->order();
+  std::shared_ptr<Field> res;
+  if(m_topology->dims() == 3)
+  {
+    res = detail::MakeUnstructuredField<3, ncomp>::make(gf, order, m_name);
+  }
+  else
+  {
+    res = detail::MakeUnstructuredField<2, ncomp>::make(gf, order, m_name);
+  }
+  res->mesh_name(mesh_name());
+  return res;
+}
+
+template class StructuredField<1>;
+template class StructuredField<2>;
+template class StructuredField<3>;
+
+} // namespace dray
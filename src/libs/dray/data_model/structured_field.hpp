@@ -0,0 +1,84 @@
+// Copyright 2019 Lawrence Livermore National Security, LLC and other
+// Devil Ray Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef DRAY_STRUCTURED_FIELD_HPP
+#define DRAY_STRUCTURED_FIELD_HPP
+
+#include <dray/dray_config.h>
+#include <dray/dray_exports.h>
+
+#include <dray/data_model/field.hpp>
+#include <dray/data_model/structured_mesh.hpp>
+#include <dray/array.hpp>
+#include <dray/vec.hpp>
+
+#include <memory>
+
+namespace dray
+{
+
+// forward declare so we can have template friend
+template <int32 ncomp> struct DeviceStructuredField;
+
+/*
+ * @class StructuredField
+ * @brief Vertex or element associated values on a StructuredMesh.
+ *
+ * Values are indexed with the implicit numbering of the mesh, so no
+ * connectivity is stored. Vertex values are interpolated (bi/tri)linearly
+ * and element values are constant.
+ *
+ * Filters that need explicit elements dispatch to unstructured(), which
+ * shares the values and is built for each dispatch, so nothing explicit
+ * is kept with the field.
+ */
+template <int32 ncomp> class StructuredField : public Field
+{
+protected:
+  Array<Vec<Float, ncomp>> m_values;
+  std::shared_ptr<StructuredMesh> m_topology;
+  bool m_vertex_assoc;
+  mutable bool m_range_calculated;
+  mutable std::vector<Range> m_ranges;
+  mutable Array<Vec<Float,2>> m_macrocell_ranges;
+
+public:
+  StructuredField() = delete;
+  StructuredField(const Array<Vec<Float, ncomp>> &values,
+                  std::shared_ptr<StructuredMesh> mesh,
+                  bool vertex_assoc,
+                  const std::string name = "");
+
+  virtual ~StructuredField();
+
+  virtual std::vector<Range> range() const override;
+  virtual int32 order() const override;
+  virtual int32 components() const override;
+  virtual std::string type_name() const override;
+  // writes the explicit representation
+  virtual void to_node(conduit::Node &n_field) override;
+  virtual void eval(const Array<Location> locs, Array<Float> &values) override;
+
+  bool is_vertex_assoc() const;
+  Array<Vec<Float, ncomp>> values() const;
+  std::shared_ptr<StructuredMesh> structured_mesh() const;
+  // (min, max) of the first component in each macrocell of the mesh,
+  // x fastest, computed on first use
+  Array<Vec<Float,2>> macrocell_ranges() const;
+
+  // equivalent UnstructuredField on the mesh's unstructured(),
+  // built on each call
+  std::shared_ptr<Field> unstructured();
+
+  friend struct DeviceStructuredField<ncomp>;
+};
+
+using StructuredScalar    = StructuredField<1>;
+using StructuredVector_2D = StructuredField<2>;
+using StructuredVector    = StructuredField<3>;
+
+} // namespace dray
+
+#endif // DRAY_STRUCTURED_FIELD_HPP
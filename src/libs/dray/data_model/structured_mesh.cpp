@@ -0,0 +1,327 @@
+// Copyright 2019 Lawrence Livermore National Security, LLC and other
+// Devil Ray Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <RAJA/RAJA.hpp>
+#include <dray/data_model/structured_mesh.hpp>
+#include <dray/data_model/device_structured.hpp>
+#include <dray/data_model/unstructured_mesh.hpp>
+#include <dray/array_utils.hpp>
+#include <dray/error.hpp>
+#include <dray/error_check.hpp>
+#include <dray/policies.hpp>
+#include <dray/utils/data_logger.hpp>
+
+namespace dray
+{
+
+Array<int32>
+structured_conn(const Vec<int32,3> &point_dims,
+                bool is_3d,
+                int32 &n_elems)
+{
+  Vec<int32,3> cell_dims;
+  cell_dims[0] = point_dims[0] - 1;
+  cell_dims[1] = point_dims[1] - 1;
+  cell_dims[2] = 1;
+  if(is_3d)
+  {
+    cell_dims[2] = point_dims[2] - 1;
+  }
+  n_elems = cell_dims[0] * cell_dims[1] * cell_dims[2];
+
+  const int32 verts_per_elem = is_3d ? 8 : 4;
+
+  Array<int32> conn;
+  conn.resize(n_elems * verts_per_elem);
+  int32 *conn_ptr = conn.get_device_ptr();
+
+  RAJA::forall<for_policy>(RAJA::RangeSegment(0, n_elems), [=] DRAY_LAMBDA (int32 i)
+  {
+    const int32 offset = i * verts_per_elem;
+    const int32 idx_x = i % cell_dims[0];
+    const int32 idx_y = (i / cell_dims[0]) % cell_dims[1];
+    const int32 idx_z = i / (cell_dims[0] * cell_dims[1]);
+
+    // this is the dray version (lexagraphical ordering x,y,z)
+    const int32 base = (idx_z * point_dims[1] + idx_y) * point_dims[0] + idx_x;
+    conn_ptr[offset + 0] = base;
+    conn_ptr[offset + 1] = base + 1;
+    // advance in y
+    conn_ptr[offset + 2] = base + point_dims[0];
+    conn_ptr[offset + 3] = base + point_dims[0] + 1;
+
+    if(verts_per_elem == 8)
+    {
+      // advance in z
+      const int32 top = base + point_dims[0] * point_dims[1];
+      conn_ptr[offset + 4] = top;
+      conn_ptr[offset + 5] = top + 1;
+      // advance in y
+      conn_ptr[offset + 6] = top + point_dims[0];
+      conn_ptr[offset + 7] = top + point_dims[0] + 1;
+    }
+  });
+  DRAY_ERROR_CHECK();
+
+  return conn;
+}
+
+StructuredMesh::StructuredMesh(const Vec<int32,3> &point_dims,
+                               const Vec<Float,3> &origin,
+                               const Vec<Float,3> &spacing,
+                               const int32 dims)
+  : m_point_dims(point_dims),
+    m_dims(dims),
+    m_is_uniform(true),
+    m_origin(origin),
+    m_spacing(spacing)
+{
+  if(m_dims != 2 && m_dims != 3)
+  {
+    DRAY_ERROR("Structured meshes must be 2d or 3d not "<<m_dims);
+  }
+  if(m_dims == 2)
+  {
+    m_point_dims[2] = 1;
+    m_origin[2] = 0.f;
+  }
+}
+
+StructuredMesh::StructuredMesh(const Array<Float> &x_coords,
+                               const Array<Float> &y_coords,
+                               const Array<Float> &z_coords)
+  : m_dims(z_coords.size() == 0 ? 2 : 3),
+    m_is_uniform(false),
+    m_x_coords(x_coords),
+    m_y_coords(y_coords),
+    m_z_coords(z_coords)
+{
+  m_point_dims[0] = (int32) x_coords.size();
+  m_point_dims[1] = (int32) y_coords.size();
+  m_point_dims[2] = m_dims == 3 ? (int32) z_coords.size() : 1;
+  m_origin = 0.f;
+  m_spacing = 1.f;
+}
+
+StructuredMesh::~StructuredMesh()
+{
+}
+
+int32
+StructuredMesh::cells() const
+{
+  int32 cells = (m_point_dims[0] - 1) * (m_point_dims[1] - 1);
+  if(m_dims == 3)
+  {
+    cells *= m_point_dims[2] - 1;
+  }
+  return cells;
+}
+
+int32
+StructuredMesh::order() const
+{
+  return 1;
+}
+
+int32
+StructuredMesh::dims() const
+{
+  return m_dims;
+}
+
+std::string
+StructuredMesh::type_name() const
+{
+  std::string name = m_dims == 3 ? "3D_Structured" : "2D_Structured";
+  return name + (m_is_uniform ? "_Uniform" : "_Rectilinear");
+}
+
+AABB<3>
+StructuredMesh::bounds()
+{
+  AABB<3> bounds;
+  for(int32 axis = 0; axis < 3; ++axis)
+  {
+    if(axis >= m_dims)
+    {
+      bounds.m_ranges[axis].include(Float(0.f));
+    }
+    else if(m_is_uniform)
+    {
+      const Float extent = Float(m_point_dims[axis] - 1) * m_spacing[axis];
+      bounds.m_ranges[axis].include(m_origin[axis]);
+      bounds.m_ranges[axis].include(m_origin[axis] + extent);
+    }
+    else
+    {
+      const Array<Float> &coords = axis == 0 ? m_x_coords :
+                                   (axis == 1 ? m_y_coords : m_z_coords);
+      const int32 size = coords.size();
+      if(size > 0)
+      {
+        bounds.m_ranges[axis].include(coords.get_value(0));
+        bounds.m_ranges[axis].include(coords.get_value(size - 1));
+      }
+    }
+  }
+  return bounds;
+}
+
+Array<Location>
+StructuredMesh::locate(Array<Vec<Float, 3>> &wpoints)
+{
+  DRAY_LOG_OPEN ("locate");
+
+  const int32 size = wpoints.size ();
+  Array<Location> locations;
+  locations.resize (size);
+
+  Location *loc_ptr = locations.get_device_ptr ();
+  const Vec<Float,3> *points_ptr = wpoints.get_device_ptr_const();
+
+  DeviceStructuredMesh device_mesh (*this);
+
+  RAJA::forall<for_policy> (RAJA::RangeSegment (0, size), [=] DRAY_LAMBDA (int32 i)
+  {
+    loc_ptr[i] = device_mesh.locate(points_ptr[i]);
+  });
+
+  DRAY_ERROR_CHECK();
+  DRAY_LOG_CLOSE();
+
+  return locations;
+}
+
+void
+StructuredMesh::to_node(conduit::Node &n_topo)
+{
+  // the node representation is always explicit, so the receiving
+  // side (e.g., redistribute) does not need to know about us
+  unstructured()->to_node(n_topo);
+}
+
+bool
+StructuredMesh::is_uniform() const
+{
+  return m_is_uniform;
+}
+
+int32
+StructuredMesh::points() const
+{
+  return m_point_dims[0] * m_point_dims[1] * m_point_dims[2];
+}
+
+Vec<int32,3>
+StructuredMesh::point_dims() const
+{
+  return m_point_dims;
+}
+
+Vec<Float,3>
+StructuredMesh::origin() const
+{
+  return m_origin;
+}
+
+Vec<Float,3>
+StructuredMesh::spacing() const
+{
+  return m_spacing;
+}
+
+Vec<int32,3>
+StructuredMesh::macrocell_dims() const
+{
+  Vec<int32,3> dims = {{1, 1, 1}};
+  for(int32 axis = 0; axis < m_dims; ++axis)
+  {
+    const int32 cells = m_point_dims[axis] - 1;
+    dims[axis] = (cells + macrocell_size - 1) / macrocell_size;
+  }
+  return dims;
+}
+
+Array<int32>
+StructuredMesh::connectivity() const
+{
+  int32 n_elems = 0;
+  return structured_conn(m_point_dims, m_dims == 3, n_elems);
+}
+
+Array<int32>
+StructuredMesh::element_connectivity() const
+{
+  return array_counting(cells(), 0, 1);
+}
+
+std::shared_ptr<Mesh>
+StructuredMesh::unstructured()
+{
+  DRAY_LOG_OPEN ("structured_to_unstructured");
+  const int32 n_verts = points();
+  Array<Vec<Float,3>> coords;
+  coords.resize(n_verts);
+  Vec<Float,3> *coords_ptr = coords.get_device_ptr();
+
+  DeviceStructuredMesh device_mesh (*this);
+  const Vec<int32,3> point_dims = m_point_dims;
+  const int32 dims = m_dims;
+
+  RAJA::forall<for_policy> (RAJA::RangeSegment (0, n_verts), [=] DRAY_LAMBDA (int32 i)
+  {
+    Vec<int32,3> idx;
+    idx[0] = i % point_dims[0];
+    idx[1] = (i / point_dims[0]) % point_dims[1];
+    idx[2] = i / (point_dims[0] * point_dims[1]);
+
+    Vec<Float,3> point = {{0.f, 0.f, 0.f}};
+    for(int32 axis = 0; axis < dims; ++axis)
+    {
+      if(device_mesh.m_is_uniform)
+      {
+        point[axis] = device_mesh.m_origin[axis]
+                      + Float(idx[axis]) * device_mesh.m_spacing[axis];
+      }
+      else
+      {
+        point[axis] = device_mesh.axis_coords(axis)[idx[axis]];
+      }
+    }
+    coords_ptr[i] = point;
+  });
+  DRAY_ERROR_CHECK();
+
+  Array<int32> conn = connectivity();
+  const int32 verts_per_elem = m_dims == 3 ? 8 : 4;
+
+  GridFunction<3> gf;
+  gf.m_ctrl_idx = conn;
+  gf.m_values = coords;
+  gf.m_el_dofs = verts_per_elem;
+  gf.m_size_el = cells();
+  gf.m_size_ctrl = conn.size();
+
+  const int32 order = 1;
+  std::shared_ptr<Mesh> res;
+  if(m_dims == 3)
+  {
+    UnstructuredMesh<Hex_P1> mesh (gf, order);
+    res = std::make_shared<HexMesh_P1>(mesh);
+  }
+  else
+  {
+    UnstructuredMesh<Quad_P1> mesh (gf, order);
+    res = std::make_shared<QuadMesh_P1>(mesh);
+  }
+  res->name(m_name);
+
+  DRAY_LOG_ENTRY("cells", cells());
+  DRAY_LOG_CLOSE();
+  return res;
+}
+
+} // namespace dray
@@ -0,0 +1,110 @@
+// Copyright 2019 Lawrence Livermore National Security, LLC and other
+// Devil Ray Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef DRAY_STRUCTURED_MESH_HPP
+#define DRAY_STRUCTURED_MESH_HPP
+
+#include <dray/dray_config.h>
+#include <dray/dray_exports.h>
+
+#include <dray/data_model/mesh.hpp>
+#include <dray/aabb.hpp>
+#include <dray/array.hpp>
+#include <dray/location.hpp>
+#include <dray/vec.hpp>
+
+#include <memory>
+
+namespace dray
+{
+
+// forward declare so we can have friend
+struct DeviceStructuredMesh;
+
+// builds the dray (lexagraphical ordering x,y,z) connectivity of a
+// structured grid of quads or hexes with the given number of points
+Array<int32> structured_conn(const Vec<int32,3> &point_dims,
+                             bool is_3d,
+                             int32 &n_elems);
+
+/*
+ * @class StructuredMesh
+ * @brief Implicit uniform or rectilinear grid of linear quads or hexes.
+ *
+ * Coordinates come from an origin and spacing (uniform) or from one
+ * coordinate array per axis (rectilinear), and the connectivity is computed,
+ * so nothing is stored per point or per cell. Points are located directly
+ * from the coordinates (no BVH), in O(1) for uniform grids.
+ *
+ * Cells are numbered with x varying fastest and the reference coordinates
+ * of a location match the equivalent Hex_P1/Quad_P1 element.
+ *
+ * Filters that need explicit elements dispatch to unstructured(), which
+ * is built for each dispatch and released after it, so the explicit
+ * memory cost is only paid while such a filter runs.
+ */
+class StructuredMesh : public Mesh
+{
+protected:
+  // number of points along each axis, z is 1 for 2d meshes
+  Vec<int32,3> m_point_dims;
+  int32 m_dims;
+  bool m_is_uniform;
+  // uniform
+  Vec<Float,3> m_origin;
+  Vec<Float,3> m_spacing;
+  // rectilinear
+  Array<Float> m_x_coords;
+  Array<Float> m_y_coords;
+  Array<Float> m_z_coords;
+
+public:
+  StructuredMesh() = delete;
+  // uniform
+  StructuredMesh(const Vec<int32,3> &point_dims,
+                 const Vec<Float,3> &origin,
+                 const Vec<Float,3> &spacing,
+                 const int32 dims);
+  // rectilinear, z_coords is empty for 2d meshes
+  StructuredMesh(const Array<Float> &x_coords,
+                 const Array<Float> &y_coords,
+                 const Array<Float> &z_coords);
+
+  virtual ~StructuredMesh();
+
+  virtual int32 cells() const override;
+  virtual int32 order() const override;
+  virtual int32 dims() const override;
+  virtual std::string type_name() const override;
+  virtual AABB<3> bounds() override;
+  virtual Array<Location> locate (Array<Vec<Float, 3>> &wpoints) override;
+  // writes the explicit representation
+  virtual void to_node(conduit::Node &n_topo) override;
+
+  bool is_uniform() const;
+  int32 points() const;
+  Vec<int32,3> point_dims() const;
+  Vec<Float,3> origin() const;
+  Vec<Float,3> spacing() const;
+
+  // cells per axis in a macrocell used for empty space skipping
+  static constexpr int32 macrocell_size = 8;
+  // number of macrocells along each axis, z is 1 for 2d meshes
+  Vec<int32,3> macrocell_dims() const;
+
+  // connectivity of the explicit representation, used by the
+  // vertex associated fields
+  Array<int32> connectivity() const;
+  // 0..cells-1, used by the element associated fields
+  Array<int32> element_connectivity() const;
+  // equivalent QuadMesh_P1 or HexMesh_P1, built on each call
+  std::shared_ptr<Mesh> unstructured();
+
+  friend struct DeviceStructuredMesh;
+};
+
+} // namespace dray
+
+#endif // DRAY_STRUCTURED_MESH_HPP
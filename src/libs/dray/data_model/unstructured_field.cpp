@@ -117,6 +117,39 @@ template <class ElemT> std::vector<Range> get_range (const UnstructuredField<Ele
   return ranges;
 }
 
+// the bernstein basis is positive and a partition of unity, so every
+// value in the element lies between the min and max control points
+template <class ElemT>
+Array<Vec<Float,2>> get_cell_ranges (const UnstructuredField<ElemT> &field)
+{
+  const GridFunction<ElemT::get_ncomp ()> &gf = field.get_dof_data ();
+  const int32 num_elems = gf.m_size_el;
+  const int32 el_dofs = gf.m_el_dofs;
+
+  const int32 *ctrl_idx_ptr = gf.m_ctrl_idx.get_device_ptr_const ();
+  const Vec<Float,ElemT::get_ncomp ()> *val_ptr = gf.m_values.get_device_ptr_const ();
+
+  Array<Vec<Float,2>> cell_ranges;
+  cell_ranges.resize (num_elems);
+  Vec<Float,2> *ranges_ptr = cell_ranges.get_device_ptr ();
+
+  RAJA::forall<for_policy> (RAJA::RangeSegment (0, num_elems), [=] DRAY_LAMBDA (int32 el)
+  {
+    const int32 offset = el * el_dofs;
+    Vec<Float,2> range = {{infinity<Float>(), neg_infinity<Float>()}};
+    for(int32 d = 0; d < el_dofs; ++d)
+    {
+      const Float value = val_ptr[ctrl_idx_ptr[offset + d]][0];
+      range[0] = min (range[0], value);
+      range[1] = max (range[1], value);
+    }
+    ranges_ptr[el] = range;
+  });
+  DRAY_ERROR_CHECK();
+
+  return cell_ranges;
+}
+
 } // namespace detail
 
 template <class ElemT>
@@ -160,7 +193,8 @@ UnstructuredField<ElemT>::UnstructuredField(const UnstructuredField &other)
   : m_dof_data(other.m_dof_data),
     m_poly_order(other.m_poly_order),
     m_range_calculated(other.m_range_calculated),
-    m_ranges(other.m_ranges)
+    m_ranges(other.m_ranges),
+    m_cell_ranges(other.m_cell_ranges)
 {
   this->name(other.name());
 }
@@ -170,7 +204,8 @@ UnstructuredField<ElemT>::UnstructuredField(UnstructuredField &&other)
   : m_dof_data(other.m_dof_data),
     m_poly_order(other.m_poly_order),
     m_range_calculated(other.m_range_calculated),
-    m_ranges(other.m_ranges)
+    m_ranges(other.m_ranges),
+    m_cell_ranges(other.m_cell_ranges)
 {
   this->name(other.name());
 }
@@ -198,6 +233,16 @@ template <class ElemT> std::vector<Range> UnstructuredField<ElemT>::range () con
   return m_ranges;
 }
 
+template <class ElemT>
+Array<Vec<Float,2>> UnstructuredField<ElemT>::cell_ranges () const
+{
+  if(m_cell_ranges.size() == 0)
+  {
+    m_cell_ranges = detail::get_cell_ranges (*this);
+  }
+  return m_cell_ranges;
+}
+
 template <class ElemT>
 int32 UnstructuredField<ElemT>::order() const
 {
@@ -36,6 +36,7 @@ template <class ElemT> class UnstructuredField : public Field
   int32 m_poly_order;
   mutable bool m_range_calculated;
   mutable std::vector<Range> m_ranges;
+  mutable Array<Vec<Float,2>> m_cell_ranges;
 
   public:
   UnstructuredField () = delete; // For now, probably need later.
@@ -81,6 +82,10 @@ template <class ElemT> class UnstructuredField : public Field
 
   virtual std::vector<Range> range () const override;
 
+  // conservative (min, max) of the first component in each element,
+  // computed from the element's control points on first use
+  Array<Vec<Float,2>> cell_ranges () const;
+
   virtual std::string type_name() const override;
 
   static UnstructuredField uniform_field(int32 num_els,
@@ -59,6 +59,32 @@ class DeviceColorMap
   }
 
   DRAY_EXEC Vec<float32, 4> color (const Float &scalar) const
+  {
+    return m_colors[sample_index (scalar)];
+  }
+
+  // true if every scalar in [min_scalar, max_scalar] maps to zero opacity
+  DRAY_EXEC bool is_transparent (const Float &min_scalar, const Float &max_scalar) const
+  {
+    if (m_log_scale && min_scalar <= 0.f)
+    {
+      // outside the domain of the log, be conservative
+      return false;
+    }
+    const int32 min_idx = sample_index (min_scalar);
+    const int32 max_idx = sample_index (max_scalar);
+    for (int32 i = min_idx; i <= max_idx; ++i)
+    {
+      if (m_colors[i][3] > 0.f)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  protected:
+  DRAY_EXEC int32 sample_index (const Float &scalar) const
   {
     Float s = scalar;
 
@@ -71,9 +97,7 @@ class DeviceColorMap
 
     const float32 normalized = static_cast<float32> ((s - m_min) * m_inv_range);
     int32 sample_idx = static_cast<int32> (normalized * float32 (m_size - 1));
-    sample_idx = clamp (sample_idx, 0, m_size - 1);
-    //std::cout<<"s "<<sample_idx<<" "<<scalar<<" mn "<<m_min<<" mx "<<m_max<<"n";
-    return m_colors[sample_idx];
+    return clamp (sample_idx, 0, m_size - 1);
   }
 }; // class device color map
 
@@ -4,6 +4,8 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 
 #include <dray/dispatcher.hpp>
+#include <dray/data_model/structured_field.hpp>
+#include <dray/data_model/structured_mesh.hpp>
 #include <dray/error.hpp>
 #include <sstream>
 
@@ -26,6 +28,37 @@ namespace detail
     msg<<"("<<file<<", "<<line<<")\n";
     DRAY_ERROR(msg.str());
   }
+
+  ExplicitMesh::ExplicitMesh(Mesh *mesh)
+    : m_mesh(mesh)
+  {
+    if(auto *structured = dynamic_cast<StructuredMesh*>(mesh))
+    {
+      m_owned = structured->unstructured();
+      m_mesh = m_owned.get();
+    }
+  }
+
+  ExplicitField::ExplicitField(Field *field)
+    : m_field(field)
+  {
+    if(auto *scalar = dynamic_cast<StructuredScalar*>(field))
+    {
+      m_owned = scalar->unstructured();
+    }
+    else if(auto *vector_2d = dynamic_cast<StructuredVector_2D*>(field))
+    {
+      m_owned = vector_2d->unstructured();
+    }
+    else if(auto *vector = dynamic_cast<StructuredVector*>(field))
+    {
+      m_owned = vector->unstructured();
+    }
+    if(m_owned != nullptr)
+    {
+      m_field = m_owned.get();
+    }
+  }
 }
 
 }
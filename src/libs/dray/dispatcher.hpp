@@ -11,6 +11,7 @@
 #include<dray/error.hpp>
 #include<dray/utils/data_logger.hpp>
 
+#include <memory>
 #include <utility>
 #include <type_traits>
 
@@ -21,6 +22,29 @@ namespace detail
 {
   void cast_mesh_failed(Mesh *mesh, const char *file, unsigned long long line);
   void cast_field_failed(Field *field, const char *file, unsigned long long line);
+
+  // implicit (structured) meshes and fields are dispatched as their
+  // explicit representation. It is built for one dispatch and released
+  // with the holder, everything else passes through as is.
+  class ExplicitMesh
+  {
+  public:
+    explicit ExplicitMesh(Mesh *mesh);
+    Mesh *get() const { return m_mesh; }
+  private:
+    std::shared_ptr<Mesh> m_owned;
+    Mesh *m_mesh;
+  };
+
+  class ExplicitField
+  {
+  public:
+    explicit ExplicitField(Field *field);
+    Field *get() const { return m_field; }
+  private:
+    std::shared_ptr<Field> m_owned;
+    Field *m_field;
+  };
 }
 
 // Scalar dispatch Design note: we can reduce this space since we already know
@@ -208,6 +232,10 @@ bool dispatch_field_only(UnstructuredField<FElemGuessT> *, Field * field, Functo
 template<typename Functor>
 bool dispatch_3d(Mesh *mesh, Field *field, Functor &func)
 {
+  detail::ExplicitMesh explicit_mesh(mesh);
+  detail::ExplicitField explicit_field(field);
+  mesh = explicit_mesh.get();
+  field = explicit_field.get();
   if (!dispatch_mesh_field((HexMesh*)0,    mesh, field, func) &&
       !dispatch_mesh_field((HexMesh_P1*)0, mesh, field, func) &&
       !dispatch_mesh_field((HexMesh_P2*)0, mesh, field, func) &&
@@ -222,6 +250,10 @@ bool dispatch_3d(Mesh *mesh, Field *field, Functor &func)
 template<typename Functor>
 bool dispatch_3d_min_linear(Mesh *mesh, Field *field, Functor &func)
 {
+  detail::ExplicitMesh explicit_mesh(mesh);
+  detail::ExplicitField explicit_field(field);
+  mesh = explicit_mesh.get();
+  field = explicit_field.get();
   if (!dispatch_mesh_field_min_linear((HexMesh*)0,    mesh, field, func) &&
       !dispatch_mesh_field_min_linear((HexMesh_P1*)0, mesh, field, func) &&
       !dispatch_mesh_field_min_linear((HexMesh_P2*)0, mesh, field, func) &&
@@ -236,6 +268,10 @@ bool dispatch_3d_min_linear(Mesh *mesh, Field *field, Functor &func)
 template<typename Functor>
 bool dispatch_2d(Mesh *mesh, Field *field, Functor &func)
 {
+  detail::ExplicitMesh explicit_mesh(mesh);
+  detail::ExplicitField explicit_field(field);
+  mesh = explicit_mesh.get();
+  field = explicit_field.get();
   if (!dispatch_mesh_field((QuadMesh*)0,    mesh, field, func) &&
       !dispatch_mesh_field((QuadMesh_P1*)0, mesh, field, func) &&
       !dispatch_mesh_field((QuadMesh_P2*)0, mesh, field, func) &&
@@ -249,6 +285,10 @@ bool dispatch_2d(Mesh *mesh, Field *field, Functor &func)
 template<typename Functor>
 void dispatch(Mesh *mesh, Field *field, Functor &func)
 {
+  detail::ExplicitMesh explicit_mesh(mesh);
+  detail::ExplicitField explicit_field(field);
+  mesh = explicit_mesh.get();
+  field = explicit_field.get();
   if (!dispatch_mesh_field((HexMesh*)0,    mesh, field, func) &&
       !dispatch_mesh_field((HexMesh_P1*)0, mesh, field, func) &&
       !dispatch_mesh_field((HexMesh_P2*)0, mesh, field, func) &&
@@ -273,6 +313,8 @@ void dispatch(Mesh *mesh, Field *field, Functor &func)
 template<typename Functor>
 void dispatch_3d(Mesh *mesh, Functor &func)
 {
+  detail::ExplicitMesh explicit_mesh(mesh);
+  mesh = explicit_mesh.get();
   if (!dispatch_mesh_only((HexMesh*)0,    mesh, func) &&
       !dispatch_mesh_only((HexMesh_P1*)0, mesh, func) &&
       !dispatch_mesh_only((HexMesh_P2*)0, mesh, func) &&
@@ -285,6 +327,8 @@ void dispatch_3d(Mesh *mesh, Functor &func)
 template<typename Functor>
 void dispatch_2d(Mesh *mesh, Functor &func)
 {
+  detail::ExplicitMesh explicit_mesh(mesh);
+  mesh = explicit_mesh.get();
   if (!dispatch_mesh_only((QuadMesh*)0,    mesh, func) &&
       !dispatch_mesh_only((QuadMesh_P1*)0, mesh, func) &&
       !dispatch_mesh_only((QuadMesh_P2*)0, mesh, func) &&
@@ -297,6 +341,8 @@ void dispatch_2d(Mesh *mesh, Functor &func)
 template<typename Functor>
 void dispatch(Mesh *mesh, Functor &func)
 {
+  detail::ExplicitMesh explicit_mesh(mesh);
+  mesh = explicit_mesh.get();
   if (!dispatch_mesh_only((HexMesh*)0,    mesh, func) &&
       !dispatch_mesh_only((HexMesh_P1*)0, mesh, func) &&
       !dispatch_mesh_only((HexMesh_P2*)0, mesh, func) &&
@@ -322,6 +368,8 @@ void dispatch(Mesh *mesh, Functor &func)
 template<typename Functor>
 void dispatch_3d_scalar(Field *field, Functor &func)
 {
+  detail::ExplicitField explicit_field(field);
+  field = explicit_field.get();
   if (!dispatch_field_only((UnstructuredField<HexScalar>*)0,    field, func) &&
       !dispatch_field_only((UnstructuredField<HexScalar_P1>*)0, field, func) &&
       !dispatch_field_only((UnstructuredField<HexScalar_P2>*)0, field, func) &&
@@ -334,6 +382,8 @@ void dispatch_3d_scalar(Field *field, Functor &func)
 template<typename Functor>
 void dispatch_3d_vector(Field *field, Functor &func)
 {
+  detail::ExplicitField explicit_field(field);
+  field = explicit_field.get();
   if (!dispatch_field_only((UnstructuredField<HexVector>*)0,    field, func) &&
       !dispatch_field_only((UnstructuredField<HexVector_P1>*)0, field, func) &&
       !dispatch_field_only((UnstructuredField<HexVector_P2>*)0, field, func) &&
@@ -346,6 +396,8 @@ void dispatch_3d_vector(Field *field, Functor &func)
 template<typename Functor>
 void dispatch_2d(Field *field, Functor &func)
 {
+  detail::ExplicitField explicit_field(field);
+  field = explicit_field.get();
   if (!dispatch_field_only((UnstructuredField<QuadScalar>*)0,    field, func) &&
       !dispatch_field_only((UnstructuredField<QuadScalar_P1>*)0, field, func) &&
       !dispatch_field_only((UnstructuredField<QuadScalar_P2>*)0, field, func) &&
@@ -358,6 +410,8 @@ void dispatch_2d(Field *field, Functor &func)
 template<typename Functor>
 void dispatch_vector(Field *field, Functor &func)
 {
+  detail::ExplicitField explicit_field(field);
+  field = explicit_field.get();
   if (!dispatch_field_only((UnstructuredField<HexVector>*)0,    field, func) &&
       !dispatch_field_only((UnstructuredField<HexVector_P1>*)0, field, func) &&
       !dispatch_field_only((UnstructuredField<HexVector_P2>*)0, field, func) &&
@@ -384,6 +438,8 @@ void dispatch_vector(Field *field, Functor &func)
 template<typename Functor>
 void dispatch(Field *field, Functor &func)
 {
+  detail::ExplicitField explicit_field(field);
+  field = explicit_field.get();
   if (!dispatch_field_only((UnstructuredField<HexScalar>*)0,    field, func) &&
       !dispatch_field_only((UnstructuredField<HexScalar_P0>*)0, field, func) &&
       !dispatch_field_only((UnstructuredField<HexScalar_P1>*)0, field, func) &&
@@ -437,6 +493,8 @@ void dispatch(Field *field, Functor &func)
 template<typename Functor>
 void dispatch_3d(Field *field, Functor &func)
 {
+  detail::ExplicitField explicit_field(field);
+  field = explicit_field.get();
   if (!dispatch_field_only((UnstructuredField<HexScalar>*)0,    field, func) &&
       !dispatch_field_only((UnstructuredField<HexScalar_P0>*)0, field, func) &&
       !dispatch_field_only((UnstructuredField<HexScalar_P1>*)0, field, func) &&
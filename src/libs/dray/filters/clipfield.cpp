@@ -110,6 +110,10 @@ namespace detail
 template<typename Functor>
 void dispatch_p1(Mesh *mesh, Field *field, Functor &func)
 {
+  detail::ExplicitMesh explicit_mesh(mesh);
+  detail::ExplicitField explicit_field(field);
+  mesh = explicit_mesh.get();
+  field = explicit_field.get();
   if (!dispatch_mesh_field((HexMesh_P1*)0, mesh, field, func) &&
       !dispatch_mesh_field((TetMesh_P1*)0, mesh, field, func)/* &&
 
@@ -124,6 +128,8 @@ void dispatch_p1(Mesh *mesh, Field *field, Functor &func)
 template<typename Functor>
 void dispatch_p0p1(Field *field, Functor &func)
 {
+  detail::ExplicitField explicit_field(field);
+  field = explicit_field.get();
   if (!dispatch_field_only((UnstructuredField<HexScalar_P0>*)0, field, func) &&
       !dispatch_field_only((UnstructuredField<HexScalar_P1>*)0, field, func) &&
       !dispatch_field_only((UnstructuredField<TetScalar_P0>*)0, field, func) &&
@@ -6,6 +6,8 @@
 #include <dray/io/blueprint_low_order.hpp>
 #include <dray/data_model/unstructured_mesh.hpp>
 #include <dray/data_model/unstructured_field.hpp>
+#include <dray/data_model/structured_mesh.hpp>
+#include <dray/data_model/structured_field.hpp>
 #include <dray/error.hpp>
 #include <dray/array_utils.hpp>
 #include "conduit_blueprint.hpp"
@@ -163,6 +165,30 @@ copy_conduit_mcarray_3d(const conduit::Node &n_vals)
 }
 
 
+Array<Float>
+copy_conduit_axis(const conduit::Node &n_vals)
+{
+
+#ifdef DRAY_DOUBLE_PRECISION
+  float64_accessor axis_vals = n_vals.value();
+#else
+  float32_accessor axis_vals = n_vals.value();
+#endif
+
+  int num_vals = axis_vals.number_of_elements();
+  Array<Float> values;
+  values.resize(num_vals);
+
+  Float *values_ptr = values.get_host_ptr();
+
+  for(int32 i = 0; i < num_vals; ++i)
+  {
+      values_ptr[i] = axis_vals[i];
+  }
+
+  return values;
+}
+
 Array<Vec<Float,3>>
 import_explicit_coords(const conduit::Node &n_coords)
 {
@@ -234,98 +260,6 @@ import_explicit_coords(const conduit::Node &n_coords)
 }
 
 
-void
-logical_index_2d(Vec<int32,3> &idx,
-                 const int32 index,
-                 const Vec<int32,3> &dims)
-{
-  idx[0] = index % dims[0];
-  idx[1] = index / dims[0];
-}
-
-void
-logical_index_3d(Vec<int32,3> &idx,
-                 const int32 index,
-                 const Vec<int32,3> &dims)
-{
-  idx[0] = index % dims[0];
-  idx[1] = (index / dims[0]) % dims[1];
-  idx[2] = index / (dims[0] * dims[1]);
-}
-
-Array<int32>
-structured_conn(const Vec<int32,3> point_dims,
-                bool is_3d,
-                int32 &n_elems)
-{
-  Vec<int32,3> cell_dims;
-  cell_dims[0] = point_dims[0] - 1;
-  cell_dims[1] = point_dims[1] - 1;
-  n_elems = cell_dims[0] * cell_dims[1];
-  int32 n_verts = point_dims[0] * point_dims[1];
-  if(is_3d)
-  {
-    cell_dims[2] = point_dims[2] - 1;
-    n_verts *= point_dims[2];
-    n_elems *= cell_dims[2];
-  }
-
-  const int32 verts_per_elem = is_3d ? 8 : 4;
-
-  Array<int32> conn;
-  conn.resize(n_elems * verts_per_elem);
-  int32 *conn_ptr = conn.get_host_ptr();
-
-  for(int32 i = 0; i < n_elems; ++i)
-  {
-    const int32 offset = i * verts_per_elem;
-    Vec<int32,3> idx;
-
-    if(!is_3d)
-    {
-      detail::logical_index_2d(idx, i, cell_dims);
-      // this is the vtk version
-      //conn_ptr[offset + 0] = idx[1] * dims[0] + idx[0];
-      //conn_ptr[offset + 1] = conn_ptr[offset + 0] + 1;
-      //conn_ptr[offset + 2] = conn_ptr[offset + 1] + dims[0];
-      //conn_ptr[offset + 3] = conn_ptr[offset + 2] - 1;
-      // this is the dray version (lexagraphical ordering x,y,z)
-      conn_ptr[offset + 0] = idx[1] * point_dims[0] + idx[0];
-      conn_ptr[offset + 1] = conn_ptr[offset + 0] + 1;
-      conn_ptr[offset + 2] = conn_ptr[offset + 0] + point_dims[0];
-      conn_ptr[offset + 3] = conn_ptr[offset + 2] + 1;
-    }
-    else
-    {
-      detail::logical_index_3d(idx, i, cell_dims);
-      // this is the vtk version
-      //conn_ptr[offset + 0] = (idx[2] * dims[1] + idx[1]) * dims[0] + idx[0];
-      //conn_ptr[offset + 1] = conn_ptr[offset + 0] + 1;
-      //conn_ptr[offset + 2] = conn_ptr[offset + 1] + dims[1];
-      //conn_ptr[offset + 3] = conn_ptr[offset + 2] - 1;
-      //conn_ptr[offset + 4] = conn_ptr[offset + 0] + dims[0] * dims[2];
-      //conn_ptr[offset + 5] = conn_ptr[offset + 4] + 1;
-      //conn_ptr[offset + 6] = conn_ptr[offset + 5] + dims[1];
-      //conn_ptr[offset + 7] = conn_ptr[offset + 6] - 1;
-      // this is the dray version (lexagraphical ordering x,y,z)
-      conn_ptr[offset + 0] = (idx[2] * point_dims[1] + idx[1]) * point_dims[0] + idx[0];
-      conn_ptr[offset + 1] = conn_ptr[offset + 0] + 1;
-
-      // advance in y
-      conn_ptr[offset + 2] = conn_ptr[offset + 0] + point_dims[0];
-      conn_ptr[offset + 3] = conn_ptr[offset + 2] + 1;
-
-      // advance in z
-      conn_ptr[offset + 4] = conn_ptr[offset + 0] + point_dims[0] * point_dims[1];
-      conn_ptr[offset + 5] = conn_ptr[offset + 4] + 1;
-      // advance in y
-      conn_ptr[offset + 6] = conn_ptr[offset + 4] + point_dims[0];
-      conn_ptr[offset + 7] = conn_ptr[offset + 6] + 1;
-    }
-  }
-  return conn;
-}
-
 void
 import_scalar_field(const Node &n_field,
                     int num_elems,
@@ -603,6 +537,45 @@ import_vector_field_3d(const Node &n_field,
     dataset.add_field(field);
 }
 
+// fields on uniform and rectilinear topologies keep the implicit indexing
+void
+import_structured_field(const Node &n_field,
+                        const int32 components,
+                        const std::string &assoc,
+                        const std::string &topo,
+                        std::shared_ptr<StructuredMesh> mesh,
+                        DataSet &dataset)
+{
+    const bool vertex_assoc = assoc == "vertex";
+    const std::string field_name = n_field.name();
+
+    std::shared_ptr<Field> field;
+
+    if(components == 0 || components == 1)
+    {
+        const conduit::Node &n_vals = n_field["values"].number_of_children() == 0
+             ? n_field["values"] : n_field["values"].child(0);
+        Array<Vec<Float,1>> values = detail::copy_conduit_scalar_array(n_vals);
+        field = std::make_shared<StructuredScalar>(values, mesh, vertex_assoc, field_name);
+    }
+    else if(components == 2)
+    {
+        Array<Vec<Float,2>> values = detail::copy_conduit_mcarray_2d(n_field["values"]);
+        field = std::make_shared<StructuredVector_2D>(values, mesh, vertex_assoc, field_name);
+    }
+    else if(components == 3)
+    {
+        Array<Vec<Float,3>> values = detail::copy_conduit_mcarray_3d(n_field["values"]);
+        field = std::make_shared<StructuredVector>(values, mesh, vertex_assoc, field_name);
+    }
+    else
+    {
+        DRAY_ERROR("fields with "<<components<< " components are not supported");
+    }
+
+    field->mesh_name(topo);
+    dataset.add_field(field);
+}
 
 } // namespace detail
 
@@ -619,6 +592,7 @@ BlueprintLowOrder::import(const conduit::Node &n_dataset)
 
   std::map<std::string, std::string> topologies_shapes;
   std::map<std::string, Array<int32>>  topologies_conn;
+  std::map<std::string, std::shared_ptr<StructuredMesh>> structured_topologies;
   const int32 num_topos = n_dataset["topologies"].number_of_children();
   for(int32 i = 0; i < num_topos; ++i)
   {
@@ -640,6 +614,10 @@ BlueprintLowOrder::import(const conduit::Node &n_dataset)
     {
       topo = import_uniform(n_coords, conn, n_elems, shape);
     }
+    else if(mesh_type == "rectilinear")
+    {
+      topo = import_rectilinear(n_coords, conn, n_elems, shape);
+    }
     else if(mesh_type == "unstructured")
     {
       topo = import_explicit(n_coords, n_topo, conn, n_elems, shape);
@@ -656,6 +634,13 @@ BlueprintLowOrder::import(const conduit::Node &n_dataset)
     dataset.add_mesh(topo);
     topologies_shapes[topo_name] = shape;
     topologies_conn[topo_name] = conn;
+
+    std::shared_ptr<StructuredMesh> structured
+      = std::dynamic_pointer_cast<StructuredMesh>(topo);
+    if(structured != nullptr)
+    {
+      structured_topologies[topo_name] = structured;
+    }
   }
 
   const int32 num_fields = n_dataset["fields"].number_of_children();
@@ -676,6 +661,19 @@ BlueprintLowOrder::import(const conduit::Node &n_dataset)
     bool is_scalar = components == 0 || components == 1;
 
     std::string assoc = n_field["association"].as_string();
+
+    auto structured = structured_topologies.find(field_topo);
+    if(structured != structured_topologies.end())
+    {
+      detail::import_structured_field(n_field,
+                                      components,
+                                      assoc,
+                                      field_topo,
+                                      structured->second,
+                                      dataset);
+      continue;
+    }
+
     const int32 n_elems = dataset.mesh(field_topo)->cells();
     Array<int32> conn = topologies_conn[field_topo];
 
@@ -787,7 +785,7 @@ BlueprintLowOrder::import_structured(const conduit::Node &n_coords,
     dims[2] = n_topo_eles["dims/k"].to_int32() + 1;
   }
 
-  conn = detail::structured_conn(dims, is_3d, n_elems);
+  conn = structured_conn(dims, is_3d, n_elems);
 
   const int32 verts_per_elem = is_3d ? 8 : 4;
 
@@ -986,64 +984,63 @@ BlueprintLowOrder::import_uniform(const conduit::Node &n_coords,
     }
   }
 
-  Array<Vec<Float,3>> coords;
-  const int32 n_verts = dims[0] * dims[1] * dims[2];
-  coords.resize(n_verts);
-  Vec<Float,3> *coords_ptr = coords.get_host_ptr();
+  Vec<Float,3> origin;
+  origin[0] = origin_x;
+  origin[1] = origin_y;
+  origin[2] = origin_z;
 
-  for(int32 i = 0; i < n_verts; ++i)
-  {
-    Vec<int32,3> idx;
-    if(is_2d)
-    {
-      detail::logical_index_2d(idx, i, dims);
-    }
-    else
-    {
-      detail::logical_index_3d(idx, i, dims);
-    }
+  Vec<Float,3> spacing;
+  spacing[0] = spacing_x;
+  spacing[1] = spacing_y;
+  spacing[2] = spacing_z;
 
-    Vec<Float,3> point;
-    point[0] = origin_x + idx[0] * spacing_x;
-    point[1] = origin_y + idx[1] * spacing_y;
-    if(is_2d)
-    {
-      point[2] = 0.f;
-    }
-    else
-    {
-      point[2] = origin_z + idx[2] * spacing_z;
-    }
+  // the coordinates and connectivity are implicit, so the
+  // explicit conn is only built if a filter needs it
+  std::shared_ptr<StructuredMesh> res
+    = std::make_shared<StructuredMesh>(dims, origin, spacing, is_2d ? 2 : 3);
+  n_elems = res->cells();
 
-    coords_ptr[i] = point;
+  return res;
+}
+
+std::shared_ptr<Mesh>
+BlueprintLowOrder::import_rectilinear(const conduit::Node &n_coords,
+                                      Array<int32> &conn,
+                                      int32 &n_elems,
+                                      std::string &shape)
+{
+  const std::string type = n_coords["type"].as_string();
+  if(type != "rectilinear")
+  {
+    DRAY_ERROR("bad matt");
   }
 
-  conn = detail::structured_conn(dims, !is_2d, n_elems);
-  const int32 verts_per_elem = is_2d ? 4 : 8;
+  const conduit::Node &n_values = n_coords["values"];
 
-  GridFunction<3> gf;
-  gf.m_ctrl_idx = conn;
-  gf.m_values = coords;
-  gf.m_el_dofs = verts_per_elem;
-  gf.m_size_el = n_elems;
-  gf.m_size_ctrl = conn.size();
+  Array<Float> x_coords = detail::copy_conduit_axis(n_values["x"]);
+  Array<Float> y_coords = detail::copy_conduit_axis(n_values["y"]);
+  Array<Float> z_coords;
 
-  using HexMesh = MeshElem<3u, Tensor, Linear>;
-  using QuadMesh = MeshElem<2u, Tensor, Linear>;
-  int32 order = 1;
+  bool is_2d = true;
+  if(n_values.has_child("z"))
+  {
+    is_2d = false;
+    z_coords = detail::copy_conduit_axis(n_values["z"]);
+  }
 
-  std::shared_ptr<Mesh> res;
   if(is_2d)
   {
-    UnstructuredMesh<QuadMesh> mesh (gf, order);
-    res = std::make_shared<QuadMesh_P1>(mesh);
+    shape = "quad";
   }
   else
   {
-    UnstructuredMesh<HexMesh> mesh (gf, order);
-    res = std::make_shared<HexMesh_P1>(mesh);
+    shape = "hex";
   }
 
+  std::shared_ptr<StructuredMesh> res
+    = std::make_shared<StructuredMesh>(x_coords, y_coords, z_coords);
+  n_elems = res->cells();
+
   return res;
 }
 
@@ -10,6 +10,8 @@
 #include <dray/error_check.hpp>
 #include <RAJA/RAJA.hpp>
 
+#include <limits>
+
 #ifdef DRAY_MPI_ENABLED
 #include <mpi.h>
 #endif
@@ -39,104 +41,126 @@ bool has_data(const Array<Location> &locs)
   return max_value.get() != -1;
 }
 
-#ifdef DRAY_MPI_ENABLED
-// TODO: just put these functions into a mpi_utils class
-void mpi_send(const float32 *data, int32 count, int32 dest, int32 tag, MPI_Comm comm)
+//
+// returns the indices of the points inside the bounds
+//
+Array<int32> points_in_bounds(const Array<Vec<Float,3>> &points, const AABB<3> &bounds)
 {
-  MPI_Send(data, count, MPI_FLOAT, dest, tag, comm);
-}
+  const int32 size = points.size();
+  Vec<Float,3> lo, hi;
+  for(int32 d = 0; d < 3; ++d)
+  {
+    lo[d] = bounds.m_ranges[d].min();
+    hi[d] = bounds.m_ranges[d].max();
+  }
 
-void mpi_send(const float64 *data, int32 count, int32 dest, int32 tag, MPI_Comm comm)
-{
-  MPI_Send(data, count, MPI_DOUBLE, dest, tag, comm);
-}
+  Array<int32> flags;
+  flags.resize(size);
+  int32 *flags_ptr = flags.get_device_ptr();
+  const Vec<Float,3> *points_ptr = points.get_device_ptr_const();
 
-void mpi_recv(float32 *data, int32 count, int32 src, int32 tag, MPI_Comm comm)
-{
-  MPI_Recv(data, count, MPI_FLOAT, src, tag, comm, MPI_STATUS_IGNORE);
-}
+  RAJA::forall<for_policy> (RAJA::RangeSegment (0, size), [=] DRAY_LAMBDA (int32 i)
+  {
+    const Vec<Float,3> point = points_ptr[i];
+    bool inside = true;
+    for(int32 d = 0; d < 3; ++d)
+    {
+      inside &= point[d] >= lo[d] && point[d] <= hi[d];
+    }
+    flags_ptr[i] = inside ? 1 : 0;
+  });
+  DRAY_ERROR_CHECK();
 
-void mpi_recv(float64 *data, int32 count, int32 src, int32 tag, MPI_Comm comm)
-{
-  MPI_Recv(data, count, MPI_DOUBLE, src, tag, comm, MPI_STATUS_IGNORE);
+  return index_flags(flags);
 }
 
-void mpi_bcast(float64 *data, int32 count, int32 root, MPI_Comm comm)
+//
+// copies the located values back into the full array. A point found
+// by more than one domain (e.g., on a shared face) keeps the largest
+// value so local ties resolve the same way as gather_data
+//
+void scatter_located(const Array<Location> &locs,
+                     const Array<int32> &ids,
+                     const Array<Float> &sub_values,
+                     Array<Float> &values,
+                     const Float empty_value)
 {
-  MPI_Bcast(data, count, MPI_DOUBLE, root, comm);
+  const int32 size = ids.size();
+  const Location *locs_ptr = locs.get_device_ptr_const();
+  const int32 *ids_ptr = ids.get_device_ptr_const();
+  const Float *sub_ptr = sub_values.get_device_ptr_const();
+  Float *values_ptr = values.get_device_ptr();
+
+  RAJA::forall<for_policy> (RAJA::RangeSegment (0, size), [=] DRAY_LAMBDA (int32 i)
+  {
+    if(locs_ptr[i].m_cell_id != -1)
+    {
+      const Float current = values_ptr[ids_ptr[i]];
+      const Float value = sub_ptr[i];
+      if(current == empty_value || value > current)
+      {
+        values_ptr[ids_ptr[i]] = value;
+      }
+    }
+  });
+  DRAY_ERROR_CHECK();
 }
 
-void mpi_bcast(float32 *data, int32 count, int32 root, MPI_Comm comm)
+#ifdef DRAY_MPI_ENABLED
+void mpi_allreduce_max(float32 *data, int32 count, MPI_Comm comm)
 {
-  MPI_Bcast(data, count, MPI_FLOAT, root, comm);
+  MPI_Allreduce(MPI_IN_PLACE, data, count, MPI_FLOAT, MPI_MAX, comm);
 }
-#endif
 
-void merge_values(const Float *src, Float *dst, const int32 size, const Float empty_value)
+void mpi_allreduce_max(float64 *data, int32 count, MPI_Comm comm)
 {
-  //  we are doing this on the host because we don't want to pay the mem transfer
-  //  cost and we are just going to turn around and broadcast the data back to
-  //  all ranks
-  for(int32 i = 0; i < size; ++i)
-  {
-    Float value = src[i];
-    if(value != empty_value)
-    {
-      dst[i] = value;
-    }
-  }
+  MPI_Allreduce(MPI_IN_PLACE, data, count, MPI_DOUBLE, MPI_MAX, comm);
 }
+#endif
 
-void gather_data(std::vector<Array<Float>> &values, bool has_data, const Float empty_value)
+//
+// combines the values found on all ranks with a single allreduce.
+// Empty slots are mapped to the lowest value so a max reduction
+// keeps whatever value any rank found ("max-with-empty"). Points
+// found by several ranks (e.g., on a shared face) get the largest
+// of the values, and a located value equal to the empty value is
+// indistinguishable from not found.
+//
+void gather_data(std::vector<Array<Float>> &values, const Float empty_value)
 {
 #ifdef DRAY_MPI_ENABLED
   MPI_Comm comm = MPI_Comm_f2c(dray::mpi_comm());
-  int32 has = has_data ? 1 : 0;
-  int32 mpi_size = dray::mpi_size();
-  int32 mpi_rank = dray::mpi_rank();
-
-  int32 *ranks_data = new int32[mpi_size];
-
-  MPI_Allgather(&has, 1, MPI_INT, ranks_data, 1, MPI_INT, comm);
 
   // we know we have at least one variable
   const int32 array_size = values[0].size();
   // we also know that we are only doing scalars at the moment
-  Float *temp = new Float[array_size];
   const int32 num_vars = values.size();
+  const Float lowest = std::numeric_limits<Float>::lowest();
 
-  // loop through the ranks that actually have line data
-  // and gather the data to rank 0
-  for(int32 rank = 1; rank < mpi_size; ++rank)
+  std::vector<Float> buffer(array_size * num_vars);
+  for(int32 v = 0; v < num_vars; ++v)
   {
-    if(ranks_data[rank] == 1)
+    const Float *values_ptr = values[v].get_host_ptr_const();
+    Float *buffer_ptr = &buffer[v * array_size];
+    for(int32 i = 0; i < array_size; ++i)
     {
-      for(int32 i = 0; i < num_vars; ++i)
-      {
-        if(mpi_rank == 0)
-        {
-          mpi_recv(temp, array_size, rank, 0, comm);
-          merge_values(temp, values[i].get_host_ptr(), array_size, empty_value);
-        }
-        else if(rank == mpi_rank)
-        {
-          mpi_send(values[i].get_host_ptr_const(), array_size, 0, 0, comm);
-        }
-
-      }
+      const Float value = values_ptr[i];
+      buffer_ptr[i] = value != empty_value ? value : lowest;
     }
   }
-  // now turn around and broadcast the data back to all ranks
-  // NOTE: we could make this a parameter, but we might use this
-  // within ascent's expressions so all ranks would need the data
-  for(int32 i = 0; i < num_vars; ++i)
-  {
-    mpi_bcast(values[i].get_host_ptr(), array_size, 0, comm);
-  }
 
-  delete[] temp;
-  delete[] ranks_data;
+  mpi_allreduce_max(buffer.data(), static_cast<int32>(buffer.size()), comm);
 
+  for(int32 v = 0; v < num_vars; ++v)
+  {
+    Float *values_ptr = values[v].get_host_ptr();
+    const Float *buffer_ptr = &buffer[v * array_size];
+    for(int32 i = 0; i < array_size; ++i)
+    {
+      const Float value = buffer_ptr[i];
+      values_ptr[i] = value != lowest ? value : empty_value;
+    }
+  }
 #endif
 }
 
@@ -254,28 +278,49 @@ PointLocation::execute(Collection &collection, Array<Vec<Float,3>> &points)
     array_memset(values[i], m_empty_val);
   }
 
-  bool has_data = false;
   for(int32 i = 0; i < collection.local_size(); ++i)
   {
-    // we are looping over all the points in each domain.
-    // if the points are not found, the values won't be updated,
-    // so at the end, we will should have all the field values
+    // only the points inside the bounds of the domain are located,
+    // and the values of the points that are found are copied back
+    // into the full arrays
     DataSet data_set = collection.domain(i);
-    Array<Location> locs = data_set.mesh()->locate(points);
-    bool domain_has_data = detail::has_data(locs);
-    if(domain_has_data)
+    AABB<3> dom_bounds = data_set.mesh()->bounds();
+    if(dom_bounds.is_empty())
     {
-      has_data = true;
-      for(int32 f = 0; f < valid_size; ++f)
-      {
-        // TODO: one day we might need to check if this
-        // particular data has each field
-        data_set.field(valid_vars[f])->eval(locs, values[f]);
-      }
+      continue;
+    }
+    // pad the bounds a bit so points on the faces of the
+    // domain are never culled by round off
+    float32 pad = dom_bounds.max_length() * 1e-5f;
+    if(pad > 0.f)
+    {
+      dom_bounds.expand(pad);
+    }
+
+    Array<int32> ids = detail::points_in_bounds(points, dom_bounds);
+    if(ids.size() == 0)
+    {
+      continue;
+    }
+    Array<Vec<Float,3>> sub_points = gather(points, ids);
+    Array<Location> locs = data_set.mesh()->locate(sub_points);
+    if(!detail::has_data(locs))
+    {
+      continue;
+    }
+
+    Array<Float> sub_values;
+    sub_values.resize(ids.size());
+    for(int32 f = 0; f < valid_size; ++f)
+    {
+      // TODO: one day we might need to check if this
+      // particular data has each field
+      data_set.field(valid_vars[f])->eval(locs, sub_values);
+      detail::scatter_located(locs, ids, sub_values, values[f], m_empty_val);
     }
   }
 
-  detail::gather_data(values, has_data, m_empty_val);
+  detail::gather_data(values, m_empty_val);
 
   Result res;
   res.m_points = points;
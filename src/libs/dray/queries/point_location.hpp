@@ -6,6 +6,12 @@
 namespace dray
 {
 
+//
+// Evaluates fields at a set of points. Points that are not inside any
+// domain get the empty value. Points found by more than one domain,
+// locally or on other ranks (e.g., points on a shared face), get the
+// largest of the located values.
+//
 class PointLocation
 {
 protected:
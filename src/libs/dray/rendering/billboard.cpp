@@ -4,6 +4,7 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 
 #include <dray/rendering/billboard.hpp>
+#include <dray/rendering/aabb_intersection.hpp>
 #include <dray/rendering/device_framebuffer.hpp>
 #include <dray/rendering/font_factory.hpp>
 #include <dray/array_utils.hpp>
@@ -47,51 +48,6 @@ AABB<3> bound_sphere(const Vec<float32,3> &center, const float32 radius)
 
   return res;
 }
-// I need to consolidate all this
-template <typename T>
-DRAY_EXEC_ONLY bool intersect_AABB (const Vec<float32, 4> *bvh,
-                                    const int32 &currentNode,
-                                    const Vec<T, 3> &orig_dir,
-                                    const Vec<T, 3> &inv_dir,
-                                    const T &closest_dist,
-                                    bool &hit_left,
-                                    bool &hit_right,
-                                    const T &min_dist) // Find hit after this distance
-{
-  Vec<float32, 4> first4 = const_get_vec4f (&bvh[currentNode + 0]);
-  Vec<float32, 4> second4 = const_get_vec4f (&bvh[currentNode + 1]);
-  Vec<float32, 4> third4 = const_get_vec4f (&bvh[currentNode + 2]);
-  T xmin0 = first4[0] * inv_dir[0] - orig_dir[0];
-  T ymin0 = first4[1] * inv_dir[1] - orig_dir[1];
-  T zmin0 = first4[2] * inv_dir[2] - orig_dir[2];
-  T xmax0 = first4[3] * inv_dir[0] - orig_dir[0];
-  T ymax0 = second4[0] * inv_dir[1] - orig_dir[1];
-  T zmax0 = second4[1] * inv_dir[2] - orig_dir[2];
-  T min0 =
-  fmaxf (fmaxf (fmaxf (fminf (ymin0, ymax0), fminf (xmin0, xmax0)), fminf (zmin0, zmax0)),
-         min_dist);
-  T max0 =
-  fminf (fminf (fminf (fmaxf (ymin0, ymax0), fmaxf (xmin0, xmax0)), fmaxf (zmin0, zmax0)),
-         closest_dist);
-  hit_left = (max0 >= min0);
-
-  T xmin1 = second4[2] * inv_dir[0] - orig_dir[0];
-  T ymin1 = second4[3] * inv_dir[1] - orig_dir[1];
-  T zmin1 = third4[0] * inv_dir[2] - orig_dir[2];
-  T xmax1 = third4[1] * inv_dir[0] - orig_dir[0];
-  T ymax1 = third4[2] * inv_dir[1] - orig_dir[1];
-  T zmax1 = third4[3] * inv_dir[2] - orig_dir[2];
-
-  T min1 =
-  fmaxf (fmaxf (fmaxf (fminf (ymin1, ymax1), fminf (xmin1, xmax1)), fminf (zmin1, zmax1)),
-         min_dist);
-  T max1 =
-  fminf (fminf (fminf (fmaxf (ymin1, ymax1), fmaxf (xmin1, xmax1)), fmaxf (zmin1, zmax1)),
-         closest_dist);
-  hit_right = (max1 >= min1);
-
-  return (min0 > min1);
-}
 
 }// namespace detail
 
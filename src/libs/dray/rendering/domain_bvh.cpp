@@ -0,0 +1,289 @@
+// Copyright 2019 Lawrence Livermore National Security, LLC and other
+// Devil Ray Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <dray/rendering/domain_bvh.hpp>
+#include <dray/rendering/aabb_intersection.hpp>
+#include <dray/array_utils.hpp>
+#include <dray/error_check.hpp>
+#include <dray/linear_bvh_builder.hpp>
+#include <dray/math.hpp>
+#include <dray/policies.hpp>
+
+#include <algorithm>
+
+namespace dray
+{
+
+namespace detail
+{
+
+//
+// Walks the domain bvh for every ray and records each domain whose
+// bounds the ray crosses. When ray_ids_ptr is null, this only counts
+// the rays per domain. Otherwise the ray index is written into the
+// slot for that domain (cursor_ptr holds the next free slot).
+//
+void traverse_domains(const Array<Ray> &rays,
+                      const BVH &bvh,
+                      int32 *cursor_ptr,
+                      int32 *ray_ids_ptr)
+{
+  const int32 size = rays.size();
+  const Ray *ray_ptr = rays.get_device_ptr_const();
+  const int32 *leaf_ptr = bvh.m_leaf_nodes.get_device_ptr_const();
+  const Vec<float32, 4> *inner_ptr = bvh.m_inner_nodes.get_device_ptr_const();
+  const bool count_only = ray_ids_ptr == nullptr;
+
+  RAJA::forall<for_policy>(RAJA::RangeSegment(0, size), [=] DRAY_LAMBDA (int32 i)
+  {
+    const Ray ray = ray_ptr[i];
+
+    const Float closest_dist = ray.m_far;
+    const Float min_dist = ray.m_near;
+    const Vec<Float,3> dir = ray.m_dir;
+    Vec<Float,3> inv_dir;
+    inv_dir[0] = rcp_safe(dir[0]);
+    inv_dir[1] = rcp_safe(dir[1]);
+    inv_dir[2] = rcp_safe(dir[2]);
+
+    int32 current_node;
+    int32 todo[64];
+    int32 stackptr = 0;
+    current_node = 0;
+
+    constexpr int32 barrier = -2000000000;
+    todo[stackptr] = barrier;
+
+    const Vec<Float,3> orig = ray.m_orig;
+
+    Vec<Float,3> orig_dir;
+    orig_dir[0] = orig[0] * inv_dir[0];
+    orig_dir[1] = orig[1] * inv_dir[1];
+    orig_dir[2] = orig[2] * inv_dir[2];
+
+    while (current_node != barrier)
+    {
+      if (current_node > -1)
+      {
+        bool hit_left, hit_right;
+        bool right_closer = intersect_AABB(inner_ptr,
+                                           current_node,
+                                           orig_dir,
+                                           inv_dir,
+                                           closest_dist,
+                                           hit_left,
+                                           hit_right,
+                                           min_dist);
+
+        if (!hit_left && !hit_right)
+        {
+          current_node = todo[stackptr];
+          stackptr--;
+        }
+        else
+        {
+          Vec<float32, 4> children = const_get_vec4f(&inner_ptr[current_node + 3]);
+          int32 l_child;
+          constexpr int32 isize = sizeof(int32);
+          memcpy(&l_child, &children[0], isize);
+          int32 r_child;
+          memcpy(&r_child, &children[1], isize);
+          current_node = (hit_left) ? l_child : r_child;
+
+          if (hit_left && hit_right)
+          {
+            if (right_closer)
+            {
+              current_node = r_child;
+              stackptr++;
+              todo[stackptr] = l_child;
+            }
+            else
+            {
+              stackptr++;
+              todo[stackptr] = r_child;
+            }
+          }
+        }
+      } // if inner node
+
+      if (current_node < 0 && current_node != barrier)
+      {
+        current_node = -current_node - 1; //swap the neg address
+
+        const int32 domain = leaf_ptr[current_node];
+        const int32 slot = RAJA::atomicAdd<atomic_policy>(&cursor_ptr[domain], 1);
+        if(!count_only)
+        {
+          ray_ids_ptr[slot] = i;
+        }
+
+        current_node = todo[stackptr];
+        stackptr--;
+      } // if leaf node
+
+    } //while
+
+  });
+  DRAY_ERROR_CHECK();
+}
+
+} // namespace detail
+
+DomainBVH::DomainBVH(Collection &collection)
+  : m_num_leaves(0)
+{
+  const int32 num_domains = collection.local_size();
+  m_bounds.resize(num_domains);
+
+  std::vector<AABB<>> leaf_bounds;
+  std::vector<int32> leaf_ids;
+  for(int32 d = 0; d < num_domains; ++d)
+  {
+    AABB<> bounds = collection.domain(d).mesh()->bounds();
+    m_bounds[d] = bounds;
+    if(bounds.is_empty())
+    {
+      continue;
+    }
+    // pad the bounds a bit so hits on the faces of the
+    // domain are never culled by round off
+    float32 pad = bounds.max_length() * 1e-5f;
+    if(pad > 0.f)
+    {
+      bounds.expand(pad);
+    }
+    leaf_bounds.push_back(bounds);
+    leaf_ids.push_back(d);
+  }
+
+  m_num_leaves = static_cast<int32>(leaf_bounds.size());
+  if(!valid())
+  {
+    return;
+  }
+
+  Array<AABB<>> aabbs(leaf_bounds.data(), m_num_leaves);
+  Array<int32> primitive_ids(leaf_ids.data(), m_num_leaves);
+  LinearBVHBuilder builder;
+  m_bvh = builder.construct(aabbs, primitive_ids);
+}
+
+bool
+DomainBVH::valid() const
+{
+  // the bvh needs two leaves, and one domain does
+  // not need any help
+  return m_num_leaves > 1;
+}
+
+void
+DomainBVH::bin_rays(const Array<Ray> &rays, std::vector<Array<int32>> &ray_ids)
+{
+  const int32 num_domains = static_cast<int32>(m_bounds.size());
+  ray_ids.clear();
+  ray_ids.resize(num_domains);
+
+  // count, then fill the rays for each domain into
+  // one flat array
+  Array<int32> cursors;
+  cursors.resize(num_domains);
+  array_memset_zero(cursors);
+  detail::traverse_domains(rays, m_bvh, cursors.get_device_ptr(), nullptr);
+
+  int32 total = 0;
+  Array<int32> offsets = array_exc_scan_plus(cursors, total);
+  if(total == 0)
+  {
+    return;
+  }
+
+  Array<int32> flat_ids;
+  flat_ids.resize(total);
+  array_copy(cursors, offsets);
+  detail::traverse_domains(rays,
+                           m_bvh,
+                           cursors.get_device_ptr(),
+                           flat_ids.get_device_ptr());
+
+  // slice out the rays of each domain
+  const int32 *offsets_ptr = offsets.get_host_ptr_const();
+  for(int32 d = 0; d < num_domains; ++d)
+  {
+    const int32 begin = offsets_ptr[d];
+    const int32 end = d + 1 < num_domains ? offsets_ptr[d + 1] : total;
+    const int32 count = end - begin;
+    if(count == 0)
+    {
+      continue;
+    }
+
+    ray_ids[d].resize(count);
+    const int32 *flat_ptr = flat_ids.get_device_ptr_const();
+    int32 *ids_ptr = ray_ids[d].get_device_ptr();
+    RAJA::forall<for_policy>(RAJA::RangeSegment(0, count), [=] DRAY_LAMBDA (int32 i)
+    {
+      ids_ptr[i] = flat_ptr[begin + i];
+    });
+    DRAY_ERROR_CHECK();
+  }
+}
+
+std::vector<int32>
+DomainBVH::front_to_back(const Vec<float32,3> &point) const
+{
+  const int32 num_domains = static_cast<int32>(m_bounds.size());
+  // distance from the point to the closest point of each domain
+  std::vector<float32> dists(num_domains);
+  std::vector<int32> order(num_domains);
+  for(int32 d = 0; d < num_domains; ++d)
+  {
+    order[d] = d;
+    if(m_bounds[d].is_empty())
+    {
+      dists[d] = infinity32();
+      continue;
+    }
+    float32 dist2 = 0.f;
+    for(int32 i = 0; i < 3; ++i)
+    {
+      const float32 lo = m_bounds[d].m_ranges[i].min();
+      const float32 hi = m_bounds[d].m_ranges[i].max();
+      float32 delta = 0.f;
+      if(point[i] < lo)
+      {
+        delta = lo - point[i];
+      }
+      else if(point[i] > hi)
+      {
+        delta = point[i] - hi;
+      }
+      dist2 += delta * delta;
+    }
+    dists[d] = dist2;
+  }
+
+  std::stable_sort(order.begin(), order.end(),
+                   [&dists](int32 a, int32 b) { return dists[a] < dists[b]; });
+  return order;
+}
+
+void scatter_ray_max(Array<Ray> &rays,
+                     const Array<Ray> &sub_rays,
+                     const Array<int32> &ray_ids)
+{
+  const int32 size = ray_ids.size();
+  Ray *ray_ptr = rays.get_device_ptr();
+  const Ray *sub_ptr = sub_rays.get_device_ptr_const();
+  const int32 *ids_ptr = ray_ids.get_device_ptr_const();
+
+  RAJA::forall<for_policy>(RAJA::RangeSegment(0, size), [=] DRAY_LAMBDA (int32 i)
+  {
+    ray_ptr[ids_ptr[i]].m_far = sub_ptr[i].m_far;
+  });
+  DRAY_ERROR_CHECK();
+}
+
+} // namespace dray
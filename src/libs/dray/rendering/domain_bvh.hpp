@@ -0,0 +1,49 @@
+// Copyright 2019 Lawrence Livermore National Security, LLC and other
+// Devil Ray Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef DRAY_DOMAIN_BVH_HPP
+#define DRAY_DOMAIN_BVH_HPP
+
+#include <dray/array.hpp>
+#include <dray/bvh.hpp>
+#include <dray/ray.hpp>
+#include <dray/data_model/collection.hpp>
+
+#include <vector>
+
+namespace dray
+{
+/**
+ * \class DomainBVH
+ * \brief Top level BVH over the local domains of a collection
+ *
+ * Used by the renderer so each ray is only traced against the domains
+ * whose bounds it crosses, instead of against every domain.
+ */
+class DomainBVH
+{
+protected:
+  BVH m_bvh;
+  std::vector<AABB<3>> m_bounds;
+  int32 m_num_leaves;
+public:
+  DomainBVH(Collection &collection);
+  /// false if there are too few non-empty domains to be worth it
+  bool valid() const;
+  /// bins the rays by the domains whose bounds they cross between
+  /// m_near and m_far. ray_ids[d] holds the indices of the rays that
+  /// need to be traced against domain d (empty if none).
+  void bin_rays(const Array<Ray> &rays, std::vector<Array<int32>> &ray_ids);
+  /// domain indices sorted front to back as seen from point
+  std::vector<int32> front_to_back(const Vec<float32,3> &point) const;
+};
+
+// copies the far distances of the ray subset back to the full set of rays
+void scatter_ray_max(Array<Ray> &rays,
+                     const Array<Ray> &sub_rays,
+                     const Array<int32> &ray_ids);
+
+} // namespace dray
+#endif
@@ -4,10 +4,12 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 
 #include <dray/rendering/renderer.hpp>
+#include <dray/rendering/domain_bvh.hpp>
 #include <dray/rendering/volume.hpp>
 #include <dray/rendering/screen_annotator.hpp>
 #include <dray/rendering/world_annotator.hpp>
 #include <dray/utils/data_logger.hpp>
+#include <dray/array_utils.hpp>
 #include <dray/dray.hpp>
 #include <dray/error.hpp>
 #include <dray/error_check.hpp>
@@ -166,7 +168,9 @@ Renderer::Renderer()
     m_world_annotations(false),
     m_color_bar(true),
     m_triad(false),
-    m_max_color_bars(2)
+    m_domain_culling(true),
+    m_max_color_bars(2),
+    m_culled_rays(0)
 {
 }
 
@@ -190,6 +194,16 @@ void Renderer::triad(bool on)
   m_triad = on;
 }
 
+void Renderer::domain_culling(bool on)
+{
+  m_domain_culling = on;
+}
+
+int64 Renderer::culled_rays() const
+{
+  return m_culled_rays;
+}
+
 void Renderer::clear_lights()
 {
   m_lights.clear();
@@ -259,24 +273,40 @@ Framebuffer Renderer::render(Camera &camera)
   const int32 size = m_traceables.size();
 
   bool need_composite = false;
+  m_culled_rays = 0;
   for(int i = 0; i < size; ++i)
   {
     const int domains = m_traceables[i]->num_domains();
-    for(int d = 0; d < domains; ++d)
+    DomainBVH domain_bvh(m_traceables[i]->collection());
+    if(m_domain_culling && domains > 1 && domain_bvh.valid())
     {
-      m_traceables[i]->active_domain(d);
-      Array<RayHit> hits = m_traceables[i]->nearest_hit(rays);
-      Array<Fragment> fragments = m_traceables[i]->fragments(hits);
-      if(m_use_lighting)
+      // only trace rays against the domains they cross and
+      // go front to back so closer hits cull more rays
+      Timer timer;
+      std::vector<Array<int32>> ray_ids;
+      domain_bvh.bin_rays(rays, ray_ids);
+      DRAY_LOG_ENTRY("bin_rays",timer.elapsed());
+      std::vector<int32> order = domain_bvh.front_to_back(camera.get_pos());
+      for(const int32 d : order)
       {
-        m_traceables[i]->shade(rays, hits, fragments, lights, framebuffer);
+        m_culled_rays += rays.size() - ray_ids[d].size();
+        if(ray_ids[d].size() == 0)
+        {
+          continue;
+        }
+        m_traceables[i]->active_domain(d);
+        Array<Ray> domain_rays = gather(rays, ray_ids[d]);
+        trace(*m_traceables[i], domain_rays, lights, framebuffer);
+        scatter_ray_max(rays, domain_rays, ray_ids[d]);
       }
-      else
+    }
+    else
+    {
+      for(int d = 0; d < domains; ++d)
       {
-        m_traceables[i]->shade(rays, hits, fragments, framebuffer);
+        m_traceables[i]->active_domain(d);
+        trace(*m_traceables[i], rays, lights, framebuffer);
       }
-
-      ray_max(rays, hits);
     }
     // we just did some rendering so we need to composite
     need_composite = true;
@@ -362,6 +392,25 @@ Framebuffer Renderer::render(Camera &camera)
   return framebuffer;
 }
 
+void Renderer::trace(Traceable &traceable,
+                     Array<Ray> &rays,
+                     Array<PointLight> &lights,
+                     Framebuffer &framebuffer)
+{
+  Array<RayHit> hits = traceable.nearest_hit(rays);
+  Array<Fragment> fragments = traceable.fragments(hits);
+  if(m_use_lighting)
+  {
+    traceable.shade(rays, hits, fragments, lights, framebuffer);
+  }
+  else
+  {
+    traceable.shade(rays, hits, fragments, framebuffer);
+  }
+
+  ray_max(rays, hits);
+}
+
 void Renderer::composite(Array<Ray> &rays,
                          Camera &camera,
                          Framebuffer &framebuffer,
@@ -28,7 +28,16 @@ protected:
   bool m_world_annotations;
   bool m_color_bar;
   bool m_triad;
+  bool m_domain_culling;
   int32 m_max_color_bars;
+  // ray / domain pairs the domain bvh skipped in the last render
+  int64 m_culled_rays;
+
+  // traces the active domain of the traceable and shades the hits
+  void trace(Traceable &traceable,
+             Array<Ray> &rays,
+             Array<PointLight> &lights,
+             Framebuffer &framebuffer);
 
 public:
   Renderer();
@@ -49,6 +58,10 @@ public:
   void triad(bool on);
   void world_annotations(bool on);
   void max_color_bars(const int32 max_bars);
+  /// trace rays only against the domains whose bounds they cross (default on)
+  void domain_culling(bool on);
+  /// number of ray / domain traces skipped by culling in the last render
+  int64 culled_rays() const;
 
 };
 
@@ -8,6 +8,7 @@
 #include <dray/array_utils.hpp>
 #include <dray/utils/data_logger.hpp>
 #include <dray/data_model/device_field.hpp>
+#include <dray/data_model/device_structured.hpp>
 
 #include <assert.h>
 
@@ -97,6 +98,45 @@ get_fragments(UnstructuredField<ElementType> &field,
   return fragments;
 }
 
+// structured fields are evaluated directly from the implicit indexing
+Array<Fragment>
+get_fragments(StructuredScalar &field,
+              Array<RayHit> &hits,
+              Vec<float32,3> normal)
+{
+  const int32 size = hits.size();
+
+  Array<Fragment> fragments;
+  fragments.resize(size);
+  Fragment *fragment_ptr = fragments.get_device_ptr();
+
+  const RayHit *hit_ptr = hits.get_device_ptr_const();
+
+  DeviceStructuredField<1> device_field(field);
+  RAJA::forall<for_policy>(RAJA::RangeSegment(0, size), [=] DRAY_LAMBDA (int32 i)
+  {
+    Fragment frag;
+    frag.m_normal = normal;
+    frag.m_scalar= 3.14f;
+
+    const RayHit &hit = hit_ptr[i];
+
+    if (hit.m_hit_idx > -1)
+    {
+      Location loc;
+      loc.m_cell_id = hit.m_hit_idx;
+      loc.m_ref_pt = hit.m_ref_pt;
+      frag.m_scalar = device_field.eval(loc)[0];
+    }
+
+    fragment_ptr[i] = frag;
+
+  });
+  DRAY_ERROR_CHECK();
+
+  return fragments;
+}
+
 Array<Vec<Float,3>>
 calc_sample_points(Array<Ray> &rays,
                    const Vec<float32,3> &point,
@@ -147,9 +187,9 @@ calc_sample_points(Array<Ray> &rays,
   return points;
 }
 
-template<class Element>
+template<class MeshType>
 Array<RayHit>
-slice_execute(UnstructuredMesh<Element> &mesh,
+slice_execute(MeshType &mesh,
               Array<Ray> &rays,
               const Vec<float32,3> point,
               const Vec<float32,3> normal)
@@ -234,6 +274,12 @@ SlicePlane::nearest_hit(Array<Ray> &rays)
   DataSet data_set = m_collection.domain(m_active_domain);
   Mesh *mesh = data_set.mesh();
 
+  StructuredMesh *structured_mesh = dynamic_cast<StructuredMesh*>(mesh);
+  if(structured_mesh != nullptr && structured_mesh->dims() == 3)
+  {
+    return detail::slice_execute(*structured_mesh, rays, m_point, m_normal);
+  }
+
   detail::SliceFunctor func(&rays, m_point, m_normal);
   dispatch_3d(mesh, func);
   return func.m_hits;
@@ -248,6 +294,17 @@ SlicePlane::fragments(Array<RayHit> &hits)
   DataSet data_set = m_collection.domain(m_active_domain);
   Field *field = data_set.field(m_field_name);
 
+  StructuredScalar *structured_field = dynamic_cast<StructuredScalar*>(field);
+  if(structured_field != nullptr &&
+     structured_field->structured_mesh()->dims() == 3)
+  {
+    Array<Fragment> fragments = detail::get_fragments(*structured_field,
+                                                      hits,
+                                                      m_normal);
+    DRAY_LOG_CLOSE();
+    return fragments;
+  }
+
   detail::SliceFragmentFunctor func(this,&hits);
   dispatch_3d_scalar(field, func);
   DRAY_LOG_CLOSE();
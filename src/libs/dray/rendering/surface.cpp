@@ -3,6 +3,7 @@
 //
 // SPDX-License-Identifier: (BSD-3-Clause)
 #include <dray/rendering/surface.hpp>
+#include <dray/rendering/aabb_intersection.hpp>
 #include <dray/rendering/colors.hpp>
 
 #include <dray/data_model/device_mesh.hpp>
@@ -112,56 +113,6 @@ class ShadeMeshLines
   }
 };
 
-//
-// intersect_AABB()
-//
-// Copied verbatim from triangle_mesh.cpp
-//
-DRAY_EXEC_ONLY
-bool intersect_AABB(const Vec<float32,4> *bvh,
-                    const int32 &currentNode,
-                    const Vec<Float,3> &orig_dir,
-                    const Vec<Float,3> &inv_dir,
-                    const Float& closest_dist,
-                    bool &hit_left,
-                    bool &hit_right,
-                    const Float &min_dist) //Find hit after this distance
-{
-  Vec<float32, 4> first4  = const_get_vec4f(&bvh[currentNode + 0]);
-  Vec<float32, 4> second4 = const_get_vec4f(&bvh[currentNode + 1]);
-  Vec<float32, 4> third4  = const_get_vec4f(&bvh[currentNode + 2]);
-  Float xmin0 = first4[0] * inv_dir[0] - orig_dir[0];
-  Float ymin0 = first4[1] * inv_dir[1] - orig_dir[1];
-  Float zmin0 = first4[2] * inv_dir[2] - orig_dir[2];
-  Float xmax0 = first4[3] * inv_dir[0] - orig_dir[0];
-  Float ymax0 = second4[0] * inv_dir[1] - orig_dir[1];
-  Float zmax0 = second4[1] * inv_dir[2] - orig_dir[2];
-  Float min0 = fmaxf(
-    fmaxf(fmaxf(fminf(ymin0, ymax0), fminf(xmin0, xmax0)), fminf(zmin0, zmax0)),
-    min_dist);
-  Float max0 = fminf(
-    fminf(fminf(fmaxf(ymin0, ymax0), fmaxf(xmin0, xmax0)), fmaxf(zmin0, zmax0)),
-    closest_dist);
-  hit_left = (max0 >= min0);
-
-  Float xmin1 = second4[2] * inv_dir[0] - orig_dir[0];
-  Float ymin1 = second4[3] * inv_dir[1] - orig_dir[1];
-  Float zmin1 = third4[0] * inv_dir[2] - orig_dir[2];
-  Float xmax1 = third4[1] * inv_dir[0] - orig_dir[0];
-  Float ymax1 = third4[2] * inv_dir[1] - orig_dir[1];
-  Float zmax1 = third4[3] * inv_dir[2] - orig_dir[2];
-
-  Float min1 = fmaxf(
-    fmaxf(fmaxf(fminf(ymin1, ymax1), fminf(xmin1, xmax1)), fminf(zmin1, zmax1)),
-    min_dist);
-  Float max1 = fminf(
-    fminf(fminf(fmaxf(ymin1, ymax1), fmaxf(xmin1, xmax1)), fmaxf(zmin1, zmax1)),
-    closest_dist);
-  hit_right = (max1 >= min1);
-
-  return (min0 > min1);
-}
-
 template<class ElemT>
 struct FaceIntersector
 {
@@ -17,6 +17,7 @@
 
 #include <dray/data_model/device_mesh.hpp>
 #include <dray/data_model/device_field.hpp>
+#include <dray/data_model/device_structured.hpp>
 
 namespace dray
 {
@@ -66,18 +67,9 @@ Array<VolumePartial> compact_partials(const Array<VolumePartial> &partials)
   return gather(partials, compact_idxs);
 }
 
-template<typename MeshElement, typename FieldElement>
-Array<VolumePartial>
-integrate_partials(UnstructuredMesh<MeshElement> &mesh,
-                   UnstructuredField<FieldElement> &field,
-                   Array<Ray> &rays,
-                   Array<PointLight> &lights,
-                   const int32 samples,
-                   const AABB<3> bounds,
-                   ColorMap &color_map,
-                   bool use_lighting)
+// correct the opacity for the number of samples
+ColorMap corrected_color_map(ColorMap &color_map, const int32 samples)
 {
-  DRAY_LOG_OPEN("volume");
   constexpr float32 correction_scalar = 10.f;
   float32 ratio = correction_scalar / samples;
 
@@ -85,24 +77,130 @@ integrate_partials(UnstructuredMesh<MeshElement> &mesh,
   corrected.scalar_range(color_map.scalar_range());
   corrected.log_scale(color_map.log_scale());
   corrected.color_table(color_map.color_table().correct_opacity(ratio));
+  return corrected;
+}
 
-  AABB<> sample_bounds = bounds;
-  float32 mag = (sample_bounds.max() - sample_bounds.min()).magnitude();
-  const float32 sample_dist = mag / float32(samples);
+// flags the cells (or macrocells) whose values all map to zero opacity.
+// With skipping off no cell is flagged.
+Array<uint8> empty_cells(Array<Vec<Float,2>> cell_ranges,
+                         ColorMap &color_map,
+                         bool skip_empty_space)
+{
+  Timer timer;
+  const int32 size = cell_ranges.size();
+  Array<uint8> empty;
+  empty.resize(size);
+  if(!skip_empty_space)
+  {
+    array_memset_zero(empty);
+    return empty;
+  }
+  uint8 *empty_ptr = empty.get_device_ptr();
+  const Vec<Float,2> *ranges_ptr = cell_ranges.get_device_ptr_const();
 
-  const int32 num_elems = mesh.cells();
+  DeviceColorMap d_color_map(color_map);
 
-  DRAY_LOG_ENTRY("samples", samples);
-  DRAY_LOG_ENTRY("sample_distance", sample_dist);
-  DRAY_LOG_ENTRY("cells", num_elems);
-  // Start the rays out at the min distance from calc ray start.
-  // Note: Rays that have missed the mesh bounds will have near >= far,
-  //       so after the copy, we can detect misses as dist >= far.
+  RAJA::ReduceSum<reduce_policy, int32> empty_count(0);
+  RAJA::forall<for_policy>(RAJA::RangeSegment(0, size), [=] DRAY_LAMBDA (int32 i)
+  {
+    const Vec<Float,2> range = ranges_ptr[i];
+    const bool is_empty = d_color_map.is_transparent(range[0], range[1]);
+    empty_ptr[i] = is_empty ? 1 : 0;
+    empty_count += is_empty ? 1 : 0;
+  });
+  DRAY_ERROR_CHECK();
 
-  // Initial compaction: Literally remove the rays which totally miss the mesh.
-  // this no longer alerters the incoming rays
-  Array<Ray> active_rays = remove_missed_rays(rays, mesh.bounds());
-  DRAY_LOG_ENTRY("active_rays", active_rays.size());
+  DRAY_LOG_ENTRY("empty_cells", empty_count.get());
+  DRAY_LOG_ENTRY("empty_cells_time", timer.elapsed());
+  return empty;
+}
+
+// skips cells whose range of values is transparent under the
+// transfer function one sample at a time, without shading them
+struct CellSkipper
+{
+  const uint8 *m_empty_ptr;
+
+  DRAY_EXEC bool is_empty(const Location &loc) const
+  {
+    return m_empty_ptr[loc.m_cell_id] != 0;
+  }
+
+  DRAY_EXEC Float skip(const Ray &, const Location &,
+                       const Float distance, const Float sample_dist) const
+  {
+    return distance + sample_dist;
+  }
+};
+
+// skips whole transparent macrocells of a structured mesh by jumping
+// to the first sample past the macrocell's exit face
+struct MacrocellSkipper
+{
+  DeviceStructuredMesh m_mesh;
+  const uint8 *m_empty_ptr;
+  Vec<int32,3> m_mc_dims;
+
+  DRAY_EXEC Vec<int32,3> macrocell(const Location &loc) const
+  {
+    Vec<int32,3> idx = m_mesh.logical_cell(loc.m_cell_id);
+    for(int32 axis = 0; axis < 3; ++axis)
+    {
+      idx[axis] /= StructuredMesh::macrocell_size;
+    }
+    return idx;
+  }
+
+  DRAY_EXEC bool is_empty(const Location &loc) const
+  {
+    const Vec<int32,3> mc = macrocell(loc);
+    return m_empty_ptr[(mc[2] * m_mc_dims[1] + mc[1]) * m_mc_dims[0] + mc[0]] != 0;
+  }
+
+  DRAY_EXEC Float skip(const Ray &ray, const Location &loc,
+                       const Float distance, const Float sample_dist) const
+  {
+    const Vec<int32,3> mc = macrocell(loc);
+    Float exit = infinity<Float>();
+    for(int32 axis = 0; axis < 3; ++axis)
+    {
+      if(ray.m_dir[axis] == 0.f)
+      {
+        continue;
+      }
+      const int32 cells = m_mesh.m_point_dims[axis] - 1;
+      int32 face = mc[axis] * StructuredMesh::macrocell_size;
+      if(ray.m_dir[axis] > 0.f)
+      {
+        face += StructuredMesh::macrocell_size;
+        face = face > cells ? cells : face;
+      }
+      const Float t = (m_mesh.point_coord(axis, face) - ray.m_orig[axis]) / ray.m_dir[axis];
+      exit = t < exit ? t : exit;
+    }
+
+    // stay on the same sample positions so the image does not change
+    Float steps = ceil((exit - distance) / sample_dist);
+    steps = steps < 1.f ? 1.f : steps;
+    return distance + steps * sample_dist;
+  }
+};
+
+// march the rays through the mesh, accumulating the shaded samples
+// into at most max_segments partials per ray. Consecutive samples are
+// located starting from the previous sample's cell, transparent space
+// is skipped, and rays stop once they are nearly opaque.
+template<typename DeviceMeshType, typename Shader, typename Skipper>
+Array<VolumePartial>
+march_partials(const DeviceMeshType &device_mesh,
+               const Shader &shader,
+               const Skipper &skipper,
+               Array<Ray> &active_rays,
+               const float32 sample_dist,
+               bool use_lighting,
+               int32 &skipped_samples)
+{
+  constexpr float32 opacity_threshold = 0.95f;
 
   const int32 ray_size = active_rays.size();
   const Ray *rays_ptr = active_rays.get_device_ptr_const();
@@ -113,22 +211,12 @@ integrate_partials(UnstructuredMesh<MeshElement> &mesh,
   init_partials(partials);
   VolumePartial *partials_ptr = partials.get_device_ptr();
 
-
-  // complicated device stuff
-  DeviceMesh<MeshElement> device_mesh(mesh);
-
-  DeviceColorMap d_color_map(corrected);
-
-
-  VolumeShader<MeshElement, FieldElement> shader(mesh,
-                                                 field,
-                                                 corrected,
-                                                 lights);
-
   Array<stats::Stats> mstats;
   mstats.resize(ray_size);
   stats::Stats *mstats_ptr = mstats.get_device_ptr();
 
+  RAJA::ReduceSum<reduce_policy, int32> skipped(0);
+
   // TODO: somehow load balance based on far - near
   Timer timer;
   RAJA::forall<for_policy>(RAJA::RangeSegment(0, ray_size), [=] DRAY_LAMBDA (int32 i)
@@ -176,37 +264,44 @@ integrate_partials(UnstructuredMesh<MeshElement> &mesh,
       partial.m_depth = distance;
       partial.m_color = clear;
 
-      int count = 0;
       mstat.acc_candidates(1);
       do
       {
         // we know we have a valid location
-
-        Vec<float32, 4> sample_color;
-        // shade
-        if(use_lighting)
+        if(skipper.is_empty(loc))
         {
-          sample_color = shader.shaded_color(loc, ray);
+          // nothing here can add to the color
+          const Float next = skipper.skip(ray, loc, distance, sample_dist);
+          skipped += int32((next - distance) / sample_dist + 0.5f);
+          distance = next;
         }
         else
         {
-          sample_color = shader.color(loc);
+          Vec<float32, 4> sample_color;
+          // shade
+          if(use_lighting)
+          {
+            sample_color = shader.shaded_color(loc, ray);
+          }
+          else
+          {
+            sample_color = shader.color(loc);
+          }
+
+          blend(partial.m_color, sample_color);
+          distance += sample_dist;
         }
 
-        blend(partial.m_color, sample_color);
-        count++;
-
-        distance += sample_dist;
         Vec<Float,3> point = ray.m_orig + distance * ray.m_dir;
-        loc = device_mesh.locate(point);
+        loc = device_mesh.locate(point, loc);
         found = loc.m_cell_id != -1;
       }
-      while(distance < ray.m_far && found && partial.m_color[3] < 0.95f);
+      while(distance < ray.m_far && found && partial.m_color[3] < opacity_threshold);
 
       partials_ptr[partial_offset + segment] = partial;
       segment++;
 
-      if(distance >= ray.m_far || partial.m_color[3] > 0.95f)
+      if(distance >= ray.m_far || partial.m_color[3] > opacity_threshold)
       {
         // we are done
         break;
@@ -217,12 +312,121 @@ integrate_partials(UnstructuredMesh<MeshElement> &mesh,
   });
   DRAY_ERROR_CHECK();
   DRAY_LOG_ENTRY("integrate_partials",timer.elapsed());
+  skipped_samples = skipped.get();
+  DRAY_LOG_ENTRY("skipped_samples", skipped_samples);
   stats::StatStore::add_ray_stats(active_rays, mstats);
 
   timer.reset();
   partials = detail::compact_partials(partials);
   DRAY_LOG_ENTRY("compact",timer.elapsed());
 
+  return partials;
+}
+
+template<typename MeshElement, typename FieldElement>
+Array<VolumePartial>
+integrate_partials(UnstructuredMesh<MeshElement> &mesh,
+                   UnstructuredField<FieldElement> &field,
+                   Array<Ray> &rays,
+                   Array<PointLight> &lights,
+                   const int32 samples,
+                   const AABB<3> bounds,
+                   ColorMap &color_map,
+                   bool use_lighting,
+                   bool skip_empty_space,
+                   int32 &skipped_samples)
+{
+  DRAY_LOG_OPEN("volume");
+  ColorMap corrected = corrected_color_map(color_map, samples);
+
+  AABB<> sample_bounds = bounds;
+  float32 mag = (sample_bounds.max() - sample_bounds.min()).magnitude();
+  const float32 sample_dist = mag / float32(samples);
+
+  const int32 num_elems = mesh.cells();
+
+  DRAY_LOG_ENTRY("samples", samples);
+  DRAY_LOG_ENTRY("sample_distance", sample_dist);
+  DRAY_LOG_ENTRY("cells", num_elems);
+  // Start the rays out at the min distance from calc ray start.
+  // Note: Rays that have missed the mesh bounds will have near >= far,
+  //       so after the copy, we can detect misses as dist >= far.
+
+  // Initial compaction: Literally remove the rays which totally miss the mesh.
+  // this no longer alerters the incoming rays
+  Array<Ray> active_rays = remove_missed_rays(rays, mesh.bounds());
+  DRAY_LOG_ENTRY("active_rays", active_rays.size());
+
+  // complicated device stuff
+  DeviceMesh<MeshElement> device_mesh(mesh);
+
+  VolumeShader<MeshElement, FieldElement> shader(mesh,
+                                                 field,
+                                                 corrected,
+                                                 lights);
+
+  Array<uint8> empty = empty_cells(field.cell_ranges(),
+                                   corrected,
+                                   skip_empty_space);
+  CellSkipper skipper{empty.get_device_ptr_const()};
+
+  Array<VolumePartial> partials = march_partials(device_mesh,
+                                                 shader,
+                                                 skipper,
+                                                 active_rays,
+                                                 sample_dist,
+                                                 use_lighting,
+                                                 skipped_samples);
+  DRAY_LOG_CLOSE();
+  return partials;
+}
+
+// implicit structured meshes locate samples directly from the
+// coordinates, so there is no BVH traversal or newton solve
+Array<VolumePartial>
+integrate_structured_partials(StructuredMesh &mesh,
+                              StructuredScalar &field,
+                              Array<Ray> &rays,
+                              Array<PointLight> &lights,
+                              const int32 samples,
+                              const AABB<3> bounds,
+                              ColorMap &color_map,
+                              bool use_lighting,
+                              bool skip_empty_space,
+                              int32 &skipped_samples)
+{
+  DRAY_LOG_OPEN("volume");
+  ColorMap corrected = corrected_color_map(color_map, samples);
+
+  AABB<> sample_bounds = bounds;
+  float32 mag = (sample_bounds.max() - sample_bounds.min()).magnitude();
+  const float32 sample_dist = mag / float32(samples);
+
+  DRAY_LOG_ENTRY("samples", samples);
+  DRAY_LOG_ENTRY("sample_distance", sample_dist);
+  DRAY_LOG_ENTRY("cells", mesh.cells());
+  DRAY_LOG_ENTRY("structured", 1);
+
+  Array<Ray> active_rays = remove_missed_rays(rays, mesh.bounds());
+  DRAY_LOG_ENTRY("active_rays", active_rays.size());
+
+  DeviceStructuredMesh device_mesh(mesh);
+  StructuredVolumeShader shader(mesh, field, corrected, lights);
+
+  Array<uint8> empty = empty_cells(field.macrocell_ranges(),
+                                   corrected,
+                                   skip_empty_space);
+  MacrocellSkipper skipper{device_mesh,
+                           empty.get_device_ptr_const(),
+                           mesh.macrocell_dims()};
+
+  Array<VolumePartial> partials = march_partials(device_mesh,
+                                                 shader,
+                                                 skipper,
+                                                 active_rays,
+                                                 sample_dist,
+                                                 use_lighting,
+                                                 skipped_samples);
   DRAY_LOG_CLOSE();
   return partials;
 }
@@ -236,20 +440,25 @@ struct IntegratePartialsFunctor
   Float m_samples;
   AABB<3> m_bounds;
   bool m_use_lighting;
+  bool m_skip_empty_space;
+  int32 m_skipped_samples;
   Array<VolumePartial> m_partials;
   IntegratePartialsFunctor(Array<Ray> *rays,
                            Array<PointLight> &lights,
                            ColorMap &color_map,
                            Float samples,
                            AABB<3> bounds,
-                           bool use_lighting)
+                           bool use_lighting,
+                           bool skip_empty_space)
     :
       m_rays(rays),
       m_lights(lights),
       m_color_map(color_map),
       m_samples(samples),
       m_bounds(bounds),
-      m_use_lighting(use_lighting)
+      m_use_lighting(use_lighting),
+      m_skip_empty_space(skip_empty_space),
+      m_skipped_samples(0)
 
   {
   }
@@ -264,7 +473,9 @@ struct IntegratePartialsFunctor
                                             m_samples,
                                             m_bounds,
                                             m_color_map,
-                                            m_use_lighting);
+                                            m_use_lighting,
+                                            m_skip_empty_space,
+                                            m_skipped_samples);
   }
 };
 
@@ -275,7 +486,9 @@ Volume::Volume(Collection &collection)
   : m_samples(100),
     m_collection(collection),
     m_use_lighting(true),
-    m_active_domain(0)
+    m_active_domain(0),
+    m_skip_empty_space(true),
+    m_skipped_samples(0)
 {
   // add some default alpha
   ColorTable table = m_color_map.color_table();
@@ -340,13 +553,32 @@ Volume::integrate(Array<Ray> &rays, Array<PointLight> &lights)
   Mesh *mesh = data_set.mesh();
   Field *field = data_set.field(m_field);
 
+  StructuredMesh *structured_mesh = dynamic_cast<StructuredMesh*>(mesh);
+  StructuredScalar *structured_field = dynamic_cast<StructuredScalar*>(field);
+  if(structured_mesh != nullptr && structured_field != nullptr &&
+     structured_mesh->dims() == 3)
+  {
+    return detail::integrate_structured_partials(*structured_mesh,
+                                                 *structured_field,
+                                                 rays,
+                                                 lights,
+                                                 m_samples,
+                                                 m_bounds,
+                                                 m_color_map,
+                                                 m_use_lighting,
+                                                 m_skip_empty_space,
+                                                 m_skipped_samples);
+  }
+
   detail::IntegratePartialsFunctor func(&rays,
                                         lights,
                                         m_color_map,
                                         m_samples,
                                         m_bounds,
-                                        m_use_lighting);
+                                        m_use_lighting,
+                                        m_skip_empty_space);
   dispatch_3d(mesh, field, func);
+  m_skipped_samples = func.m_skipped_samples;
   return func.m_partials;
 }
 // ------------------------------------------------------------------------
@@ -363,6 +595,20 @@ void Volume::use_lighting(bool do_it)
   m_use_lighting = do_it;
 }
 
+// ------------------------------------------------------------------------
+
+void Volume::skip_empty_space(bool do_it)
+{
+  m_skip_empty_space = do_it;
+}
+
+// ------------------------------------------------------------------------
+
+int32 Volume::skipped_samples() const
+{
+  return m_skipped_samples;
+}
+
 
 // ------------------------------------------------------------------------
 
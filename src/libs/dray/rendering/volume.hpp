@@ -27,6 +27,8 @@ protected:
   bool m_use_lighting;
   int32 m_active_domain;
   Range m_field_range;
+  bool m_skip_empty_space;
+  int32 m_skipped_samples;
 
 public:
   Volume() = delete;
@@ -55,6 +57,12 @@ public:
 
   void use_lighting(bool do_it);
 
+  /// skip the samples in cells the transfer function makes
+  /// fully transparent (on by default)
+  void skip_empty_space(bool do_it);
+  /// the number of samples the last integrate skipped
+  int32 skipped_samples() const;
+
   ColorMap& color_map();
 };
 
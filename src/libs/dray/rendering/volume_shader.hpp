@@ -9,10 +9,108 @@
 #include <dray/device_color_map.hpp>
 #include <dray/data_model/device_mesh.hpp>
 #include <dray/data_model/device_field.hpp>
+#include <dray/data_model/device_structured.hpp>
 
 namespace dray
 {
 
+namespace detail
+{
+
+// blinn-phong shading of a volume sample, the gradient is the normal
+DRAY_EXEC
+Vec<float32,4> shade_sample(const Vec4f &sample_color,
+                            Vec<Float,3> gradient,
+                            const Vec<Float,3> &world_pos,
+                            const Ray &ray,
+                            const PointLight *lights,
+                            const int32 num_lights)
+{
+  Vec4f acc = {0.f, 0.f, 0.f, 0.f};
+  if(sample_color[3] > 0.01)
+  {
+
+    gradient.normalize();
+
+    Vec<float32,3> fgradient;
+    fgradient[0] = float32(gradient[0]);
+    fgradient[1] = float32(gradient[1]);
+    fgradient[2] = float32(gradient[2]);
+
+    const Vec<float32, 3> view_dir = { float32(-ray.m_dir[0]),
+                                       float32(-ray.m_dir[1]),
+                                       float32(-ray.m_dir[2])};
+
+    for(int32 l = 0; l < num_lights; ++l)
+    {
+      const PointLight light = lights[l];
+
+      Vec<float32, 3> light_dir = light.m_pos - world_pos;
+      light_dir.normalize ();
+
+      // now it might seem silly to calculate the dot twice, but
+      // cuda 11.0.2 and gcc 7.3 are somehow optimizing away
+      // code such that we are getting negative values. Even
+      // manualy tring to ensure the value is positive fails.
+      // Flipping the gradient so that the result is positive
+      // seems to do the trick. This cost a lot of time to
+      // track down.
+
+      float32 ldir_dot_grad = dot(light_dir, fgradient);
+      if(ldir_dot_grad < 0.f)
+      {
+        fgradient = -fgradient;
+      }
+      const float32 diffuse = clamp (dot(light_dir, fgradient), 0.f, 1.f);
+      //const float32 diffuse = clamp (fabsf(dot(light_dir, fgradient)), 0.f, 1.f);
+
+      Vec4f shaded_color;
+      shaded_color[0] = light.m_amb[0] * sample_color[0];
+      shaded_color[1] = light.m_amb[1] * sample_color[1];
+      shaded_color[2] = light.m_amb[2] * sample_color[2];
+      shaded_color[3] = sample_color[3];
+
+      // add the diffuse component
+      for (int32 c = 0; c < 3; ++c)
+      {
+        shaded_color[c] += diffuse * light.m_diff[c] * sample_color[c];
+      }
+
+      Vec<float32, 3> half_vec = 0.5f * (view_dir + light_dir);
+      half_vec.normalize ();
+      // doing this for the same reason as above
+      float32 h_dot_g = dot(fgradient, half_vec);
+      if(h_dot_g < 0.f)
+      {
+        fgradient = -fgradient;
+      }
+      float32 doth = clamp (dot (fgradient, half_vec), 0.f, 1.f);
+      // this is the old line that works on the cpu
+      //float32 doth = clamp (fabsf(dot (fgradient, half_vec)), 0.f, 1.f);
+      float32 intensity = pow (doth, light.m_spec_pow);
+
+      //intensity *= sample_color[3];
+
+      // add the specular component
+      for (int32 c = 0; c < 3; ++c)
+      {
+        shaded_color[c] += intensity * light.m_spec[c] * sample_color[c];
+      }
+
+
+      acc += shaded_color;
+
+      for (int32 c = 0; c < 3; ++c)
+      {
+        acc[c] = clamp (acc[c], 0.0f, 1.0f);
+      }
+    }
+  }
+  return acc;
+}
+
+} // namespace detail
+
 template<typename Element, typename FieldElement>
 struct VolumeShader
 {
@@ -74,96 +172,76 @@ struct VolumeShader
     Float scalar;
     scalar_gradient(loc, scalar, gradient, world_pos);
     Vec4f sample_color = m_color_map.color(scalar);
-    Vec4f acc = {0.f, 0.f, 0.f, 0.f};
-    if(sample_color[3] > 0.01)
-    {
+    return detail::shade_sample(sample_color,
+                                gradient,
+                                world_pos,
+                                ray,
+                                m_lights,
+                                m_num_lights);
+  }
 
-      gradient.normalize();
+  DRAY_EXEC
+  Vec<float32,4> color(const Location &loc) const
+  {
+    Vec<Vec<Float, 1>, 3> field_deriv;
+    Float scalar =
+      m_field.get_elem(loc.m_cell_id).eval_d(loc.m_ref_pt, field_deriv)[0];
+    return m_color_map.color(scalar);
+  }
+
+};
 
-      Vec<float32,3> fgradient;
-      fgradient[0] = float32(gradient[0]);
-      fgradient[1] = float32(gradient[1]);
-      fgradient[2] = float32(gradient[2]);
+// shades samples of a scalar field on an implicit structured mesh,
+// the cells are axis aligned so the gradient is the derivative in
+// reference space scaled by the cell size
+struct StructuredVolumeShader
+{
+  DeviceStructuredMesh m_mesh;
+  DeviceStructuredField<1> m_field;
+  DeviceColorMap m_color_map;
+  const PointLight *m_lights;
+  const int32 m_num_lights;
 
-      const Vec<float32, 3> view_dir = { float32(-ray.m_dir[0]),
-                                         float32(-ray.m_dir[1]),
-                                         float32(-ray.m_dir[2])};
+  StructuredVolumeShader() = delete;
 
-      for(int32 l = 0; l < m_num_lights; ++l)
-      {
-        const PointLight light = m_lights[l];
-
-        Vec<float32, 3> light_dir = light.m_pos - world_pos;
-        light_dir.normalize ();
-
-        // now it might seem silly to calculate the dot twice, but
-        // cuda 11.0.2 and gcc 7.3 are somehow optimizing away
-        // code such that we are getting negative values. Even
-        // manualy tring to ensure the value is positive fails.
-        // Flipping the gradient so that the result is positive
-        // seems to do the trick. This cost a lot of time to
-        // track down.
-
-        float32 ldir_dot_grad = dot(light_dir, fgradient);
-        if(ldir_dot_grad < 0.f)
-        {
-          fgradient = -fgradient;
-        }
-        const float32 diffuse = clamp (dot(light_dir, fgradient), 0.f, 1.f);
-        //const float32 diffuse = clamp (fabsf(dot(light_dir, fgradient)), 0.f, 1.f);
-
-        Vec4f shaded_color;
-        shaded_color[0] = light.m_amb[0] * sample_color[0];
-        shaded_color[1] = light.m_amb[1] * sample_color[1];
-        shaded_color[2] = light.m_amb[2] * sample_color[2];
-        shaded_color[3] = sample_color[3];
-
-        // add the diffuse component
-        for (int32 c = 0; c < 3; ++c)
-        {
-          shaded_color[c] += diffuse * light.m_diff[c] * sample_color[c];
-        }
-
-        Vec<float32, 3> half_vec = 0.5f * (view_dir + light_dir);
-        half_vec.normalize ();
-        // doing this for the same reason as above
-        float32 h_dot_g = dot(fgradient, half_vec);
-        if(h_dot_g < 0.f)
-        {
-          fgradient = -fgradient;
-        }
-        float32 doth = clamp (dot (fgradient, half_vec), 0.f, 1.f);
-        // this is the old line that works on the cpu
-        //float32 doth = clamp (fabsf(dot (fgradient, half_vec)), 0.f, 1.f);
-        float32 intensity = pow (doth, light.m_spec_pow);
-
-        //intensity *= sample_color[3];
-
-        // add the specular component
-        for (int32 c = 0; c < 3; ++c)
-        {
-          shaded_color[c] += intensity * light.m_spec[c] * sample_color[c];
-        }
-
-
-        acc += shaded_color;
-
-        for (int32 c = 0; c < 3; ++c)
-        {
-          acc[c] = clamp (acc[c], 0.0f, 1.0f);
-        }
-      }
+  StructuredVolumeShader(StructuredMesh &mesh,
+                         StructuredScalar &field,
+                         ColorMap &color_map,
+                         Array<PointLight> lights)
+    : m_mesh(mesh),
+      m_field(field),
+      m_color_map(color_map),
+      m_lights(lights.get_device_ptr_const()),
+      m_num_lights(lights.size())
+  {
+  }
+
+  DRAY_EXEC
+  Vec<float32,4> shaded_color(const Location &loc, const Ray &ray) const
+  {
+    Vec<Vec<Float, 1>, 3> field_deriv;
+    const Float scalar = m_field.eval_d(loc, field_deriv)[0];
+    const Vec<Float,3> cell_size = m_mesh.cell_size(loc.m_cell_id);
+
+    Vec<Float,3> gradient;
+    for(int32 d = 0; d < 3; ++d)
+    {
+      gradient[d] = field_deriv[d][0] / cell_size[d];
     }
-    return acc;
+
+    Vec4f sample_color = m_color_map.color(scalar);
+    return detail::shade_sample(sample_color,
+                                gradient,
+                                m_mesh.world_point(loc),
+                                ray,
+                                m_lights,
+                                m_num_lights);
   }
 
   DRAY_EXEC
   Vec<float32,4> color(const Location &loc) const
   {
-    Vec<Vec<Float, 1>, 3> field_deriv;
-    Float scalar =
-      m_field.get_elem(loc.m_cell_id).eval_d(loc.m_ref_pt, field_deriv)[0];
-    return m_color_map.color(scalar);
+    return m_color_map.color(m_field.eval(loc)[0]);
   }
 
 };
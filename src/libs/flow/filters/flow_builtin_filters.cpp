@@ -62,6 +62,7 @@ Alias::declare_interface(Node &i)
     i["type_name"]   = "alias";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["thread_safe"] = "true";
 }
 
 
@@ -93,6 +94,7 @@ DependentAlias::declare_interface(Node &i)
     i["port_names"].append() = "in";
     i["port_names"].append() = "dummy";
     i["output_port"] = "true";
+    i["thread_safe"] = "true";
 }
 
 
@@ -124,6 +126,7 @@ RegistrySource::declare_interface(Node &i)
     i["type_name"]   = "registry_source";
     i["port_names"]  = DataType::empty();
     i["output_port"] = "true";
+    i["thread_safe"] = "true";
     i["default_params"]["entry"] = "";
 }
 
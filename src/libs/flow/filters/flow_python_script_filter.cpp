@@ -17,7 +17,11 @@
 #include "flow_python_script_filter.hpp"
 
 // standard lib includes
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <map>
+#include <sstream>
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
@@ -101,36 +105,87 @@ namespace filters
 namespace detail
 {
 
-PyObject* execute_python(PyObject *py_input,
-                        flow::PythonInterpreter *py_interp,
-                        conduit::Node &params)
+//-----------------------------------------------------------------------------
+// Scripts are compiled once and run from the compiled code in later
+// cycles. Entries are keyed by module, execute function, file name and
+// source, so an edited script is compiled (and warmed up) again.
+//-----------------------------------------------------------------------------
+struct CompiledScript
 {
-    std::string module_name = "flow_script_filter";
-    std::string input_func_name = "flow_input";
-    std::string set_output_func_name = "flow_set_output";
+    PyObject *m_code;
+    // set once the script ran to define its warm execute function
+    PyObject *m_execute;
+};
 
-    bool echo = false;
-    if( params.has_path("echo") &&
-        params["echo"].as_string() == "true")
-    {
-        echo = true;
-    }
+std::map<std::string, CompiledScript> &
+script_cache()
+{
+    static std::map<std::string, CompiledScript> cache;
+    return cache;
+}
 
-    py_interp->set_echo(echo);
+// scripts generated per cycle (e.g. jupyter) shouldn't pile up
+const size_t max_cached_scripts = 64;
 
-    if( params.has_path("interface/module") )
+CompiledScript &
+compiled_script(flow::PythonInterpreter *py_interp,
+                const std::string &module_name,
+                const std::string &execute_func_name,
+                const std::string &file_name,
+                const std::string &source)
+{
+    std::map<std::string, CompiledScript> &cache = script_cache();
+    const std::string key = module_name + "\n" + execute_func_name + "\n" +
+                            file_name + "\n" + source;
+
+    std::map<std::string, CompiledScript>::iterator itr = cache.find(key);
+    if(itr != cache.end())
     {
-        module_name = params["interface/module"].as_string();
+        return itr->second;
     }
 
-    if( params.has_path("interface/input") )
+    if(cache.size() >= max_cached_scripts)
     {
-        input_func_name = params["interface/input"].as_string();
+        for(itr = cache.begin(); itr != cache.end(); ++itr)
+        {
+            Py_DECREF(itr->second.m_code);
+            Py_XDECREF(itr->second.m_execute);
+        }
+        cache.clear();
     }
 
-    if( params.has_path("interface/set_output") )
+    PyObject *py_code = py_interp->compile_script(source,
+                                                  file_name.empty() ?
+                                                    "<flow_script>" :
+                                                    file_name);
+    FLOW_CHECK_PYTHON_ERROR(py_interp, py_code != NULL);
+
+    CompiledScript &script = cache[key];
+    script.m_code = py_code;
+    script.m_execute = NULL;
+    return script;
+}
+
+//-----------------------------------------------------------------------------
+// creates the module that holds the input and output helpers. this only
+// happens the first time a module name is used.
+//-----------------------------------------------------------------------------
+PyObject *
+setup_module(flow::PythonInterpreter *py_interp,
+             const std::string &module_name,
+             const std::string &input_func_name,
+             const std::string &set_output_func_name)
+{
+    // fetch the module from the global dict (borrowed)
+    PyObject *py_mod = py_interp->get_global_object(module_name);
+    if(py_mod != NULL && PyModule_Check(py_mod))
     {
-        set_output_func_name = params["interface/set_output"].as_string();
+        PyObject *py_mod_dict = PyModule_GetDict(py_mod);
+        if(py_interp->get_dict_object(py_mod_dict, input_func_name) != NULL &&
+           py_interp->get_dict_object(py_mod_dict, set_output_func_name) != NULL)
+        {
+            return py_mod;
+        }
     }
 
     std::ostringstream filter_setup_src_oss;
@@ -149,19 +204,17 @@ PyObject* execute_python(PyObject *py_input,
                          << "flow_setup_module(\"" << module_name << "\")\n";
     FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(filter_setup_src_oss.str()));
 
-    filter_setup_src_oss.str();
+    filter_setup_src_oss.str("");
     filter_setup_src_oss << "\n"
                          // import into the global dict
                          << "import " << module_name << "\n"
                          << "\n";
     FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(filter_setup_src_oss.str()));
 
-
-    // fetch the module from the global dict (borrowed)
-    PyObject *py_mod = py_interp->get_global_object(module_name);
+    py_mod = py_interp->get_global_object(module_name);
 
     // sanity check
-    if( !PyModule_Check(py_mod) )
+    if( py_mod == NULL || !PyModule_Check(py_mod) )
     {
         CONDUIT_ERROR("Unexpected error: " << module_name
                       << " is not a python module!");
@@ -171,15 +224,11 @@ PyObject* execute_python(PyObject *py_input,
     //  where we will place our methods and bind our input data
     PyObject *py_mod_dict = PyModule_GetDict(py_mod);
 
-    // bind our input data
-    FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->set_dict_object(py_mod_dict,
-                                                                  py_input,
-                                                                  "_flow_input"));
-
     // run script to establish input and output helpers in the module
     // note: global here binds to module scope
     filter_setup_src_oss.str("");
     filter_setup_src_oss << "\n"
+                         << "_flow_input = None\n"
                          << "_flow_output = None\n"
                          << "\n"
                          << "def "<< input_func_name << "():\n"
@@ -192,19 +241,78 @@ PyObject* execute_python(PyObject *py_input,
 
     FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(filter_setup_src_oss.str(),
                                                              py_mod_dict));
+    return py_mod;
+}
 
-    // now import binding function names from the module,
-    // so the names are bound to the global ns
-    filter_setup_src_oss.str("");
-    filter_setup_src_oss << "\n"
-                         << "from " << module_name
-                         << " import "
-                         << input_func_name << ", "
-                         << set_output_func_name
-                         << "\n";
+PyObject* execute_python(PyObject *py_input,
+                        flow::PythonInterpreter *py_interp,
+                        conduit::Node &params)
+{
+    std::string module_name = "flow_script_filter";
+    std::string input_func_name = "flow_input";
+    std::string set_output_func_name = "flow_set_output";
+    std::string execute_func_name = "";
+
+    bool echo = false;
+    if( params.has_path("echo") &&
+        params["echo"].as_string() == "true")
+    {
+        echo = true;
+    }
+
+    py_interp->set_echo(echo);
+
+    if( params.has_path("interface/module") )
+    {
+        module_name = params["interface/module"].as_string();
+    }
+
+    if( params.has_path("interface/input") )
+    {
+        input_func_name = params["interface/input"].as_string();
+    }
+
+    if( params.has_path("interface/set_output") )
+    {
+        set_output_func_name = params["interface/set_output"].as_string();
+    }
+
+    if( params.has_path("interface/execute") )
+    {
+        execute_func_name = params["interface/execute"].as_string();
+    }
+
+    PyObject *py_mod = setup_module(py_interp,
+                                    module_name,
+                                    input_func_name,
+                                    set_output_func_name);
+    PyObject *py_mod_dict = PyModule_GetDict(py_mod);
+
+    // bind our input data and clear the last output
+    FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->set_dict_object(py_mod_dict,
+                                                                  py_input,
+                                                                  "_flow_input"));
+    FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->set_dict_object(py_mod_dict,
+                                                                  Py_None,
+                                                                  "_flow_output"));
+
+    // bind the helper names to the global ns, another filter could have
+    // bound the same names to a different module
+    PyObject *py_module_names[] = {py_mod, NULL, NULL};
+    py_module_names[1] = py_interp->get_dict_object(py_mod_dict,
+                                                    input_func_name);
+    py_module_names[2] = py_interp->get_dict_object(py_mod_dict,
+                                                    set_output_func_name);
+    const std::string global_names[] = {module_name,
+                                        input_func_name,
+                                        set_output_func_name};
+    for(int i = 0; i < 3; ++i)
+    {
+        FLOW_CHECK_PYTHON_ERROR(py_interp,
+                                py_interp->set_global_object(py_module_names[i],
+                                                             global_names[i]));
+    }
 
-    FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(filter_setup_src_oss.str()));
-    
     std::string filter_source_file_path = "";
     
     if( params.has_child("file") )
@@ -218,8 +326,32 @@ PyObject* execute_python(PyObject *py_input,
     {
         filter_source_file_path = params["source_file"].as_string();
     }
-    
+
+    std::string source;
+    if( params.has_child("source") )
+    {
+        source = params["source"].as_string();
+    }
+    else // file is the other case
+    {
+        std::ifstream ifs(filter_source_file_path.c_str());
+        if(!ifs.is_open())
+        {
+            CONDUIT_ERROR("python_script failed to open "
+                          << filter_source_file_path);
+        }
+        source.assign(std::istreambuf_iterator<char>(ifs),
+                      std::istreambuf_iterator<char>());
+    }
+
+    CompiledScript &script = compiled_script(py_interp,
+                                             module_name,
+                                             execute_func_name,
+                                             filter_source_file_path,
+                                             source);
+
     // inject the file name as __file__ in the module 
+    std::ostringstream filter_setup_src_oss;
     if( !filter_source_file_path.empty() )
     {
         filter_setup_src_oss.str("");
@@ -232,14 +364,34 @@ PyObject* execute_python(PyObject *py_input,
         FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(filter_setup_src_oss.str()));
     }
 
-
-    if( params.has_child("source") )
+    if(execute_func_name.empty())
     {
-        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(params["source"].as_string()));
+        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_code(script.m_code,
+                                                               py_interp->global_dict()));
     }
-    else // file is the other case
+    else
     {
-        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script_file(params["file"].as_string()));
+        // warm mode: the script runs once to set things up (imports,
+        // loading models, ...) and later cycles only call the function
+        if(script.m_execute == NULL)
+        {
+            FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_code(script.m_code,
+                                                                   py_interp->global_dict()));
+            PyObject *py_func = py_interp->get_global_object(execute_func_name);
+            if(py_func == NULL || !PyCallable_Check(py_func))
+            {
+                CONDUIT_ERROR("python_script: 'interface/execute' function '"
+                              << execute_func_name
+                              << "' is not defined by the script");
+            }
+            // hold on to it, other scripts may reuse the name
+            Py_INCREF(py_func);
+            script.m_execute = py_func;
+        }
+
+        PyObject *py_call_res = PyObject_CallObject(script.m_execute, NULL);
+        Py_XDECREF(py_call_res);
+        FLOW_CHECK_PYTHON_ERROR(py_interp, !py_interp->check_error());
     }
 
     PyObject *py_res = py_interp->get_dict_object(py_mod_dict,
@@ -262,6 +414,16 @@ PyObject* execute_python(PyObject *py_input,
     // we need to incref b/c py_res is borrowed, and flow will decref
     // when it is done with the python object
     Py_INCREF(py_res);
+
+    // drop the module's references, so the input (which may be a view of
+    // data flow is about to release) and the output don't outlive this
+    // execute
+    FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->set_dict_object(py_mod_dict,
+                                                                  Py_None,
+                                                                  "_flow_input"));
+    FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->set_dict_object(py_mod_dict,
+                                                                  Py_None,
+                                                                  "_flow_output"));
     return py_res;
 }
 
@@ -371,6 +533,17 @@ PythonScript::verify_params(const conduit::Node &params,
         }
     }
 
+    if( params.has_child("input_mode") )
+    {
+        if( !params["input_mode"].dtype().is_string() ||
+             (params["input_mode"].as_string() != "view" &&
+              params["input_mode"].as_string() != "copy") )
+        {
+            info["errors"].append() = "parameter 'input_mode' is not \"view\" or \"copy\"";
+            res = false;
+        }
+    }
+
     if( params.has_child("interface") )
     {
         const Node &n_iface = params["interface"];
@@ -414,6 +587,19 @@ PythonScript::verify_params(const conduit::Node &params,
             }
         }
 
+        if( n_iface.has_child("execute") )
+        {
+            if( !n_iface["execute"].dtype().is_string() )
+            {
+                info["errors"].append() = "parameter 'interface/execute' is not a string";
+                res = false;
+            }
+            else
+            {
+                info["info"].append().set("provides 'interface/execute' warm execute function");
+            }
+        }
+
     }
 
     return res;
@@ -423,9 +609,25 @@ PythonScript::verify_params(const conduit::Node &params,
 void PythonScript::execute_python(conduit::Node *n)
 {
     PythonInterpreter *py_interp = interpreter();
-    PyObject * py_input = PyConduit_Node_Python_Wrap(n,0);
+    PyObject *py_input = NULL;
+
+    if( params().has_child("input_mode") &&
+        params()["input_mode"].as_string() == "copy")
+    {
+        // the script gets its own copy, which python owns
+        Node *n_copy = new Node();
+        n_copy->set(*n);
+        py_input = PyConduit_Node_Python_Wrap(n_copy,1);
+    }
+    else
+    {
+        // zero copy, the script's arrays are views of the data in n
+        py_input = PyConduit_Node_Python_Wrap(n,0);
+    }
 
     PyObject *py_res = detail::execute_python(py_input, py_interp, params());
+    // the module released its reference when the script finished
+    Py_DECREF(py_input);
     set_output<PyObject>(py_res);
 }
 
@@ -46,6 +46,14 @@ namespace filters
 ///
 /// PythonScript runs a given python source.
 ///
+/// Scripts are compiled once and rerun from the compiled code. With
+/// 'interface/execute' set, the script only runs the first time and
+/// later executes just call the named function.
+///
+/// 'input_mode' is "view" (default) to hand the script the input without
+/// copying it (its arrays alias the input data), or "copy" to hand it a
+/// copy it may modify.
+///
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
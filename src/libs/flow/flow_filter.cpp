@@ -111,6 +111,11 @@ Filter::init(Graph *g,
         n_iface["port_names"] = DataType::empty();
     }
 
+    if( !n_iface.has_child("thread_safe") )
+    {
+        n_iface["thread_safe"] = "false";
+    }
+
 
     params().update(default_params());
     params().update(p);
@@ -151,6 +156,13 @@ Filter::output_port() const
     return properties()["interface/output_port"].as_string() == "true";
 }
 
+//-----------------------------------------------------------------------------
+bool
+Filter::thread_safe() const
+{
+    return properties()["interface/thread_safe"].as_string() == "true";
+}
+
 //-----------------------------------------------------------------------------
 bool
 Filter::has_port(const std::string &port_name) const
@@ -217,6 +229,21 @@ Filter::verify_params(const Node &, // unused: params,
 }
 
 
+//-----------------------------------------------------------------------------
+bool
+Filter::cache_signature(Node &) // unused: sig
+{
+    // by default, filter outputs are not reused
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+void
+Filter::cached_output_reused(Data &) // unused: output
+{
+    // by default, nothing to refresh
+}
+
 //-----------------------------------------------------------------------------
 bool
 Filter::verify_interface(const Node &i,
@@ -254,6 +281,19 @@ Filter::verify_interface(const Node &i,
         }
     }
 
+    if(i.has_child("thread_safe"))
+    {
+        if(!i["thread_safe"].dtype().is_string() ||
+           (i["thread_safe"].as_string() != "true" &&
+            i["thread_safe"].as_string() != "false"))
+        {
+            std::string msg = "interface 'thread_safe' is not"
+                              " {\"true\" | \"false\"}";
+            info["errors"].append().set(msg);
+            res = false;
+        }
+    }
+
     if(i.has_child("port_names"))
     {
         NodeConstIterator itr(&i["port_names"]);
@@ -61,6 +61,12 @@ class Graph;
 ///    // or DataType::empty() if there are no input ports.
 ///    i["port_names"].append().set("in");
 ///
+///    // optionally declare if this filter can execute concurrently
+///    // with other filters when the workspace runs in parallel mode.
+///    // Filters that use MPI collectives, python, or other
+///    // shared state should leave this unset (default is "false").
+///    i["thread_safe"] = {"true" | "false"};
+///
 ///    // Set any default parameters.
 ///    // default_params can be any conduit tree, params() will be
 ///    // inited with a *copy* of the default_params when the filter is
@@ -92,6 +98,16 @@ class Graph;
 ///
 ///  TODO: talk about optional verify_params()
 ///
+///  3) Optionally implement cache_signature() to allow the workspace to
+///     skip execution and reuse the filter's previous output when nothing
+///     the filter depends on has changed.
+///
+///  bool MyFilter::cache_signature(Node &sig)
+///  {
+///     sig["params"] = params();
+///     return true;
+///  }
+///
 //-----------------------------------------------------------------------------
 
 
@@ -121,6 +137,19 @@ public:
     virtual bool          verify_params(const conduit::Node &params,
                                         conduit::Node &info);
 
+    /// optionally override to allow the workspace to reuse this filter's
+    /// output across executions (see Workspace::enable_output_caching).
+    /// Fill sig with everything the result depends on besides the
+    /// filter's inputs: params, and the identity of any data the filter
+    /// reads outside of its input ports. Return false if the output
+    /// can't be reused.
+    virtual bool          cache_signature(conduit::Node &sig);
+
+    /// optionally override to refresh state the cached output carries
+    /// that is not part of the signature (for example the cycle or time
+    /// of the current execution) when the workspace reuses it.
+    virtual void          cached_output_reused(Data &output);
+
     //-------------------------------------------------------------------------
     // filter interface properties
     //-------------------------------------------------------------------------
@@ -136,6 +165,7 @@ public:
     std::string           type_name()   const;
     const conduit::Node  &port_names()  const;
     bool                  output_port() const;
+    bool                  thread_safe() const;
 
     const conduit::Node  &default_params() const;
 
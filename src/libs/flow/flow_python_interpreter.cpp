@@ -521,6 +521,63 @@ PythonInterpreter::run_script_file(const std::string &fname,
     return run_script(py_script, py_dict);
 }
 
+//-----------------------------------------------------------------------------
+///
+/// Compiles passed python script, so it can be run without parsing it again
+///
+//-----------------------------------------------------------------------------
+PyObject *
+PythonInterpreter::compile_script(const std::string &script,
+                                  const std::string &file_name)
+{
+    PyObject *py_code = NULL;
+    if(m_running)
+    {
+        if(m_echo)
+        {
+            CONDUIT_INFO("PythonInterpreter::compile_script " << script);
+        }
+
+        py_code = Py_CompileString((char*)script.c_str(),
+                                   (char*)file_name.c_str(),
+                                   Py_file_input);
+        if(check_error())
+        {
+            Py_XDECREF(py_code);
+            py_code = NULL;
+        }
+    }
+    return py_code;
+}
+
+//-----------------------------------------------------------------------------
+///
+/// Executes compiled python script in the interpreter
+///
+//-----------------------------------------------------------------------------
+bool
+PythonInterpreter::run_code(PyObject *py_code,
+                            PyObject *py_dict)
+{
+    bool res = false;
+    if(m_running)
+    {
+#ifdef IS_PY3K
+        PyObject *py_res = PyEval_EvalCode(py_code,
+                                           py_dict,
+                                           py_dict);
+#else
+        PyObject *py_res = PyEval_EvalCode((PyCodeObject*)py_code,
+                                           py_dict,
+                                           py_dict);
+#endif
+        Py_XDECREF(py_res);
+        if(!check_error())
+            res = true;
+    }
+    return res;
+}
+
 
 
 //-----------------------------------------------------------------------------
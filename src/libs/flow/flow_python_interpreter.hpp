@@ -73,6 +73,14 @@ public:
     bool         run_script_file(const std::string &fname,
                                  PyObject *py_dict);
 
+    /// compile a script once to run it many times, returns a new
+    /// reference (NULL on error). file_name shows up in tracebacks.
+    PyObject    *compile_script(const std::string &script,
+                                const std::string &file_name);
+    /// exec compiled script in specific dict
+    bool         run_code(PyObject *py_code,
+                          PyObject *py_dict);
+
     /// set into global dict
     bool         set_global_object(PyObject *py_obj,
                                    const std::string &name);
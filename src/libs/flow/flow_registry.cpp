@@ -18,6 +18,7 @@
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
+#include <mutex>
 
 using namespace conduit;
 using namespace std;
@@ -119,10 +120,15 @@ public:
 
     void   reset();
 
+    // guards registry access when the workspace
+    // executes filters concurrently
+    std::recursive_mutex &lock();
+
 private:
 
     std::map<void*,Value*>         m_values;
     std::map<std::string,Entry*>   m_entries;
+    std::recursive_mutex           m_lock;
 
 };
 
@@ -516,6 +522,13 @@ Registry::Map::reset()
     m_values.clear();
 }
 
+//-----------------------------------------------------------------------------
+std::recursive_mutex &
+Registry::Map::lock()
+{
+    return m_lock;
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -538,6 +551,7 @@ Registry::~Registry()
 bool
 Registry::has_entry(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> guard(m_map->lock());
     return m_map->has_entry(key);
 }
 
@@ -545,6 +559,7 @@ Registry::has_entry(const std::string &key)
 void
 Registry::consume(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> guard(m_map->lock());
     if(m_map->has_entry(key))
     {
         m_map->dec(key);
@@ -555,6 +570,7 @@ Registry::consume(const std::string &key)
 void
 Registry::detach(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> guard(m_map->lock());
     if(m_map->has_entry(key))
     {
         m_map->detach(key);
@@ -566,6 +582,7 @@ Registry::detach(const std::string &key)
 void
 Registry::reset()
 {
+    std::lock_guard<std::recursive_mutex> guard(m_map->lock());
     m_map->reset();
 }
 
@@ -574,6 +591,7 @@ Registry::reset()
 void
 Registry::info(Node &out) const
 {
+    std::lock_guard<std::recursive_mutex> guard(m_map->lock());
     m_map->info(out);
 }
 
@@ -613,6 +631,7 @@ Registry::print() const
 Data &
 Registry::fetch(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> guard(m_map->lock());
     if(!m_map->has_entry(key))
     {
         print();
@@ -628,6 +647,7 @@ Registry::add(const std::string &key,
               Data &data,
               int refs_needed)
 {
+    std::lock_guard<std::recursive_mutex> guard(m_map->lock());
     if(m_map->has_entry(key))
     {
         CONDUIT_WARN("Attempt to overwrite existing entry with key: " << key);
@@ -19,6 +19,13 @@
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
+#include <vector>
+#include <deque>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 
 using namespace conduit;
 using namespace std;
@@ -54,6 +61,116 @@ class Workspace::ExecutionPlan
                                        conduit::Node &tarv);
 };
 
+//-----------------------------------------------------------------------------
+// Executes the filters of a set of traversals as a task graph.
+//
+// Each filter tracks the number of its input ports that still wait on
+// an upstream filter. Filters become ready when that count drops to zero.
+// Ready thread safe filters are dispatched to worker threads, non thread
+// safe filters are executed on the calling thread in traversal order,
+// so filters that use MPI collectives are invoked in the same order on
+// every rank.
+//-----------------------------------------------------------------------------
+class Workspace::Scheduler
+{
+    public:
+        Scheduler(Workspace &w,
+                  conduit::Node &traversals);
+        ~Scheduler();
+
+        void execute(int num_threads);
+
+    private:
+        struct Task
+        {
+            Filter                  *filter;
+            int                      uref;
+            int                      pending;
+            std::vector<int>         dependents;
+        };
+
+        void worker_loop();
+        void run_task(int task_id);
+        void complete_task(int task_id);
+        void fail(std::exception_ptr err);
+
+        Workspace                   &m_workspace;
+        std::vector<Task>            m_tasks;
+        // task ids for non thread safe filters, in traversal order
+        std::vector<int>             m_serial_tasks;
+        std::vector<bool>            m_ready;
+        std::deque<int>              m_parallel_queue;
+        int                          m_num_completed;
+        bool                         m_done;
+        std::exception_ptr           m_error;
+
+        std::mutex                   m_lock;
+        std::condition_variable      m_cond;
+};
+
+//-----------------------------------------------------------------------------
+// Holds filter outputs that can be reused across executions.
+//
+// Each cached filter has a key (its signature combined with the versions
+// of its inputs) and a version that is bumped every time the filter
+// produces new output. Downstream filters use the version of their
+// inputs in their own key, so a change propagates down the graph.
+//-----------------------------------------------------------------------------
+class Workspace::OutputCache
+{
+    public:
+        struct Entry
+        {
+            std::string  key;
+            // owned output, NULL for filters w/o output or
+            // filters that pass through an input
+            Data        *data;
+            // index of the input port passed through as output, or -1
+            int          passthrough_port;
+            int          version;
+        };
+
+        OutputCache();
+        ~OutputCache();
+
+        // prepares per execution state
+        void begin_execute();
+        // releases all cached outputs
+        void clear();
+
+        // records the key of a filter for this execution
+        void set_key(const std::string &f_name,
+                     const std::string &key,
+                     bool stable);
+        // provides the key contribution of an upstream filter,
+        // returns false if its output can't be reused.
+        bool input_key(const std::string &f_name,
+                       std::string &key);
+
+        // returns true and fills ent if f_name has an entry with key
+        bool lookup(const std::string &f_name,
+                    const std::string &key,
+                    Entry &ent);
+        // replaces the entry for f_name, takes ownership of data
+        void store(const std::string &f_name,
+                   const std::string &key,
+                   Data *data,
+                   int passthrough_port);
+        // removes and releases the entry for f_name
+        void remove(const std::string &f_name);
+
+        int  hits() const;
+
+    private:
+        void release(Entry &ent);
+
+        std::map<std::string,Entry>        m_entries;
+        // keys for the current execution
+        std::map<std::string,std::string>  m_keys;
+        int                                m_hits;
+        std::mutex                         m_lock;
+};
+
 //-----------------------------------------------------------------------------
 class Workspace::FilterFactory
 {
@@ -207,6 +324,386 @@ Workspace::ExecutionPlan::bf_topo_sort_visit(Graph &graph,
 
 }
 
+//-----------------------------------------------------------------------------
+Workspace::Scheduler::Scheduler(Workspace &w,
+                                conduit::Node &traversals)
+: m_workspace(w),
+  m_num_completed(0),
+  m_done(false),
+  m_error()
+{
+    Graph &graph = w.graph();
+
+    std::map<std::string,int> task_ids;
+
+    // flatten the traversals, they are topologically sorted
+    NodeIterator travs_itr = traversals.children();
+    while(travs_itr.has_next())
+    {
+        NodeIterator trav_itr(&travs_itr.next());
+        while(trav_itr.has_next())
+        {
+            Node &t = trav_itr.next();
+            std::string f_name = trav_itr.name();
+
+            Task task;
+            task.filter  = graph.filters()[f_name];
+            task.uref    = t.to_int32();
+            task.pending = task.filter->number_of_input_ports();
+
+            task_ids[f_name] = (int)m_tasks.size();
+            m_tasks.push_back(task);
+        }
+    }
+
+    // wire up dependents using the graph's input edges
+    for(size_t i = 0; i < m_tasks.size(); i++)
+    {
+        Filter *f = m_tasks[i].filter;
+        NodeConstIterator f_inputs(&graph.edges_in(f->name()));
+        while(f_inputs.has_next())
+        {
+            std::string f_in_name = f_inputs.next().as_string();
+            m_tasks[task_ids[f_in_name]].dependents.push_back((int)i);
+        }
+
+        if(!f->thread_safe())
+        {
+            m_serial_tasks.push_back((int)i);
+        }
+    }
+
+    m_ready.resize(m_tasks.size(), false);
+    for(size_t i = 0; i < m_tasks.size(); i++)
+    {
+        if(m_tasks[i].pending == 0)
+        {
+            m_ready[i] = true;
+            if(m_tasks[i].filter->thread_safe())
+            {
+                m_parallel_queue.push_back((int)i);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+Workspace::Scheduler::~Scheduler()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Scheduler::execute(int num_threads)
+{
+    const int num_tasks = (int)m_tasks.size();
+
+    std::vector<std::thread> workers;
+    for(int i = 1; i < num_threads; i++)
+    {
+        workers.push_back(std::thread(&Scheduler::worker_loop, this));
+    }
+
+    // the calling thread executes all non thread safe filters in order,
+    // and helps with thread safe filters while it waits
+    size_t serial_idx = 0;
+    while(true)
+    {
+        int task_id = -1;
+        {
+            std::unique_lock<std::mutex> guard(m_lock);
+            m_cond.wait(guard, [&]
+            {
+                return m_error ||
+                       m_num_completed == num_tasks ||
+                       !m_parallel_queue.empty() ||
+                       (serial_idx < m_serial_tasks.size() &&
+                        m_ready[m_serial_tasks[serial_idx]]);
+            });
+
+            if(m_error || m_num_completed == num_tasks)
+            {
+                break;
+            }
+
+            if(serial_idx < m_serial_tasks.size() &&
+               m_ready[m_serial_tasks[serial_idx]])
+            {
+                task_id = m_serial_tasks[serial_idx];
+                serial_idx++;
+            }
+            else
+            {
+                task_id = m_parallel_queue.front();
+                m_parallel_queue.pop_front();
+            }
+        }
+
+        run_task(task_id);
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_done = true;
+    }
+    m_cond.notify_all();
+
+    for(size_t i = 0; i < workers.size(); i++)
+    {
+        workers[i].join();
+    }
+
+    if(m_error)
+    {
+        std::rethrow_exception(m_error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Scheduler::worker_loop()
+{
+    while(true)
+    {
+        int task_id = -1;
+        {
+            std::unique_lock<std::mutex> guard(m_lock);
+            m_cond.wait(guard, [&]
+            {
+                return m_done || m_error || !m_parallel_queue.empty();
+            });
+
+            if(m_done || m_error)
+            {
+                return;
+            }
+
+            task_id = m_parallel_queue.front();
+            m_parallel_queue.pop_front();
+        }
+
+        run_task(task_id);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Scheduler::run_task(int task_id)
+{
+    try
+    {
+        Task &task = m_tasks[task_id];
+        float elapsed = m_workspace.execute_filter(task.filter, task.uref);
+
+        std::lock_guard<std::mutex> guard(m_lock);
+        if(m_workspace.m_enable_timings)
+        {
+            m_workspace.m_timing_info << g_timing_exec_count
+                                      << " " << task.filter->name()
+                                      << " " << std::fixed << elapsed
+                                      <<"\n";
+        }
+    }
+    catch(...)
+    {
+        fail(std::current_exception());
+        return;
+    }
+
+    complete_task(task_id);
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Scheduler::complete_task(int task_id)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_num_completed++;
+
+        const std::vector<int> &deps = m_tasks[task_id].dependents;
+        for(size_t i = 0; i < deps.size(); i++)
+        {
+            Task &dep = m_tasks[deps[i]];
+            dep.pending--;
+            if(dep.pending == 0)
+            {
+                m_ready[deps[i]] = true;
+                if(dep.filter->thread_safe())
+                {
+                    m_parallel_queue.push_back(deps[i]);
+                }
+            }
+        }
+    }
+    m_cond.notify_all();
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Scheduler::fail(std::exception_ptr err)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        // keep the first error
+        if(!m_error)
+        {
+            m_error = err;
+        }
+    }
+    m_cond.notify_all();
+}
+
+//-----------------------------------------------------------------------------
+Workspace::OutputCache::OutputCache()
+: m_hits(0)
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+Workspace::OutputCache::~OutputCache()
+{
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::OutputCache::begin_execute()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_keys.clear();
+    m_hits = 0;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::OutputCache::clear()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    std::map<std::string,Entry>::iterator itr;
+    for(itr = m_entries.begin(); itr != m_entries.end(); itr++)
+    {
+        release(itr->second);
+    }
+    m_entries.clear();
+    m_keys.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::OutputCache::set_key(const std::string &f_name,
+                                const std::string &key,
+                                bool stable)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    if(key != "")
+    {
+        m_keys[f_name] = key;
+    }
+    else if(stable)
+    {
+        // stable sources contribute nothing to the key
+        m_keys[f_name] = "";
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool
+Workspace::OutputCache::input_key(const std::string &f_name,
+                                  std::string &key)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    std::map<std::string,std::string>::const_iterator k_itr = m_keys.find(f_name);
+    if(k_itr == m_keys.end())
+    {
+        return false;
+    }
+
+    key = f_name;
+    std::map<std::string,Entry>::const_iterator e_itr = m_entries.find(f_name);
+    if(e_itr != m_entries.end())
+    {
+        ostringstream oss;
+        oss << f_name << "@" << e_itr->second.version;
+        key = oss.str();
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+bool
+Workspace::OutputCache::lookup(const std::string &f_name,
+                               const std::string &key,
+                               Entry &ent)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    std::map<std::string,Entry>::const_iterator itr = m_entries.find(f_name);
+    if(itr == m_entries.end() || itr->second.key != key)
+    {
+        return false;
+    }
+    ent = itr->second;
+    m_hits++;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::OutputCache::store(const std::string &f_name,
+                              const std::string &key,
+                              Data *data,
+                              int passthrough_port)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    int version = 0;
+    std::map<std::string,Entry>::iterator itr = m_entries.find(f_name);
+    if(itr != m_entries.end())
+    {
+        version = itr->second.version + 1;
+        release(itr->second);
+    }
+
+    Entry &ent = m_entries[f_name];
+    ent.key  = key;
+    ent.data = data;
+    ent.passthrough_port = passthrough_port;
+    ent.version = version;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::OutputCache::remove(const std::string &f_name)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    std::map<std::string,Entry>::iterator itr = m_entries.find(f_name);
+    if(itr != m_entries.end())
+    {
+        release(itr->second);
+        m_entries.erase(itr);
+    }
+}
+
+//-----------------------------------------------------------------------------
+int
+Workspace::OutputCache::hits() const
+{
+    return m_hits;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::OutputCache::release(Entry &ent)
+{
+    if(ent.data != NULL)
+    {
+        ent.data->release();
+        delete ent.data;
+        ent.data = NULL;
+    }
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 
@@ -215,15 +712,26 @@ Workspace::Workspace()
 :m_graph(this),
  m_registry(),
  m_timing_info(),
- m_enable_timings(false)
+ m_enable_timings(false),
+ m_enable_parallel(false),
+ m_num_threads(0),
+ m_enable_caching(false),
+ m_output_cache(NULL),
+ m_enable_perf_records(false),
+ m_perf_probe(NULL),
+ m_perf_record(),
+ m_perf_lock()
 {
-
+    m_output_cache = new OutputCache();
 }
 
 //-----------------------------------------------------------------------------
 Workspace::~Workspace()
 {
-
+    // cached outputs may be referenced by the registry,
+    // so clear the registry first
+    registry().reset();
+    delete m_output_cache;
 }
 
 //-----------------------------------------------------------------------------
@@ -263,13 +771,210 @@ Workspace::traversals(Node &traversals)
     ExecutionPlan::generate(graph(),traversals);
 }
 
+//-----------------------------------------------------------------------------
+std::string
+Workspace::output_cache_key(Filter *f)
+{
+    std::string key = "";
+    Node sig;
+    if(f->cache_signature(sig))
+    {
+        Node n_key;
+        n_key["type_name"] = f->type_name();
+        n_key["signature"].set(sig);
+
+        bool inputs_ok = true;
+        NodeConstIterator ports_itr = NodeConstIterator(&f->port_names());
+        while(ports_itr.has_next() && inputs_ok)
+        {
+            std::string port_name = ports_itr.next().as_string();
+            std::string f_input_name = graph().edges_in(f->name())[port_name].as_string();
+            std::string input_key;
+            inputs_ok = m_output_cache->input_key(f_input_name,input_key);
+            n_key["inputs"][port_name] = input_key;
+        }
+
+        if(inputs_ok)
+        {
+            key = n_key.to_json();
+        }
+    }
+
+    m_output_cache->set_key(f->name(),
+                            key,
+                            f->number_of_input_ports() == 0);
+    return key;
+}
+
+//-----------------------------------------------------------------------------
+float
+Workspace::execute_filter(Filter *f, int uref)
+{
+    std::string f_name = f->name();
+
+    std::string cache_key = "";
+    if(m_enable_caching)
+    {
+        cache_key = output_cache_key(f);
+        if(cache_key == "")
+        {
+            m_output_cache->remove(f_name);
+        }
+    }
+
+    NodeConstIterator ports_itr = NodeConstIterator(&f->port_names());
+
+    OutputCache::Entry cached;
+    if(cache_key != "" && m_output_cache->lookup(f_name,cache_key,cached))
+    {
+        // nothing changed, reuse the previous output
+        if(f->output_port())
+        {
+            if(cached.passthrough_port >= 0)
+            {
+                std::string port_name = f->port_index_to_name(cached.passthrough_port);
+                std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
+                registry().add(f_name,
+                               registry().fetch(f_input_name),
+                               uref);
+            }
+            else
+            {
+                // cached outputs are owned by the cache
+                f->cached_output_reused(*cached.data);
+                registry().detach(f_name);
+                registry().add(f_name,
+                               *cached.data,
+                               -1);
+            }
+        }
+
+        while(ports_itr.has_next())
+        {
+            std::string port_name = ports_itr.next().as_string();
+            std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
+            registry().consume(f_input_name);
+        }
+
+        if(m_enable_perf_records)
+        {
+            std::lock_guard<std::mutex> guard(m_perf_lock);
+            Node &rec = m_perf_record["filters"].add_child(f_name);
+            rec["type"] = f->type_name();
+            rec["wall_time"] = 0.0;
+            rec["cached"] = 1;
+        }
+
+        return 0.0f;
+    }
+
+    f->reset_inputs_and_output();
+
+    // fetch inputs from reg, attach to filter's ports
+    //registry().print();
+    while(ports_itr.has_next())
+    {
+        std::string port_name = ports_itr.next().as_string();
+        std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
+        f->set_input(port_name,&registry().fetch(f_input_name));
+    }
+
+    if(m_enable_perf_records && m_perf_probe != NULL)
+    {
+        m_perf_probe->begin(*f);
+    }
+
+    Timer t_flt_exec;
+    // execute
+    f->execute();
+    float elapsed = t_flt_exec.elapsed();
+
+    if(m_enable_perf_records)
+    {
+        Node rec;
+        rec["type"] = f->type_name();
+        rec["wall_time"] = (float64)elapsed;
+        rec["cached"] = 0;
+        if(m_perf_probe != NULL)
+        {
+            m_perf_probe->end(*f,rec);
+        }
+        std::lock_guard<std::mutex> guard(m_perf_lock);
+        m_perf_record["filters"].add_child(f_name).set(rec);
+    }
+
+    // if has output, set output
+    if(f->output_port())
+    {
+        if(f->output().data_ptr() == NULL)
+        {
+            CONDUIT_ERROR("filter output is NULL, was set_output() called?");
+        }
+
+        if(cache_key != "")
+        {
+            // check if the output passes through one of the inputs
+            int passthrough_port = -1;
+            int num_ports = f->number_of_input_ports();
+            for(int i = 0; i < num_ports && passthrough_port == -1; i++)
+            {
+                if(f->input(i).data_ptr() == f->output().data_ptr())
+                {
+                    passthrough_port = i;
+                }
+            }
+
+            if(passthrough_port >= 0)
+            {
+                m_output_cache->store(f_name,cache_key,NULL,passthrough_port);
+                registry().add(f_name,
+                               f->output(),
+                               uref);
+            }
+            else
+            {
+                // the cache takes ownership of the output,
+                // so the registry does not track it
+                m_output_cache->store(f_name,
+                                      cache_key,
+                                      f->output().wrap(f->output().data_ptr()),
+                                      -1);
+                registry().detach(f_name);
+                registry().add(f_name,
+                               f->output(),
+                               -1);
+            }
+        }
+        else
+        {
+            registry().add(f_name,
+                           f->output(),
+                           uref);
+        }
+    }
+    else if(cache_key != "")
+    {
+        m_output_cache->store(f_name,cache_key,NULL,-1);
+    }
+
+    f->reset_inputs_and_output();
+
+    // consume inputs
+    ports_itr.to_front();
+    while(ports_itr.has_next())
+    {
+        std::string port_name = ports_itr.next().as_string();
+        std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
+        registry().consume(f_input_name);
+    }
+
+    return elapsed;
+}
+
 //-----------------------------------------------------------------------------
 void
-Workspace::execute()
+Workspace::execute_serial(Node &traversals)
 {
-    Timer t_total_exec;
-    Node traversals;
-    ExecutionPlan::generate(graph(),traversals);
     // execute traversals
     NodeIterator travs_itr = traversals.children();
 
@@ -285,55 +990,55 @@ Workspace::execute()
             int          uref   = t.to_int32();
             Filter      *f      = graph().filters()[f_name];
 
-            f->reset_inputs_and_output();
-
-            // fetch inputs from reg, attach to filter's ports
-            NodeConstIterator ports_itr = NodeConstIterator(&f->port_names());
-            //registry().print();
-            std::vector<std::string> f_i_names;
-            while(ports_itr.has_next())
-            {
-                std::string port_name = ports_itr.next().as_string();
-                std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
-                f->set_input(port_name,&registry().fetch(f_input_name));
-            }
-
-            Timer t_flt_exec;
-            // execute
-            f->execute();
+            float elapsed = execute_filter(f,uref);
 
             if(m_enable_timings)
             {
                 m_timing_info << g_timing_exec_count
                               << " " << f->name()
-                              << " " << std::fixed << t_flt_exec.elapsed()
+                              << " " << std::fixed << elapsed
                               <<"\n";
             }
+        }
+    }
+}
 
-            // if has output, set output
-            if(f->output_port())
-            {
-                if(f->output().data_ptr() == NULL)
-                {
-                    CONDUIT_ERROR("filter output is NULL, was set_output() called?");
-                }
+//-----------------------------------------------------------------------------
+void
+Workspace::execute_parallel(Node &traversals)
+{
+    Scheduler scheduler(*this,traversals);
+    scheduler.execute(number_of_threads());
+}
 
-                registry().add(f_name,
-                               f->output(),
-                               uref);
-            }
+//-----------------------------------------------------------------------------
+void
+Workspace::execute()
+{
+    Timer t_total_exec;
+    Node traversals;
+    ExecutionPlan::generate(graph(),traversals);
 
-            f->reset_inputs_and_output();
+    if(m_enable_perf_records)
+    {
+        m_perf_record.reset();
+        m_perf_record["filters"].set(DataType::object());
+    }
 
-            // consume inputs
-            ports_itr.to_front();
-            while(ports_itr.has_next())
-            {
-                std::string port_name = ports_itr.next().as_string();
-                std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
-                registry().consume(f_input_name);
-            }
-        }
+    m_output_cache->begin_execute();
+
+    if(m_enable_parallel && number_of_threads() > 1)
+    {
+        execute_parallel(traversals);
+    }
+    else
+    {
+        execute_serial(traversals);
+    }
+
+    if(m_enable_perf_records)
+    {
+        m_perf_record["total/wall_time"] = (float64)t_total_exec.elapsed();
     }
 
     if(m_enable_timings)
@@ -344,10 +1049,46 @@ Workspace::execute()
                       <<"\n";
         g_timing_exec_count++;
     }
+}
+
+//-----------------------------------------------------------------------------
+Workspace::PerformanceProbe::~PerformanceProbe()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::enable_performance_records(bool enabled)
+{
+    m_enable_perf_records = enabled;
+    if(!enabled)
+    {
+        m_perf_record.reset();
+    }
+}
 
+//-----------------------------------------------------------------------------
+bool
+Workspace::performance_records_enabled() const
+{
+    return m_enable_perf_records;
+}
 
+//-----------------------------------------------------------------------------
+void
+Workspace::set_performance_probe(PerformanceProbe *probe)
+{
+    m_perf_probe = probe;
+}
 
+//-----------------------------------------------------------------------------
+const Node &
+Workspace::performance_record() const
+{
+    return m_perf_record;
 }
+
 //-----------------------------------------------------------------------------
 
 void Workspace::enable_timings(bool enabled)
@@ -355,12 +1096,79 @@ void Workspace::enable_timings(bool enabled)
   m_enable_timings = enabled;
 }
 
+//-----------------------------------------------------------------------------
+void
+Workspace::enable_parallel_execution(bool enabled)
+{
+    m_enable_parallel = enabled;
+}
+
+//-----------------------------------------------------------------------------
+bool
+Workspace::parallel_execution_enabled() const
+{
+    return m_enable_parallel;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::enable_output_caching(bool enabled)
+{
+    if(!enabled)
+    {
+        clear_output_cache();
+    }
+    m_enable_caching = enabled;
+}
+
+//-----------------------------------------------------------------------------
+bool
+Workspace::output_caching_enabled() const
+{
+    return m_enable_caching;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::clear_output_cache()
+{
+    m_output_cache->clear();
+}
+
+//-----------------------------------------------------------------------------
+int
+Workspace::number_of_cache_hits() const
+{
+    return m_output_cache->hits();
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::set_number_of_threads(int num_threads)
+{
+    m_num_threads = num_threads;
+}
+
+//-----------------------------------------------------------------------------
+int
+Workspace::number_of_threads() const
+{
+    if(m_num_threads > 0)
+    {
+        return m_num_threads;
+    }
+
+    int hw_threads = (int)std::thread::hardware_concurrency();
+    return hw_threads > 0 ? hw_threads : 1;
+}
+
 //-----------------------------------------------------------------------------
 void
 Workspace::reset()
 {
     graph().reset();
     registry().reset();
+    m_output_cache->clear();
 }
 
 
@@ -22,6 +22,7 @@
 #include <flow_registry.hpp>
 #include <flow_graph.hpp>
 #include <sstream>
+#include <mutex>
 
 
 //-----------------------------------------------------------------------------
@@ -145,6 +146,75 @@ public:
 
     void enable_timings(bool enabled);
 
+    // ------------------------------------------------------------------------
+    /// Parallel execution
+    ///
+    /// When enabled, execute() dispatches filters whose inputs are ready
+    /// to a pool of threads. Only filters that declare
+    ///   i["thread_safe"] = "true"
+    /// in their interface run on worker threads, all other filters
+    /// run on the calling thread in the same (deterministic) order
+    /// as serial execution.
+    // ------------------------------------------------------------------------
+    void enable_parallel_execution(bool enabled);
+    bool parallel_execution_enabled() const;
+
+    /// number of threads used for parallel execution
+    /// (including the calling thread). values < 1 select
+    /// the number of hardware threads.
+    void set_number_of_threads(int num_threads);
+    int  number_of_threads() const;
+
+    // ------------------------------------------------------------------------
+    /// Output caching
+    ///
+    /// When enabled, filters that provide a cache_signature() keep their
+    /// output across executions. If a filter's signature and the outputs
+    /// of all of its upstream filters are unchanged since the last
+    /// execute(), the filter is skipped and its previous output is reused.
+    ///
+    /// Filters without input ports that don't provide a signature
+    /// (e.g. registry sources) are treated as stable, downstream filters
+    /// that read them are responsible for describing the identity of
+    /// the data they read in their signature.
+    // ------------------------------------------------------------------------
+    void enable_output_caching(bool enabled);
+    bool output_caching_enabled() const;
+    /// releases all cached filter outputs
+    void clear_output_cache();
+    /// number of filters that reused cached output in the last execute()
+    int  number_of_cache_hits() const;
+
+    // ------------------------------------------------------------------------
+    /// Performance records
+    ///
+    /// When enabled, each execute() builds a record of the wall time
+    /// of every filter that ran:
+    ///   filters/<filter name>/type
+    ///   filters/<filter name>/wall_time
+    ///   filters/<filter name>/cached  (output reused, see output caching)
+    ///   total/wall_time
+    ///
+    /// A PerformanceProbe lets the host add its own metrics: begin() is
+    /// called right before a filter executes and end() right after, with
+    /// the filter's record to fill. With parallel execution, several
+    /// filters can be between begin() and end() at the same time.
+    // ------------------------------------------------------------------------
+    class FLOW_API PerformanceProbe
+    {
+    public:
+        virtual ~PerformanceProbe();
+        virtual void begin(const Filter &f) = 0;
+        virtual void end(const Filter &f, conduit::Node &record) = 0;
+    };
+
+    void enable_performance_records(bool enabled);
+    bool performance_records_enabled() const;
+    /// the probe is not owned by the workspace, NULL removes it
+    void set_performance_probe(PerformanceProbe *probe);
+    /// the record of the last execute()
+    const conduit::Node &performance_record() const;
+
 private:
 
     static Filter *create_filter(const std::string &filter_type);
@@ -153,11 +223,31 @@ private:
 
     class ExecutionPlan;
     class FilterFactory;
+    class Scheduler;
+    class OutputCache;
+
+    // runs a single filter: binds inputs from the registry,
+    // executes, registers output and consumes inputs.
+    // returns the filter's execution time.
+    float             execute_filter(Filter *f, int uref);
+    // returns the key used to check for a cached output of f
+    // (empty if f's output can't be reused)
+    std::string       output_cache_key(Filter *f);
+    void              execute_serial(conduit::Node &traversals);
+    void              execute_parallel(conduit::Node &traversals);
 
     Graph             m_graph;
     Registry          m_registry;
     std::stringstream m_timing_info;
     bool              m_enable_timings;
+    bool              m_enable_parallel;
+    int               m_num_threads;
+    bool              m_enable_caching;
+    OutputCache      *m_output_cache;
+    bool              m_enable_perf_records;
+    PerformanceProbe *m_perf_probe;
+    conduit::Node     m_perf_record;
+    std::mutex        m_perf_lock;
 
 };
 
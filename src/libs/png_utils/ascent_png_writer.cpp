@@ -0,0 +1,471 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_png_writer.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_png_writer.hpp"
+#include "ascent_png_encoder.hpp"
+
+#include <conduit.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace ascent
+{
+
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+struct PNGWriteJob
+{
+    std::vector<float>         m_float_rgba;
+    std::vector<unsigned char> m_rgba;
+    int                        m_width;
+    int                        m_height;
+    std::string                m_filename;
+    bool                       m_has_comments;
+    std::vector<std::string>   m_comments;
+
+    void Execute()
+    {
+        PNGEncoder encoder;
+        if(!m_rgba.empty() && m_has_comments)
+        {
+            encoder.Encode(&m_rgba[0], m_width, m_height, m_comments);
+        }
+        else if(!m_rgba.empty())
+        {
+            encoder.Encode(&m_rgba[0], m_width, m_height);
+        }
+        else if(m_has_comments)
+        {
+            encoder.Encode(&m_float_rgba[0], m_width, m_height, m_comments);
+        }
+        else
+        {
+            encoder.Encode(&m_float_rgba[0], m_width, m_height);
+        }
+        encoder.Save(m_filename);
+    }
+};
+
+//-----------------------------------------------------------------------------
+// bounded queue of jobs drained by a pool of worker threads
+//-----------------------------------------------------------------------------
+class PNGWriteService
+{
+public:
+    PNGWriteService()
+      : m_async(false),
+        m_distributed(false),
+        m_num_threads(2),
+        m_max_queue_size(16),
+        m_in_flight(0),
+        m_shutdown(false)
+    {}
+
+    ~PNGWriteService()
+    {
+        Stop();
+    }
+
+    void Submit(PNGWriteJob &job)
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        if(!m_async)
+        {
+            lock.unlock();
+            job.Execute();
+            return;
+        }
+
+        Start();
+        m_space.wait(lock, [this]
+        {
+          return (int) m_queue.size() < m_max_queue_size;
+        });
+        m_queue.emplace_back();
+        std::swap(m_queue.back(), job);
+        m_in_flight++;
+        m_work.notify_one();
+    }
+
+    // waits for the queued jobs and hands back the failures
+    // recorded since the last flush
+    void Flush(std::vector<std::string> &failures)
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_done.wait(lock, [this] { return m_in_flight == 0; });
+        failures.swap(m_failures);
+        m_failures.clear();
+    }
+
+    // finishes the queued work and joins the workers
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_shutdown = true;
+        }
+        m_work.notify_all();
+        for(auto &worker : m_workers)
+        {
+            worker.join();
+        }
+        m_workers.clear();
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_shutdown = false;
+    }
+
+    bool m_async;
+    bool m_distributed;
+    int  m_num_threads;
+    int  m_max_queue_size;
+    mutable std::mutex m_lock;
+
+private:
+    // must hold the lock
+    void Start()
+    {
+        while((int) m_workers.size() < m_num_threads)
+        {
+            m_workers.emplace_back(&PNGWriteService::Work, this);
+        }
+    }
+
+    void Work()
+    {
+        while(true)
+        {
+            PNGWriteJob job;
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                m_work.wait(lock, [this]
+                {
+                  return m_shutdown || !m_queue.empty();
+                });
+                if(m_queue.empty())
+                {
+                    // shutting down and nothing left to do
+                    return;
+                }
+                std::swap(job, m_queue.front());
+                m_queue.pop_front();
+                m_space.notify_one();
+            }
+
+            // the encoder reports failed writes through conduit,
+            // which throws, so keep them from escaping the thread
+            std::string failure;
+            try
+            {
+                job.Execute();
+            }
+            catch(conduit::Error &e)
+            {
+                failure = job.m_filename + ": " + e.message();
+            }
+            catch(std::exception &e)
+            {
+                failure = job.m_filename + ": " + e.what();
+            }
+
+            std::lock_guard<std::mutex> lock(m_lock);
+            if(!failure.empty())
+            {
+                m_failures.push_back(failure);
+            }
+            m_in_flight--;
+            if(m_in_flight == 0)
+            {
+                m_done.notify_all();
+            }
+        }
+    }
+
+    std::deque<PNGWriteJob>  m_queue;
+    std::vector<std::thread> m_workers;
+    std::vector<std::string> m_failures;
+    int                      m_in_flight;
+    bool                     m_shutdown;
+    std::condition_variable  m_work;
+    std::condition_variable  m_space;
+    std::condition_variable  m_done;
+};
+
+//-----------------------------------------------------------------------------
+// the queue of the executing runtime
+//-----------------------------------------------------------------------------
+std::mutex &
+active_queue_lock()
+{
+    static std::mutex lock;
+    return lock;
+}
+
+PNGWriteQueue *&
+active_queue_ptr()
+{
+    static PNGWriteQueue *queue = nullptr;
+    return queue;
+}
+
+PNGWriteQueue *
+active_queue()
+{
+    std::lock_guard<std::mutex> lock(active_queue_lock());
+    return active_queue_ptr();
+}
+
+};
+
+//-----------------------------------------------------------------------------
+PNGWriteQueue::PNGWriteQueue()
+  : m_service(new detail::PNGWriteService())
+{
+}
+
+//-----------------------------------------------------------------------------
+PNGWriteQueue::~PNGWriteQueue()
+{
+    // the workers finish everything that is queued before they exit
+    delete m_service;
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriteQueue::SetAsync(bool on)
+{
+    if(!on)
+    {
+        // anything already queued still gets written
+        Flush();
+    }
+    std::lock_guard<std::mutex> lock(m_service->m_lock);
+    m_service->m_async = on;
+}
+
+//-----------------------------------------------------------------------------
+bool
+PNGWriteQueue::Async() const
+{
+    std::lock_guard<std::mutex> lock(m_service->m_lock);
+    return m_service->m_async;
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriteQueue::SetNumberOfThreads(int num_threads)
+{
+    // new threads are started on the next write
+    Flush();
+    m_service->Stop();
+    std::lock_guard<std::mutex> lock(m_service->m_lock);
+    m_service->m_num_threads = num_threads < 1 ? 1 : num_threads;
+}
+
+//-----------------------------------------------------------------------------
+int
+PNGWriteQueue::NumberOfThreads() const
+{
+    std::lock_guard<std::mutex> lock(m_service->m_lock);
+    return m_service->m_num_threads;
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriteQueue::SetMaxQueueSize(int max_size)
+{
+    std::lock_guard<std::mutex> lock(m_service->m_lock);
+    m_service->m_max_queue_size = max_size < 1 ? 1 : max_size;
+}
+
+//-----------------------------------------------------------------------------
+int
+PNGWriteQueue::MaxQueueSize() const
+{
+    std::lock_guard<std::mutex> lock(m_service->m_lock);
+    return m_service->m_max_queue_size;
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriteQueue::SetDistributed(bool on)
+{
+    std::lock_guard<std::mutex> lock(m_service->m_lock);
+    m_service->m_distributed = on;
+}
+
+//-----------------------------------------------------------------------------
+bool
+PNGWriteQueue::Distributed() const
+{
+    std::lock_guard<std::mutex> lock(m_service->m_lock);
+    return m_service->m_distributed;
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriteQueue::Flush()
+{
+    std::vector<std::string> failures;
+    m_service->Flush(failures);
+    if(!failures.empty())
+    {
+        std::ostringstream msg;
+        msg << "Failed to write " << failures.size() << " image(s):";
+        for(const std::string &failure : failures)
+        {
+            msg << "\n  " << failure;
+        }
+        CONDUIT_ERROR(msg.str());
+    }
+}
+
+//-----------------------------------------------------------------------------
+PNGWriter::Scope::Scope(PNGWriteQueue &queue)
+{
+    std::lock_guard<std::mutex> lock(detail::active_queue_lock());
+    m_previous = detail::active_queue_ptr();
+    detail::active_queue_ptr() = &queue;
+}
+
+//-----------------------------------------------------------------------------
+PNGWriter::Scope::~Scope()
+{
+    std::lock_guard<std::mutex> lock(detail::active_queue_lock());
+    detail::active_queue_ptr() = m_previous;
+}
+
+//-----------------------------------------------------------------------------
+bool
+PNGWriter::Distributed()
+{
+    PNGWriteQueue *queue = detail::active_queue();
+    return queue != nullptr && queue->Distributed();
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriter::Write(const float *rgba,
+                 const int width,
+                 const int height,
+                 const std::string &filename)
+{
+    PNGWriteQueue *queue = detail::active_queue();
+    if(queue == nullptr || !queue->Async())
+    {
+        PNGEncoder encoder;
+        encoder.Encode(rgba, width, height);
+        encoder.Save(filename);
+        return;
+    }
+
+    detail::PNGWriteJob job;
+    job.m_float_rgba.assign(rgba, rgba + width * height * 4);
+    job.m_width = width;
+    job.m_height = height;
+    job.m_filename = filename;
+    job.m_has_comments = false;
+    queue->m_service->Submit(job);
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriter::Write(const float *rgba,
+                 const int width,
+                 const int height,
+                 const std::string &filename,
+                 const std::vector<std::string> &comments)
+{
+    PNGWriteQueue *queue = detail::active_queue();
+    if(queue == nullptr || !queue->Async())
+    {
+        PNGEncoder encoder;
+        encoder.Encode(rgba, width, height, comments);
+        encoder.Save(filename);
+        return;
+    }
+
+    detail::PNGWriteJob job;
+    job.m_float_rgba.assign(rgba, rgba + width * height * 4);
+    job.m_width = width;
+    job.m_height = height;
+    job.m_filename = filename;
+    job.m_has_comments = true;
+    job.m_comments = comments;
+    queue->m_service->Submit(job);
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriter::Write(std::vector<unsigned char> &rgba,
+                 const int width,
+                 const int height,
+                 const std::string &filename)
+{
+    detail::PNGWriteJob job;
+    job.m_rgba.swap(rgba);
+    job.m_width = width;
+    job.m_height = height;
+    job.m_filename = filename;
+    job.m_has_comments = false;
+    PNGWriteQueue *queue = detail::active_queue();
+    if(queue == nullptr)
+    {
+        job.Execute();
+        return;
+    }
+    queue->m_service->Submit(job);
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriter::Write(std::vector<unsigned char> &rgba,
+                 const int width,
+                 const int height,
+                 const std::string &filename,
+                 const std::vector<std::string> &comments)
+{
+    detail::PNGWriteJob job;
+    job.m_rgba.swap(rgba);
+    job.m_width = width;
+    job.m_height = height;
+    job.m_filename = filename;
+    job.m_has_comments = true;
+    job.m_comments = comments;
+    PNGWriteQueue *queue = detail::active_queue();
+    if(queue == nullptr)
+    {
+        job.Execute();
+        return;
+    }
+    queue->m_service->Submit(job);
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriter::Flush()
+{
+    PNGWriteQueue *queue = detail::active_queue();
+    if(queue != nullptr)
+    {
+        queue->Flush();
+    }
+}
+
+};
@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_png_writer.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef ASCENT_PNG_WRITER_HPP
+#define ASCENT_PNG_WRITER_HPP
+
+#include <png_utils/ascent_png_utils_exports.h>
+
+#include <string>
+#include <vector>
+
+namespace ascent
+{
+
+namespace detail
+{
+class PNGWriteService;
+};
+
+//-----------------------------------------------------------------------------
+// Queue of png writes owned by a runtime, along with its write options.
+//
+// By default images are encoded and written on the calling thread. When
+// async writes are enabled, the color buffer is handed to a pool of
+// background threads owned by the queue. The queue is bounded, so writes
+// block if too many images are waiting. Flush waits for all queued images
+// to be on disk, and so does destroying the queue. Background writes that
+// fail are kept and raised as a conduit error by the next Flush.
+//
+// When distributed writes are enabled, renderers spread the encoding of
+// image batches (e.g., cinema databases) across ranks instead of
+// encoding everything on rank 0.
+//-----------------------------------------------------------------------------
+class ASCENT_API PNGWriteQueue
+{
+public:
+    PNGWriteQueue();
+    ~PNGWriteQueue();
+
+    void    SetAsync(bool on);
+    bool    Async() const;
+    // values less than 1 use a single thread
+    void    SetNumberOfThreads(int num_threads);
+    int     NumberOfThreads() const;
+    void    SetMaxQueueSize(int max_size);
+    int     MaxQueueSize() const;
+    void    SetDistributed(bool on);
+    bool    Distributed() const;
+
+    // waits until all queued images are written, throws a conduit
+    // error listing the images that failed to write since the last flush
+    void    Flush();
+
+private:
+    friend class PNGWriter;
+    PNGWriteQueue(const PNGWriteQueue &);
+    PNGWriteQueue &operator=(const PNGWriteQueue &);
+
+    detail::PNGWriteService *m_service;
+};
+
+//-----------------------------------------------------------------------------
+// Encodes and saves png files through the active write queue.
+//
+// Renderers write images with the static methods below. They go to the
+// queue of the runtime that is executing (see Scope), and are written
+// synchronously when no queue is active.
+//-----------------------------------------------------------------------------
+class ASCENT_API PNGWriter
+{
+public:
+    // makes a queue active while in scope, the previously
+    // active queue (e.g. of a runtime that fired a trigger)
+    // is restored when the scope ends
+    class ASCENT_API Scope
+    {
+    public:
+        Scope(PNGWriteQueue &queue);
+        ~Scope();
+    private:
+        PNGWriteQueue *m_previous;
+    };
+
+    // true if the active queue spreads encoding across ranks
+    static bool    Distributed();
+
+    // rgba values in [0,1], only copied if the write is async
+    static void    Write(const float *rgba,
+                         const int width,
+                         const int height,
+                         const std::string &filename);
+
+    static void    Write(const float *rgba,
+                         const int width,
+                         const int height,
+                         const std::string &filename,
+                         const std::vector<std::string> &comments);
+
+    // rgba values in [0,255], the contents are moved into the writer
+    static void    Write(std::vector<unsigned char> &rgba,
+                         const int width,
+                         const int height,
+                         const std::string &filename);
+
+    static void    Write(std::vector<unsigned char> &rgba,
+                         const int width,
+                         const int height,
+                         const std::string &filename,
+                         const std::vector<std::string> &comments);
+
+    // waits until all images queued on the active queue are written
+    // (see PNGWriteQueue::Flush)
+    static void    Flush();
+};
+
+};
+
+#endif
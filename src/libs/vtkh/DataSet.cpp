@@ -6,6 +6,7 @@
 // FIXME:UDA: vtkm_dataset_info depends on vtkm::rendering
 #include <vtkh/utils/vtkm_dataset_info.hpp>
 // std includes
+#include <algorithm>
 #include <limits>
 #include <sstream>
 //vtkm includes
@@ -67,6 +68,45 @@ bool GlobalSomeoneAgrees(bool local)
   return agreement;
 }
 
+#ifdef VTKH_PARALLEL
+//
+// reduction for the fused metadata collectives. buffer[0] holds the
+// number of values after it that are summed, the rest use max
+//
+void SumThenMax(void *in, void *inout, int *len, MPI_Datatype *)
+{
+  const double *in_ptr = static_cast<const double*>(in);
+  double *inout_ptr = static_cast<double*>(inout);
+  const int num_sums = static_cast<int>(inout_ptr[0]);
+  for(int i = 1; i <= num_sums; ++i)
+  {
+    inout_ptr[i] += in_ptr[i];
+  }
+  for(int i = num_sums + 1; i < *len; ++i)
+  {
+    inout_ptr[i] = std::max(inout_ptr[i], in_ptr[i]);
+  }
+}
+
+void SumThenMaxAllreduce(std::vector<double> &values)
+{
+  // creating the op is local and cheap, so do it per call
+  // instead of keeping one alive past MPI_Finalize
+  MPI_Op op;
+  MPI_Op_create(SumThenMax, 1, &op);
+  MPI_Comm mpi_comm = MPI_Comm_f2c(vtkh::GetMPICommHandle());
+  std::vector<double> result(values.size());
+  MPI_Allreduce(values.data(),
+                result.data(),
+                static_cast<int>(values.size()),
+                MPI_DOUBLE,
+                op,
+                mpi_comm);
+  MPI_Op_free(&op);
+  values.swap(result);
+}
+#endif
+
 template<typename T>
 class MemSetWorklet : public vtkm::worklet::WorkletMapField
 {
@@ -118,6 +158,7 @@ DataSet::AddDomain(vtkm::cont::DataSet data_set, vtkm::Id domain_id)
   assert(m_domains.size() == m_domain_ids.size());
   m_domains.push_back(data_set);
   m_domain_ids.push_back(domain_id);
+  InvalidateGlobalMetadata();
 }
 
 vtkm::cont::Field
@@ -193,7 +234,12 @@ DataSet::GetNumberOfCells() const
 vtkm::Id
 DataSet::GetGlobalNumberOfCells() const
 {
-  vtkm::Id num_cells = GetNumberOfCells();;
+  if(m_global_metadata.m_has_cells)
+  {
+    return m_global_metadata.m_cells;
+  }
+
+  vtkm::Id num_cells = GetNumberOfCells();
 #ifdef VTKH_PARALLEL
   MPI_Comm mpi_comm = MPI_Comm_f2c(vtkh::GetMPICommHandle());
   long long int local_cells = static_cast<long long int>(num_cells);
@@ -206,6 +252,8 @@ DataSet::GetGlobalNumberOfCells() const
                 mpi_comm);
   num_cells = global_cells;
 #endif
+  m_global_metadata.m_has_cells = true;
+  m_global_metadata.m_cells = num_cells;
   return num_cells;
 }
 
@@ -214,6 +262,11 @@ DataSet::GetGlobalNumberOfCells() const
 vtkm::Id
 DataSet::GetGlobalNumberOfDomains() const
 {
+  if(m_global_metadata.m_has_domains)
+  {
+    return m_global_metadata.m_domains;
+  }
+
   vtkm::Id domains = this->GetNumberOfDomains();
 #ifdef VTKH_PARALLEL
   MPI_Comm mpi_comm = MPI_Comm_f2c(vtkh::GetMPICommHandle());
@@ -227,6 +280,8 @@ DataSet::GetGlobalNumberOfDomains() const
                 mpi_comm);
   domains = global_doms;
 #endif
+  m_global_metadata.m_has_domains = true;
+  m_global_metadata.m_domains = domains;
   return domains;
 }
 
@@ -273,6 +328,13 @@ DataSet::GetBounds(vtkm::Id coordinate_system_index) const
 vtkm::Bounds
 DataSet::GetGlobalBounds(vtkm::Id coordinate_system_index) const
 {
+  // only the default coordinate system is cached
+  const bool cacheable = coordinate_system_index == 0;
+  if(cacheable && m_global_metadata.m_has_bounds)
+  {
+    return m_global_metadata.m_bounds;
+  }
+
   VTKH_DATA_OPEN("GetGlobalBounds");
   vtkm::Bounds bounds;
   bounds = GetBounds(coordinate_system_index);
@@ -342,6 +404,11 @@ DataSet::GetGlobalBounds(vtkm::Id coordinate_system_index) const
   bounds.Z.Min = global_z_min;
   bounds.Z.Max = global_z_max;
 #endif
+  if(cacheable)
+  {
+    m_global_metadata.m_has_bounds = true;
+    m_global_metadata.m_bounds = bounds;
+  }
   VTKH_DATA_CLOSE();
   return bounds;
 }
@@ -400,8 +467,21 @@ DataSet::GetRange(const std::string &field_name) const
 vtkm::cont::ArrayHandle<vtkm::Range>
 DataSet::GetGlobalRange(const std::string &field_name) const
 {
-  VTKH_DATA_OPEN("GetGlobalRange");
   vtkm::cont::ArrayHandle<vtkm::Range> range;
+  auto cached = m_global_metadata.m_ranges.find(field_name);
+  if(cached != m_global_metadata.m_ranges.end())
+  {
+    const std::vector<vtkm::Range> &values = cached->second;
+    range.Allocate(static_cast<vtkm::Id>(values.size()));
+    auto portal = range.WritePortal();
+    for(size_t i = 0; i < values.size(); ++i)
+    {
+      portal.Set(static_cast<vtkm::Id>(i), values[i]);
+    }
+    return range;
+  }
+
+  VTKH_DATA_OPEN("GetGlobalRange");
   range = GetRange(field_name);
 
 #ifdef VTKH_PARALLEL
@@ -494,6 +574,14 @@ DataSet::GetGlobalRange(const std::string &field_name) const
 
   delete[] global_components;
 #endif
+  std::vector<vtkm::Range> &values = m_global_metadata.m_ranges[field_name];
+  const vtkm::Id num_values = range.GetNumberOfValues();
+  auto portal = range.ReadPortal();
+  values.resize(num_values);
+  for(vtkm::Id i = 0; i < num_values; ++i)
+  {
+    values[i] = portal.Get(i);
+  }
   VTKH_DATA_CLOSE();
   return range;
 }
@@ -529,8 +617,19 @@ DataSet::IsEmpty() const
 bool
 DataSet::GlobalIsEmpty() const
 {
+  if(m_global_metadata.m_has_cells)
+  {
+    return m_global_metadata.m_cells == 0;
+  }
+  if(m_global_metadata.m_has_empty)
+  {
+    return m_global_metadata.m_empty;
+  }
+
   bool is_empty = IsEmpty();
   is_empty = detail::GlobalAgreement(is_empty);
+  m_global_metadata.m_has_empty = true;
+  m_global_metadata.m_empty = is_empty;
   return is_empty;
 }
 
@@ -690,6 +789,7 @@ DataSet::AddConstantPointField(const vtkm::Float32 value, const std::string fiel
     vtkm::cont::Field field(fieldname, vtkm::cont::Field::Association::Points, array);
     m_domains[i].AddField(field);
   }
+  InvalidateGlobalMetadata();
 }
 
 bool
@@ -737,11 +837,18 @@ DataSet::RemoveField(const std::string &field_name)
         m_domains[i] = domain_new;
     }
   }
+  InvalidateGlobalMetadata();
 }
 
 bool
 DataSet::GlobalFieldExists(const std::string &field_name) const
 {
+  auto cached = m_global_metadata.m_field_exists.find(field_name);
+  if(cached != m_global_metadata.m_field_exists.end())
+  {
+    return cached->second;
+  }
+
   bool exists = FieldExists(field_name);
 #ifdef VTKH_PARALLEL
   int local_boolean = exists ? 1 : 0;
@@ -766,6 +873,7 @@ DataSet::GlobalFieldExists(const std::string &field_name) const
     exists = false;
   }
 #endif
+  m_global_metadata.m_field_exists[field_name] = exists;
   return exists;
 }
 
@@ -878,6 +986,12 @@ DataSet::GetFieldAssociation(const std::string field_name, bool &valid_field) co
 
 vtkm::Id DataSet::NumberOfComponents(const std::string &field_name) const
 {
+  auto cached = m_global_metadata.m_components.find(field_name);
+  if(cached != m_global_metadata.m_components.end())
+  {
+    return cached->second;
+  }
+
   int num_components = 0;
 
   const size_t num_domains = m_domains.size();
@@ -903,7 +1017,199 @@ vtkm::Id DataSet::NumberOfComponents(const std::string &field_name) const
 
   num_components = global_comps;
 #endif
+  m_global_metadata.m_components[field_name] = num_components;
   return num_components;
 }
 
+void
+DataSet::InvalidateGlobalMetadata()
+{
+  m_global_metadata = GlobalMetadata();
+}
+
+void
+DataSet::UpdateGlobalMetadata(const std::vector<std::string> &field_names) const
+{
+  // the cache is only ever filled and dropped collectively, so
+  // every rank takes the same branch here
+  bool cached = m_global_metadata.m_has_cells &&
+                m_global_metadata.m_has_domains;
+  for(size_t f = 0; cached && f < field_names.size(); ++f)
+  {
+    cached = m_global_metadata.m_field_exists.count(field_names[f]) != 0 &&
+             m_global_metadata.m_components.count(field_names[f]) != 0;
+  }
+  if(cached)
+  {
+    return;
+  }
+
+  VTKH_DATA_OPEN("UpdateGlobalMetadata");
+  const size_t num_fields = field_names.size();
+
+  //
+  // gather everything this rank knows. Nothing here may throw,
+  // otherwise the other ranks would hang in the collectives
+  //
+  bool bounds_failed = false;
+  vtkm::Bounds bounds;
+  try
+  {
+    bounds = GetBounds(0);
+  }
+  catch(const Error &)
+  {
+    bounds_failed = true;
+  }
+
+  std::vector<int> exists(num_fields, 0);
+  std::vector<int> flat_comps(num_fields, 0);
+  // -1 if the local domains do not agree on the number of components
+  std::vector<int> range_comps(num_fields, 0);
+  std::vector<vtkm::cont::ArrayHandle<vtkm::Range>> ranges(num_fields);
+  for(size_t f = 0; f < num_fields; ++f)
+  {
+    const std::string &name = field_names[f];
+    exists[f] = FieldExists(name) ? 1 : 0;
+    if(!exists[f])
+    {
+      continue;
+    }
+    for(size_t i = 0; i < m_domains.size(); ++i)
+    {
+      if(m_domains[i].HasField(name))
+      {
+        flat_comps[f] =
+          m_domains[i].GetField(name).GetData().GetNumberOfComponentsFlat();
+        break;
+      }
+    }
+    try
+    {
+      ranges[f] = GetRange(name);
+      range_comps[f] = static_cast<int>(ranges[f].GetNumberOfValues());
+    }
+    catch(const Error &)
+    {
+      range_comps[f] = -1;
+    }
+  }
+
+  //
+  // first pass: counts, bounds, and the structure of each field
+  //
+  std::vector<double> values;
+  values.push_back(2.);  // number of summed values
+  values.push_back(static_cast<double>(GetNumberOfCells()));
+  values.push_back(static_cast<double>(GetNumberOfDomains()));
+  values.push_back(-bounds.X.Min);
+  values.push_back(bounds.X.Max);
+  values.push_back(-bounds.Y.Min);
+  values.push_back(bounds.Y.Max);
+  values.push_back(-bounds.Z.Min);
+  values.push_back(bounds.Z.Max);
+  values.push_back(bounds_failed ? 1. : 0.);
+  const double no_comps = std::numeric_limits<double>::max();
+  for(size_t f = 0; f < num_fields; ++f)
+  {
+    values.push_back(exists[f]);
+    values.push_back(flat_comps[f]);
+    values.push_back(range_comps[f]);
+    // negated so max gives the smallest count among ranks with the field
+    values.push_back(exists[f] ? -range_comps[f] : -no_comps);
+  }
+#ifdef VTKH_PARALLEL
+  detail::SumThenMaxAllreduce(values);
+#endif
+
+  m_global_metadata.m_has_cells = true;
+  m_global_metadata.m_cells = static_cast<vtkm::Id>(values[1]);
+  m_global_metadata.m_has_domains = true;
+  m_global_metadata.m_domains = static_cast<vtkm::Id>(values[2]);
+  if(values[9] == 0.)
+  {
+    vtkm::Bounds global_bounds;
+    global_bounds.X.Min = -values[3];
+    global_bounds.X.Max = values[4];
+    global_bounds.Y.Min = -values[5];
+    global_bounds.Y.Max = values[6];
+    global_bounds.Z.Min = -values[7];
+    global_bounds.Z.Max = values[8];
+    m_global_metadata.m_has_bounds = true;
+    m_global_metadata.m_bounds = global_bounds;
+  }
+
+  // fields whose ranges are consistent across ranks
+  std::vector<size_t> valid_fields;
+  std::vector<int> global_comps(num_fields, 0);
+  for(size_t f = 0; f < num_fields; ++f)
+  {
+    const double *field_values = &values[10 + f * 4];
+    const std::string &name = field_names[f];
+    const bool global_exists = field_values[0] > 0.;
+    m_global_metadata.m_field_exists[name] = global_exists;
+    m_global_metadata.m_components[name] =
+      static_cast<vtkm::Id>(field_values[1]);
+
+    const int max_comps = static_cast<int>(field_values[2]);
+    if(!global_exists || max_comps == 0)
+    {
+      m_global_metadata.m_ranges[name].clear();
+    }
+    else if(static_cast<double>(max_comps) == -field_values[3])
+    {
+      global_comps[f] = max_comps;
+      valid_fields.push_back(f);
+    }
+    // anything else is a mismatch that GetGlobalRange reports
+  }
+
+  //
+  // second pass: ranges of every component of the valid fields
+  //
+  values.clear();
+  values.push_back(0.);
+  for(size_t v = 0; v < valid_fields.size(); ++v)
+  {
+    const size_t f = valid_fields[v];
+    const bool has_range = exists[f] && range_comps[f] == global_comps[f];
+    for(int c = 0; c < global_comps[f]; ++c)
+    {
+      if(has_range)
+      {
+        const vtkm::Range c_range = ranges[f].ReadPortal().Get(c);
+        values.push_back(-c_range.Min);
+        values.push_back(c_range.Max);
+      }
+      else
+      {
+        values.push_back(std::numeric_limits<double>::lowest());
+        values.push_back(std::numeric_limits<double>::lowest());
+      }
+    }
+  }
+#ifdef VTKH_PARALLEL
+  if(values.size() > 1)
+  {
+    detail::SumThenMaxAllreduce(values);
+  }
+#endif
+
+  size_t offset = 1;
+  for(size_t v = 0; v < valid_fields.size(); ++v)
+  {
+    const size_t f = valid_fields[v];
+    std::vector<vtkm::Range> &field_ranges =
+      m_global_metadata.m_ranges[field_names[f]];
+    field_ranges.resize(global_comps[f]);
+    for(int c = 0; c < global_comps[f]; ++c)
+    {
+      field_ranges[c].Min = -values[offset];
+      field_ranges[c].Max = values[offset + 1];
+      offset += 2;
+    }
+  }
+  VTKH_DATA_CLOSE();
+}
+
 } // namspace vtkh
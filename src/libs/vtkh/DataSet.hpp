@@ -2,6 +2,7 @@
 #define VTK_H_DATA_SET_HPP
 
 
+#include <map>
 #include <vector>
 #include <string>
 
@@ -19,6 +20,47 @@ protected:
   std::vector<vtkm::Id>            m_domain_ids;
   vtkm::UInt64                     m_cycle;
   double                           m_time;
+
+  // results of global queries, so asking again on an unchanged
+  // data set does not cost another collective. Copies start out
+  // empty: filters copy their input and then change the domains in
+  // place, so the values of the source do not carry over.
+  struct GlobalMetadata
+  {
+    GlobalMetadata() = default;
+    GlobalMetadata(const GlobalMetadata &) {}
+    GlobalMetadata &operator=(const GlobalMetadata &other)
+    {
+      if(this != &other)
+      {
+        m_has_bounds = false;
+        m_bounds = vtkm::Bounds();
+        m_has_cells = false;
+        m_cells = 0;
+        m_has_domains = false;
+        m_domains = 0;
+        m_has_empty = false;
+        m_empty = false;
+        m_field_exists.clear();
+        m_components.clear();
+        m_ranges.clear();
+      }
+      return *this;
+    }
+
+    bool                                       m_has_bounds = false;
+    vtkm::Bounds                               m_bounds;
+    bool                                       m_has_cells = false;
+    vtkm::Id                                   m_cells = 0;
+    bool                                       m_has_domains = false;
+    vtkm::Id                                   m_domains = 0;
+    bool                                       m_has_empty = false;
+    bool                                       m_empty = false;
+    std::map<std::string, bool>                m_field_exists;
+    std::map<std::string, vtkm::Id>            m_components;
+    std::map<std::string, std::vector<vtkm::Range>> m_ranges;
+  };
+  mutable GlobalMetadata           m_global_metadata;
 public:
   DataSet();
   ~DataSet();
@@ -110,6 +152,18 @@ public:
 
   bool IsPointMesh() const;
 
+  // Computes the global bounds, cell and domain counts, and the
+  // existence, number of components and range of each of the given
+  // fields in two fused collectives, and caches them. Later global
+  // queries for the same values do not communicate.
+  //
+  // Must be called on all ranks with the same field names.
+  void UpdateGlobalMetadata(const std::vector<std::string> &field_names) const;
+  // Drops cached global values. AddDomain, RemoveField and
+  // AddConstantPointField do this automatically. Call it on all
+  // ranks after changing domains in place (e.g., through GetDomain).
+  void InvalidateGlobalMetadata();
+
   void PrintSummary(std::ostream &stream) const;
 };
 
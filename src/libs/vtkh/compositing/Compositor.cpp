@@ -3,6 +3,7 @@
 
 #include <assert.h>
 #include <algorithm>
+#include <mutex>
 
 #ifdef VTKH_PARALLEL
 #include <mpi.h>
@@ -15,6 +16,58 @@
 namespace vtkh
 {
 
+namespace detail
+{
+
+// images released by compositors are kept here, so the next render
+// (or the next cycle's renderer) reuses their buffers instead of
+// allocating full resolution images again. They are freed by
+// Compositor::ReleaseImagePool
+const size_t max_pooled_images = 16;
+
+std::mutex &image_pool_mutex()
+{
+  static std::mutex pool_mutex;
+  return pool_mutex;
+}
+
+std::vector<Image> &image_pool()
+{
+  static std::vector<Image> pool;
+  return pool;
+}
+
+Image acquire_image()
+{
+  Image image;
+  {
+    std::lock_guard<std::mutex> lock(image_pool_mutex());
+    std::vector<Image> &pool = image_pool();
+    if(!pool.empty())
+    {
+      image = std::move(pool.back());
+      pool.pop_back();
+    }
+  }
+  image.m_orig_rank = -1;
+  image.m_has_transparency = false;
+  image.m_composite_order = -1;
+  return image;
+}
+
+void release_images(std::vector<Image> &images)
+{
+  std::lock_guard<std::mutex> lock(image_pool_mutex());
+  std::vector<Image> &pool = image_pool();
+  for(size_t i = 0; i < images.size() && pool.size() < max_pooled_images; ++i)
+  {
+    pool.push_back(std::move(images[i]));
+  }
+  images.clear();
+}
+
+} // namespace detail
+
 Compositor::Compositor()
   : m_composite_mode(Z_BUFFER_SURFACE)
 {
@@ -23,7 +76,7 @@ Compositor::Compositor()
 
 Compositor::~Compositor()
 {
-
+  detail::release_images(m_images);
 }
 
 void
@@ -37,7 +90,7 @@ Compositor::SetCompositeMode(CompositeMode composite_mode)
 void
 Compositor::ClearImages()
 {
-  m_images.clear();
+  detail::release_images(m_images);
 }
 
 void
@@ -48,38 +101,31 @@ Compositor::AddImage(const unsigned char *color_buffer,
 {
   assert(m_composite_mode != VIS_ORDER_BLEND);
   assert(depth_buffer != NULL);
-  Image image;
   if(m_images.size() == 0)
   {
-    m_images.push_back(image);
+    m_images.push_back(detail::acquire_image());
     m_images[0].Init(color_buffer,
                      depth_buffer,
                      width,
                      height);
-    //m_images[0].Save("first.png");
   }
   else if(m_composite_mode == Z_BUFFER_SURFACE)
   {
     //
-    // Do local composite and keep a single image
+    // Do local composite into the single image we keep
     //
-    image.Init(color_buffer,
-               depth_buffer,
-               width,
-               height);
+    assert(m_images[0].GetNumberOfPixels() == width * height);
     vtkh::ImageCompositor compositor;
-    compositor.ZBufferComposite(m_images[0],image);
+    compositor.ZBufferComposite(m_images[0], color_buffer, depth_buffer);
   }
   else
   {
-    const size_t image_index = m_images.size();
-    m_images.push_back(image);
-    m_images[image_index].Init(color_buffer,
-                               depth_buffer,
-                               width,
-                               height);
+    m_images.push_back(detail::acquire_image());
+    m_images.back().Init(color_buffer,
+                         depth_buffer,
+                         width,
+                         height);
   }
-
 }
 
 void
@@ -90,10 +136,9 @@ Compositor::AddImage(const float *color_buffer,
 {
   assert(m_composite_mode != VIS_ORDER_BLEND);
   assert(depth_buffer != NULL);
-  Image image;
   if(m_images.size() == 0)
   {
-    m_images.push_back(image);
+    m_images.push_back(detail::acquire_image());
     m_images[0].Init(color_buffer,
                      depth_buffer,
                      width,
@@ -102,26 +147,20 @@ Compositor::AddImage(const float *color_buffer,
   else if(m_composite_mode == Z_BUFFER_SURFACE)
   {
     //
-    // Do local composite and keep a single image
+    // Do local composite into the single image we keep
     //
-    image.Init(color_buffer,
-               depth_buffer,
-               width,
-               height);
-
+    assert(m_images[0].GetNumberOfPixels() == width * height);
     vtkh::ImageCompositor compositor;
-    compositor.ZBufferComposite(m_images[0],image);
+    compositor.ZBufferComposite(m_images[0], color_buffer, depth_buffer);
   }
   else
   {
-    const size_t image_index = m_images.size();
-    m_images.push_back(image);
-    m_images[image_index].Init(color_buffer,
-                               depth_buffer,
-                               width,
-                               height);
+    m_images.push_back(detail::acquire_image());
+    m_images.back().Init(color_buffer,
+                         depth_buffer,
+                         width,
+                         height);
   }
-
 }
 
 void
@@ -132,14 +171,12 @@ Compositor::AddImage(const unsigned char *color_buffer,
                      const int            vis_order)
 {
   assert(m_composite_mode == VIS_ORDER_BLEND);
-  Image image;
-  const size_t image_index = m_images.size();
-  m_images.push_back(image);
-  m_images[image_index].Init(color_buffer,
-                             depth_buffer,
-                             width,
-                             height,
-                             vis_order);
+  m_images.push_back(detail::acquire_image());
+  m_images.back().Init(color_buffer,
+                       depth_buffer,
+                       width,
+                       height,
+                       vis_order);
 }
 
 void
@@ -150,15 +187,12 @@ Compositor::AddImage(const float *color_buffer,
                      const int    vis_order)
 {
   assert(m_composite_mode == VIS_ORDER_BLEND);
-  Image image;
-  const size_t image_index = m_images.size();
-  m_images.push_back(image);
-
-  m_images[image_index].Init(color_buffer,
-                             depth_buffer,
-                             width,
-                             height,
-                             vis_order);
+  m_images.push_back(detail::acquire_image());
+  m_images.back().Init(color_buffer,
+                       depth_buffer,
+                       width,
+                       height,
+                       vis_order);
 }
 
 Image
@@ -196,6 +230,16 @@ Compositor::GetLogString()
   return res;
 }
 
+void
+Compositor::ReleaseImagePool()
+{
+  std::vector<Image> pool;
+  {
+    std::lock_guard<std::mutex> lock(detail::image_pool_mutex());
+    pool.swap(detail::image_pool());
+  }
+}
+
 void
 Compositor::CompositeZBufferSurface()
 {
@@ -52,6 +52,9 @@ public:
 
     std::string          GetLogString();
 
+    // frees the images that released compositors keep for reuse
+    static void ReleaseImagePool();
+
     unsigned char * ConvertBuffer(const float *buffer, const int size)
     {
         unsigned char *ubytes = new unsigned char[size];
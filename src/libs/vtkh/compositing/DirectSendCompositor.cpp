@@ -33,7 +33,8 @@ struct Redistribute
     const int local_images = block->m_images.size();
     if(proxy.in_link().size() == 0)
     {
-      std::map<vtkhdiy::BlockID, std::vector<Image>> outgoing;
+      // pieces are sent as runs of active pixels
+      std::map<vtkhdiy::BlockID, std::vector<SparseImage>> outgoing;
 
       for(int i = 0; i < world_size; ++i)
       {
@@ -46,11 +47,11 @@ struct Redistribute
 
         for(int img = 0;  img < local_images; ++img)
         {
-          outgoing[dest][img].SubsetFrom(block->m_images[img], vtkm_sub_bounds);
+          outgoing[dest][img].CompressFrom(block->m_images[img], vtkm_sub_bounds);
         }
       } //for
 
-      typename std::map<vtkhdiy::BlockID,std::vector<Image>>::iterator it;
+      typename std::map<vtkhdiy::BlockID,std::vector<SparseImage>>::iterator it;
       for(it = outgoing.begin(); it != outgoing.end(); ++it)
       {
         proxy.enqueue(it->first, it->second);
@@ -59,25 +60,26 @@ struct Redistribute
     else if(block->m_images.at(0).m_composite_order != -1)
     {
       // blend images according to vis order
-      std::vector<Image> images;
+      std::vector<SparseImage> images;
       for(int i = 0; i < proxy.in_link().size(); ++i)
       {
 
-        std::vector<Image> incoming;
+        std::vector<SparseImage> incoming;
         int gid = proxy.in_link().target(i).gid;
         proxy.dequeue(gid, incoming);
         const int in_size = incoming.size();
         for(int img = 0; img < in_size; ++img)
         {
-          images.emplace_back(incoming[img]);
-          //std::cout<<"rank "<<rank<<" rec "<<incoming[img].ToString()<<"\n";
+          images.emplace_back(std::move(incoming[img]));
         }
       } // for
 
+      // blends straight from the active pixel runs
+      Image output;
       ImageCompositor compositor;
-      compositor.OrderedComposite(images);
+      compositor.OrderedComposite(images, output);
 
-      block->m_output.Swap(images[0]);
+      block->m_output.Swap(output);
     } // else if
     else if(block->m_images.at(0).m_composite_order == -1 &&
             block->m_images.at(0).HasTransparency())
@@ -86,14 +88,14 @@ struct Redistribute
       for(int i = 0; i < proxy.in_link().size(); ++i)
       {
 
-        std::vector<Image> incoming;
+        std::vector<SparseImage> incoming;
         int gid = proxy.in_link().target(i).gid;
         proxy.dequeue(gid, incoming);
         const int in_size = incoming.size();
         for(int img = 0; img < in_size; ++img)
         {
-          images.emplace_back(incoming[img]);
-          //std::cout<<"rank "<<rank<<" rec "<<incoming[img].ToString()<<"\n";
+          images.emplace_back();
+          incoming[img].Decompress(images.back());
         }
       } // for
 
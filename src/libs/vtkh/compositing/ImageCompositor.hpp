@@ -2,7 +2,9 @@
 #define VTKH_DIY_IMAGE_COMPOSITOR_HPP
 
 #include <vtkh/compositing/Image.hpp>
+#include <vtkh/compositing/SparseImage.hpp>
 #include <algorithm>
+#include <cmath>
 
 #include<vtkh/vtkh_exports.h>
 
@@ -46,6 +48,49 @@ public:
     }
   }
 
+  //
+  // Blend directly from the active pixel runs. Inactive pixels are
+  // fully transparent, so they only clamp the front depth.
+  //
+  void Blend(vtkh::Image &front, const vtkh::SparseImage &back)
+  {
+    assert(front.m_bounds.X.Min == back.m_bounds.X.Min);
+    assert(front.m_bounds.Y.Min == back.m_bounds.Y.Min);
+    assert(front.m_bounds.X.Max == back.m_bounds.X.Max);
+    assert(front.m_bounds.Y.Max == back.m_bounds.Y.Max);
+
+    const float back_depth = std::min(back.m_background_depth, 1.001f);
+    back.ForEachRun(
+      [&](int index, int count)
+      {
+        for(int i = index; i < index + count; ++i)
+        {
+          float d1 = std::min(front.m_depths[i], 1.001f);
+          front.m_depths[i] = std::min(d1, back_depth);
+        }
+      },
+      [&](int i, int active_index)
+      {
+        const int offset = i * 4;
+        const int back_offset = active_index * 4;
+        unsigned int alpha = front.m_pixels[offset + 3];
+        const unsigned int opacity = 255 - alpha;
+
+        front.m_pixels[offset + 0] +=
+          static_cast<unsigned char>(opacity * back.m_pixels[back_offset + 0] / 255);
+        front.m_pixels[offset + 1] +=
+          static_cast<unsigned char>(opacity * back.m_pixels[back_offset + 1] / 255);
+        front.m_pixels[offset + 2] +=
+          static_cast<unsigned char>(opacity * back.m_pixels[back_offset + 2] / 255);
+        front.m_pixels[offset + 3] +=
+          static_cast<unsigned char>(opacity * back.m_pixels[back_offset + 3] / 255);
+
+        float d1 = std::min(front.m_depths[i], 1.001f);
+        float d2 = std::min(back.m_depths[active_index], 1.001f);
+        front.m_depths[i] = std::min(d1,d2);
+      });
+  }
+
 void ZBufferComposite(vtkh::Image &front, const vtkh::Image &image)
 {
   assert(front.m_depths.size() == front.m_pixels.size() / 4);
@@ -75,6 +120,115 @@ void ZBufferComposite(vtkh::Image &front, const vtkh::Image &image)
   }
 }
 
+//
+// Composite a raw color and depth buffer straight into front, without
+// staging it in an image first. Depths are treated the same way as
+// Image::Init does. The depth test is a select rather than a branch
+// so the loop vectorizes.
+//
+void ZBufferComposite(vtkh::Image &front,
+                      const unsigned char *color_buffer,
+                      const float *depth_buffer)
+{
+  assert(front.m_depths.size() == front.m_pixels.size() / 4);
+
+  const int size = static_cast<int>(front.m_depths.size());
+  unsigned char *front_pixels = &front.m_pixels[0];
+  float *front_depths = &front.m_depths[0];
+
+#ifdef VTKH_OPENMP_ENABLED
+  #pragma omp parallel for
+#endif
+  for(int i = 0; i < size; ++i)
+  {
+    float depth = depth_buffer[i];
+    depth = depth < 0.f ? 2.f : depth;
+    const bool closer = depth <= 1.f && depth <= front_depths[i];
+    const int offset = i * 4;
+    front_depths[i] = closer ? depth : front_depths[i];
+    front_pixels[offset + 0] = closer ? color_buffer[offset + 0] : front_pixels[offset + 0];
+    front_pixels[offset + 1] = closer ? color_buffer[offset + 1] : front_pixels[offset + 1];
+    front_pixels[offset + 2] = closer ? color_buffer[offset + 2] : front_pixels[offset + 2];
+    front_pixels[offset + 3] = closer ? color_buffer[offset + 3] : front_pixels[offset + 3];
+  }
+}
+
+void ZBufferComposite(vtkh::Image &front,
+                      const float *color_buffer,
+                      const float *depth_buffer)
+{
+  assert(front.m_depths.size() == front.m_pixels.size() / 4);
+
+  const int size = static_cast<int>(front.m_depths.size());
+  unsigned char *front_pixels = &front.m_pixels[0];
+  float *front_depths = &front.m_depths[0];
+
+#ifdef VTKH_OPENMP_ENABLED
+  #pragma omp parallel for
+#endif
+  for(int i = 0; i < size; ++i)
+  {
+    const float depth = std::abs(depth_buffer[i]);
+    const bool closer = depth <= 1.f && depth <= front_depths[i];
+    const int offset = i * 4;
+    const unsigned char r = static_cast<unsigned char>(color_buffer[offset + 0] * 255.f);
+    const unsigned char g = static_cast<unsigned char>(color_buffer[offset + 1] * 255.f);
+    const unsigned char b = static_cast<unsigned char>(color_buffer[offset + 2] * 255.f);
+    const unsigned char a = static_cast<unsigned char>(color_buffer[offset + 3] * 255.f);
+    front_depths[i] = closer ? depth : front_depths[i];
+    front_pixels[offset + 0] = closer ? r : front_pixels[offset + 0];
+    front_pixels[offset + 1] = closer ? g : front_pixels[offset + 1];
+    front_pixels[offset + 2] = closer ? b : front_pixels[offset + 2];
+    front_pixels[offset + 3] = closer ? a : front_pixels[offset + 3];
+  }
+}
+
+//
+// Composite directly from the active pixel runs. Inactive pixels are
+// beyond the far plane so they never win the depth test.
+//
+void ZBufferComposite(vtkh::Image &front, const vtkh::SparseImage &image)
+{
+  assert(front.m_depths.size() == front.m_pixels.size() / 4);
+  assert(front.m_bounds.X.Min == image.m_bounds.X.Min);
+  assert(front.m_bounds.Y.Min == image.m_bounds.Y.Min);
+  assert(front.m_bounds.X.Max == image.m_bounds.X.Max);
+  assert(front.m_bounds.Y.Max == image.m_bounds.Y.Max);
+
+  image.ForEachRun(
+    [](int, int) {},
+    [&](int i, int active_index)
+    {
+      const float depth = image.m_depths[active_index];
+      if(depth > 1.f  || front.m_depths[i] < depth)
+      {
+        return;
+      }
+      const int offset = i * 4;
+      const int image_offset = active_index * 4;
+      front.m_depths[i] = abs(depth);
+      front.m_pixels[offset + 0] = image.m_pixels[image_offset + 0];
+      front.m_pixels[offset + 1] = image.m_pixels[image_offset + 1];
+      front.m_pixels[offset + 2] = image.m_pixels[image_offset + 2];
+      front.m_pixels[offset + 3] = image.m_pixels[image_offset + 3];
+    });
+}
+
+//
+// Blend sparse images in composite order, the result goes into output
+//
+void OrderedComposite(std::vector<vtkh::SparseImage> &images,
+                      vtkh::Image &output)
+{
+  const int total_images = images.size();
+  std::sort(images.begin(), images.end(), SparseCompositeOrderSort());
+  images[0].Decompress(output);
+  for(int i = 1; i < total_images; ++i)
+  {
+    Blend(output, images[i]);
+  }
+}
+
 void OrderedComposite(std::vector<vtkh::Image> &images)
 {
   const int total_images = images.size();
@@ -31,6 +31,27 @@ void DepthComposite<Image>(Image &front, Image &back)
   compositor.ZBufferComposite(front, back);
 }
 
+// Receive an image and composite it into the local one. Images are
+// composited straight from their active pixel runs.
+void ReceiveComposite(const vtkhdiy::ReduceProxy &proxy,
+                      int gid,
+                      Image &image)
+{
+  SparseImage incoming;
+  proxy.dequeue(gid, incoming);
+  vtkh::ImageCompositor compositor;
+  compositor.ZBufferComposite(image, incoming);
+}
+
+void ReceiveComposite(const vtkhdiy::ReduceProxy &proxy,
+                      int gid,
+                      PayloadImage &image)
+{
+  PayloadImage incoming;
+  proxy.dequeue(gid, incoming);
+  DepthComposite(image, incoming);
+}
+
 template<typename ImageType>
 void reduce_images(void *b,
                    const vtkhdiy::ReduceProxy &proxy,
@@ -50,9 +71,7 @@ void reduce_images(void *b,
           //skip revieving from self since we sent nothing
           continue;
         }
-        ImageType incoming;
-        proxy.dequeue(gid, incoming);
-        DepthComposite(image, incoming);
+        ReceiveComposite(proxy, gid, image);
       } // for in links
   }
 
@@ -103,24 +122,29 @@ void reduce_images(void *b,
     assert(subset_bounds[group_size-1].max[current_dim] == image_bounds.max[current_dim]);
   }
 
-  std::vector<ImageType> out_images(group_size);
-  for(int i = 0; i < group_size; ++i)
-  {
-    out_images[i].SubsetFrom(image, DIYBoundsToVTKM(subset_bounds[i]));
-  } //for
-
+  // the piece we keep stays dense, the rest are sent as active
+  // pixel runs directly from the full image
+  ImageType self_image;
+  bool keep_self = false;
   for(int i = 0; i < group_size; ++i)
   {
+      const vtkm::Bounds sub_bounds = DIYBoundsToVTKM(subset_bounds[i]);
       if(proxy.out_link().target(i).gid == proxy.gid())
       {
-        image.Swap(out_images[i]);
+        self_image.SubsetFrom(image, sub_bounds);
+        keep_self = true;
       }
       else
       {
-        proxy.enqueue(proxy.out_link().target(i), out_images[i]);
+        EnqueueImage(proxy, proxy.out_link().target(i), image, sub_bounds);
       }
   } //for
 
+  if(keep_self)
+  {
+    image.Swap(self_image);
+  }
+
 } // reduce images
 
 RadixKCompositor::RadixKCompositor()
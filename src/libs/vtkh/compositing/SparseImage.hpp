@@ -0,0 +1,248 @@
+#ifndef VTKH_DIY_SPARSE_IMAGE_HPP
+#define VTKH_DIY_SPARSE_IMAGE_HPP
+
+#include <vector>
+#include <vtkm/Bounds.h>
+
+#include <vtkh/compositing/Image.hpp>
+#include <vtkh/vtkh_exports.h>
+
+namespace vtkh
+{
+
+//
+// Run length encoded version of an Image that only stores active pixels.
+// A pixel is inactive when it is fully transparent and has the background
+// depth (the depth of the first pixel that is beyond the far plane),
+// so decompressing always gives back the exact dense image.
+//
+// Pixels are visited in row major order of m_bounds and m_runs holds
+// pairs of (inactive count, active count). Only the active pixels are
+// stored in m_pixels and m_depths. This is what gets sent between ranks
+// during compositing, since a rank usually covers a small part of the
+// screen.
+//
+struct VTKH_API SparseImage
+{
+    vtkm::Bounds                 m_orig_bounds;
+    vtkm::Bounds                 m_bounds;
+    std::vector<int>             m_runs;
+    std::vector<unsigned char>   m_pixels;
+    std::vector<float>           m_depths;
+    float                        m_background_depth;
+    int                          m_orig_rank;
+    bool                         m_has_transparency;
+    int                          m_composite_order;
+
+    SparseImage()
+      : m_background_depth(2.f),
+        m_orig_rank(-1),
+        m_has_transparency(false),
+        m_composite_order(-1)
+    {}
+
+    int GetNumberOfPixels() const
+    {
+      const int dx  = m_bounds.X.Max - m_bounds.X.Min + 1;
+      const int dy  = m_bounds.Y.Max - m_bounds.Y.Min + 1;
+      return dx * dy;
+    }
+
+    int GetNumberOfActivePixels() const
+    {
+      return static_cast<int>(m_depths.size());
+    }
+
+    //
+    // Compress the sub-region of the image
+    //
+    void CompressFrom(const Image &image,
+                      const vtkm::Bounds &sub_region)
+    {
+      m_orig_bounds = image.m_orig_bounds;
+      m_bounds = sub_region;
+      m_orig_rank = image.m_orig_rank;
+      m_has_transparency = image.m_has_transparency;
+      m_composite_order = image.m_composite_order;
+
+      assert(sub_region.X.Min >= image.m_bounds.X.Min);
+      assert(sub_region.Y.Min >= image.m_bounds.Y.Min);
+      assert(sub_region.X.Max <= image.m_bounds.X.Max);
+      assert(sub_region.Y.Max <= image.m_bounds.Y.Max);
+
+      const int s_dx  = m_bounds.X.Max - m_bounds.X.Min + 1;
+      const int s_dy  = m_bounds.Y.Max - m_bounds.Y.Min + 1;
+      const int dx  = image.m_bounds.X.Max - image.m_bounds.X.Min + 1;
+      const int start_x = m_bounds.X.Min - image.m_bounds.X.Min;
+      const int start_y = m_bounds.Y.Min - image.m_bounds.Y.Min;
+
+      m_runs.clear();
+      m_pixels.clear();
+      m_depths.clear();
+
+      bool found_background = false;
+      m_background_depth = 2.f;
+
+      int inactive = 0;
+      int active = 0;
+      for(int y = 0; y < s_dy; ++y)
+      {
+        const int row = (y + start_y) * dx + start_x;
+        for(int x = 0; x < s_dx; ++x)
+        {
+          const int index = row + x;
+          const int offset = index * 4;
+          const float depth = image.m_depths[index];
+          bool is_active = true;
+          if(image.m_pixels[offset + 0] == 0 &&
+             image.m_pixels[offset + 1] == 0 &&
+             image.m_pixels[offset + 2] == 0 &&
+             image.m_pixels[offset + 3] == 0 &&
+             depth > 1.f)
+          {
+            if(!found_background)
+            {
+              found_background = true;
+              m_background_depth = depth;
+            }
+            is_active = depth != m_background_depth;
+          }
+
+          if(is_active)
+          {
+            active++;
+            m_pixels.insert(m_pixels.end(),
+                            &image.m_pixels[offset],
+                            &image.m_pixels[offset] + 4);
+            m_depths.push_back(depth);
+          }
+          else
+          {
+            if(active != 0)
+            {
+              m_runs.push_back(inactive);
+              m_runs.push_back(active);
+              inactive = 0;
+              active = 0;
+            }
+            inactive++;
+          }
+        }
+      }
+
+      if(inactive != 0 || active != 0)
+      {
+        m_runs.push_back(inactive);
+        m_runs.push_back(active);
+      }
+    }
+
+    void Compress(const Image &image)
+    {
+      CompressFrom(image, image.m_bounds);
+    }
+
+    //
+    // Calls inactive(index, count) for each run of inactive pixels and
+    // active(index, active_index) for each active pixel, where index is
+    // the pixel index in m_bounds and active_index indexes m_depths
+    //
+    template<typename InactiveFunctor, typename ActiveFunctor>
+    void ForEachRun(InactiveFunctor inactive, ActiveFunctor active) const
+    {
+      int index = 0;
+      int active_index = 0;
+      const int num_runs = static_cast<int>(m_runs.size()) / 2;
+      for(int r = 0; r < num_runs; ++r)
+      {
+        const int inactive_count = m_runs[r * 2 + 0];
+        const int active_count = m_runs[r * 2 + 1];
+        if(inactive_count > 0)
+        {
+          inactive(index, inactive_count);
+        }
+        index += inactive_count;
+        for(int i = 0; i < active_count; ++i)
+        {
+          active(index + i, active_index + i);
+        }
+        index += active_count;
+        active_index += active_count;
+      }
+    }
+
+    //
+    // Fills the passed in image with the contents of this image
+    //
+    void SubsetTo(Image &image) const
+    {
+      image.m_composite_order = m_composite_order;
+      assert(m_bounds.X.Min >= image.m_bounds.X.Min);
+      assert(m_bounds.Y.Min >= image.m_bounds.Y.Min);
+      assert(m_bounds.X.Max <= image.m_bounds.X.Max);
+      assert(m_bounds.Y.Max <= image.m_bounds.Y.Max);
+
+      const int s_dx  = m_bounds.X.Max - m_bounds.X.Min + 1;
+      const int dx  = image.m_bounds.X.Max - image.m_bounds.X.Min + 1;
+      const int start_x = m_bounds.X.Min - image.m_bounds.X.Min;
+      const int start_y = m_bounds.Y.Min - image.m_bounds.Y.Min;
+
+      auto to_image = [&](int index)
+      {
+        const int y = index / s_dx;
+        const int x = index % s_dx;
+        return (y + start_y) * dx + start_x + x;
+      };
+
+      const float background_depth = m_background_depth;
+      ForEachRun(
+        [&](int index, int count)
+        {
+          for(int i = 0; i < count; ++i)
+          {
+            const int dest = to_image(index + i);
+            image.m_pixels[dest * 4 + 0] = 0;
+            image.m_pixels[dest * 4 + 1] = 0;
+            image.m_pixels[dest * 4 + 2] = 0;
+            image.m_pixels[dest * 4 + 3] = 0;
+            image.m_depths[dest] = background_depth;
+          }
+        },
+        [&](int index, int active_index)
+        {
+          const int dest = to_image(index);
+          image.m_pixels[dest * 4 + 0] = m_pixels[active_index * 4 + 0];
+          image.m_pixels[dest * 4 + 1] = m_pixels[active_index * 4 + 1];
+          image.m_pixels[dest * 4 + 2] = m_pixels[active_index * 4 + 2];
+          image.m_pixels[dest * 4 + 3] = m_pixels[active_index * 4 + 3];
+          image.m_depths[dest] = m_depths[active_index];
+        });
+    }
+
+    //
+    // Turn this back into a dense image with the same bounds
+    //
+    void Decompress(Image &image) const
+    {
+      image.m_orig_bounds = m_orig_bounds;
+      image.m_bounds = m_bounds;
+      image.m_orig_rank = m_orig_rank;
+      image.m_has_transparency = m_has_transparency;
+
+      const int size = GetNumberOfPixels();
+      image.m_pixels.resize(size * 4);
+      image.m_depths.resize(size);
+      SubsetTo(image);
+    }
+};
+
+struct SparseCompositeOrderSort
+{
+  inline bool operator()(const SparseImage &lhs, const SparseImage &rhs) const
+  {
+    return lhs.m_composite_order < rhs.m_composite_order;
+  }
+};
+
+} //namespace  vtkh
+#endif
@@ -11,6 +11,47 @@
 namespace vtkh
 {
 
+//
+// Images are sent as runs of active pixels, payload images are sent as is
+//
+inline void EnqueueImage(const vtkhdiy::ReduceProxy &proxy,
+                         const vtkhdiy::BlockID &dest,
+                         const Image &image,
+                         const vtkm::Bounds &sub_region)
+{
+  SparseImage sparse;
+  sparse.CompressFrom(image, sub_region);
+  proxy.enqueue(dest, sparse);
+}
+
+inline void EnqueueImage(const vtkhdiy::ReduceProxy &proxy,
+                         const vtkhdiy::BlockID &dest,
+                         const PayloadImage &image,
+                         const vtkm::Bounds &sub_region)
+{
+  PayloadImage sub_image;
+  sub_image.SubsetFrom(image, sub_region);
+  proxy.enqueue(dest, sub_image);
+}
+
+inline void DequeueSubsetTo(const vtkhdiy::ReduceProxy &proxy,
+                            int gid,
+                            Image &image)
+{
+  SparseImage incoming;
+  proxy.dequeue(gid, incoming);
+  incoming.SubsetTo(image);
+}
+
+inline void DequeueSubsetTo(const vtkhdiy::ReduceProxy &proxy,
+                            int gid,
+                            PayloadImage &image)
+{
+  PayloadImage incoming;
+  proxy.dequeue(gid, incoming);
+  incoming.SubsetTo(image);
+}
+
 template<typename ImageType>
 struct CollectImages
 {
@@ -36,7 +77,7 @@ struct CollectImages
         int dest_gid = collection_rank;
         vtkhdiy::BlockID dest = proxy.out_link().target(dest_gid);
 
-        proxy.enqueue(dest, block->m_image);
+        EnqueueImage(proxy, dest, block->m_image, block->m_image.m_bounds);
         block->m_image.Clear();
       }
     } // if
@@ -54,9 +95,7 @@ struct CollectImages
         {
           continue;
         }
-        ImageType incoming;
-        proxy.dequeue(gid, incoming);
-        incoming.SubsetTo(final_image);
+        DequeueSubsetTo(proxy, gid, final_image);
       } // for
       block->m_image.Swap(final_image);
     } // else
@@ -3,6 +3,7 @@
 
 #include <vtkh/compositing/Image.hpp>
 #include <vtkh/compositing/PayloadImage.hpp>
+#include <vtkh/compositing/SparseImage.hpp>
 #include <diy/master.hpp>
 
 namespace vtkh
@@ -181,6 +182,60 @@ struct Serialization<vtkh::Image>
   }
 };
 
+template<>
+struct Serialization<vtkh::SparseImage>
+{
+  static void save(BinaryBuffer &bb, const vtkh::SparseImage &image)
+  {
+    vtkhdiy::save(bb, image.m_orig_bounds.X.Min);
+    vtkhdiy::save(bb, image.m_orig_bounds.Y.Min);
+    vtkhdiy::save(bb, image.m_orig_bounds.Z.Min);
+    vtkhdiy::save(bb, image.m_orig_bounds.X.Max);
+    vtkhdiy::save(bb, image.m_orig_bounds.Y.Max);
+    vtkhdiy::save(bb, image.m_orig_bounds.Z.Max);
+
+    vtkhdiy::save(bb, image.m_bounds.X.Min);
+    vtkhdiy::save(bb, image.m_bounds.Y.Min);
+    vtkhdiy::save(bb, image.m_bounds.Z.Min);
+    vtkhdiy::save(bb, image.m_bounds.X.Max);
+    vtkhdiy::save(bb, image.m_bounds.Y.Max);
+    vtkhdiy::save(bb, image.m_bounds.Z.Max);
+
+    vtkhdiy::save(bb, image.m_runs);
+    vtkhdiy::save(bb, image.m_pixels);
+    vtkhdiy::save(bb, image.m_depths);
+    vtkhdiy::save(bb, image.m_background_depth);
+    vtkhdiy::save(bb, image.m_orig_rank);
+    vtkhdiy::save(bb, image.m_has_transparency);
+    vtkhdiy::save(bb, image.m_composite_order);
+  }
+
+  static void load(BinaryBuffer &bb, vtkh::SparseImage &image)
+  {
+    vtkhdiy::load(bb, image.m_orig_bounds.X.Min);
+    vtkhdiy::load(bb, image.m_orig_bounds.Y.Min);
+    vtkhdiy::load(bb, image.m_orig_bounds.Z.Min);
+    vtkhdiy::load(bb, image.m_orig_bounds.X.Max);
+    vtkhdiy::load(bb, image.m_orig_bounds.Y.Max);
+    vtkhdiy::load(bb, image.m_orig_bounds.Z.Max);
+
+    vtkhdiy::load(bb, image.m_bounds.X.Min);
+    vtkhdiy::load(bb, image.m_bounds.Y.Min);
+    vtkhdiy::load(bb, image.m_bounds.Z.Min);
+    vtkhdiy::load(bb, image.m_bounds.X.Max);
+    vtkhdiy::load(bb, image.m_bounds.Y.Max);
+    vtkhdiy::load(bb, image.m_bounds.Z.Max);
+
+    vtkhdiy::load(bb, image.m_runs);
+    vtkhdiy::load(bb, image.m_pixels);
+    vtkhdiy::load(bb, image.m_depths);
+    vtkhdiy::load(bb, image.m_background_depth);
+    vtkhdiy::load(bb, image.m_orig_rank);
+    vtkhdiy::load(bb, image.m_has_transparency);
+    vtkhdiy::load(bb, image.m_composite_order);
+  }
+};
+
 } // namespace diy
 
 #endif
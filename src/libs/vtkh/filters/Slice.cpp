@@ -4,9 +4,19 @@
 
 #include <vtkm/VectorAnalysis.h>
 #include <vtkm/cont/Algorithm.h>
+#include <vtkm/cont/ArrayCopy.h>
+#include <vtkm/cont/ArrayHandleConstant.h>
+#include <vtkm/cont/Invoker.h>
 #include <vtkm/cont/TryExecute.h>
+#include <vtkm/exec/CellEdge.h>
 #include <vtkm/worklet/DispatcherMapField.h>
 #include <vtkm/worklet/WorkletMapField.h>
+#include <vtkm/worklet/WorkletMapTopology.h>
+
+#ifdef VTKH_PARALLEL
+#include <mpi.h>
+#include <vtkh/vtkh.hpp>
+#endif
 
 namespace vtkh
 {
@@ -357,94 +367,284 @@ public:
 
 };
 
-template <typename T>
-std::vector<T>
-GetScalarData(vtkh::DataSet &vtkhData, const char *field_name)
+//
+// Helpers for the histograms that AutoSliceLevels uses to score the
+// candidate planes. All planes share one normal, so a point lies on
+// plane s when dot(point, normal) == m_levels[s].
+//
+class SliceHistogramBase
 {
-  //Get domain Ids on this rank
-  //will be nonzero even if there is no data
-  std::vector<vtkm::Id> localDomainIds = vtkhData.GetDomainIds();
-  std::vector<T> data;
-     
-  //if there is data: loop through domains and grab all triangles.
-  if(!vtkhData.IsEmpty())
+protected:
+  vtkm::Vec<vtkm::Float32,3> m_normal;
+  vtkm::Id m_num_levels;
+  vtkm::Id m_num_bins;
+  vtkm::Float64 m_min;
+  vtkm::Float64 m_step;
+
+public:
+  VTKM_CONT
+  SliceHistogramBase(vtkm::Vec<vtkm::Float32,3> normal,
+                     vtkm::Id num_levels,
+                     vtkm::Id num_bins,
+                     vtkm::Range range)
+    : m_normal(normal),
+      m_num_levels(num_levels),
+      m_num_bins(num_bins),
+      m_min(range.Min),
+      m_step(range.Length() / vtkm::Float64(num_bins))
+  {
+    vtkm::Normalize(m_normal);
+  }
+
+  template<typename PointType>
+  VTKM_EXEC
+  vtkm::Float64 Distance(const PointType &point) const
+  {
+    return vtkm::Float64(point[0]) * m_normal[0] +
+           vtkm::Float64(point[1]) * m_normal[1] +
+           vtkm::Float64(point[2]) * m_normal[2];
+  }
+
+  template<typename HistPortal>
+  VTKM_EXEC
+  void AddValue(const vtkm::Id level,
+                const vtkm::Float64 value,
+                const HistPortal &hist) const
   {
-    for(int i = 0; i < localDomainIds.size(); i++)
+    vtkm::Id bin = 0;
+    if(m_step > 0.)
     {
-      vtkm::cont::DataSet dataset = vtkhData.GetDomainById(localDomainIds[i]);
-      vtkm::cont::CoordinateSystem coords = dataset.GetCoordinateSystem();
-      vtkm::cont::UnknownCellSet cellset = dataset.GetCellSet();
-      //Get variable
-      vtkm::cont::Field field = dataset.GetField(field_name);
-      
-      long int size = field.GetNumberOfValues();
-      
-      using data_d = vtkm::cont::ArrayHandle<vtkm::Float64>;
-      using data_f = vtkm::cont::ArrayHandle<vtkm::Float32>;
-      if(field.GetData().IsType<data_d>())
-      {
-        vtkm::cont::ArrayHandle<vtkm::Float64> field_data;
-        field.GetData().AsArrayHandle(field_data);
-        auto portal = field_data.ReadPortal();
+      bin = static_cast<vtkm::Id>((value - m_min) / m_step);
+      bin = vtkm::Max(vtkm::Id(0), vtkm::Min(m_num_bins - 1, bin));
+    }
+    hist.Add(level * m_num_bins + bin, vtkm::Id(1));
+  }
+};
 
-        for(int i = 0; i < size; i++)
-        {
-          data.push_back(portal.Get(i));
-        }
+//
+// Bins the field value at every cell edge crossing of every
+// candidate plane, i.e., the values marching cubes would produce
+//
+class SlicePointHistograms : public vtkm::worklet::WorkletVisitCellsWithPoints,
+                             public SliceHistogramBase
+{
+public:
+  using SliceHistogramBase::SliceHistogramBase;
+
+  typedef void ControlSignature(CellSetIn,
+                                FieldInPoint,
+                                FieldInPoint,
+                                WholeArrayIn,
+                                AtomicArrayInOut);
+  typedef void ExecutionSignature(CellShape, PointCount, _2, _3, _4, _5);
+
+  template<typename ShapeTag,
+           typename PointVecType,
+           typename ValueVecType,
+           typename LevelPortal,
+           typename HistPortal>
+  VTKM_EXEC
+  void operator()(ShapeTag shape,
+                  const vtkm::IdComponent &num_points,
+                  const PointVecType &points,
+                  const ValueVecType &values,
+                  const LevelPortal &levels,
+                  const HistPortal &hist) const
+  {
+    vtkm::Float64 dmin = vtkm::Infinity64();
+    vtkm::Float64 dmax = vtkm::NegativeInfinity64();
+    for(vtkm::IdComponent i = 0; i < num_points; ++i)
+    {
+      const vtkm::Float64 d = this->Distance(points[i]);
+      dmin = vtkm::Min(dmin, d);
+      dmax = vtkm::Max(dmax, d);
+    }
+
+    vtkm::IdComponent num_edges = 0;
+    vtkm::exec::CellEdgeNumberOfEdges(num_points, shape, num_edges);
+
+    for(vtkm::Id level = 0; level < m_num_levels; ++level)
+    {
+      const vtkm::Float64 iso = levels.Get(level);
+      if(iso < dmin || iso > dmax)
+      {
+        continue;
       }
-      if(field.GetData().IsType<data_f>())
+      for(vtkm::IdComponent e = 0; e < num_edges; ++e)
       {
-        vtkm::cont::ArrayHandle<vtkm::Float32> field_data;
-        field.GetData().AsArrayHandle(field_data);
-        auto portal = field_data.ReadPortal();
-
-        for(int i = 0; i < size; i++)
+        vtkm::IdComponent i0, i1;
+        vtkm::exec::CellEdgeLocalIndex(num_points, 0, e, shape, i0);
+        vtkm::exec::CellEdgeLocalIndex(num_points, 1, e, shape, i1);
+        const vtkm::Float64 d0 = this->Distance(points[i0]);
+        const vtkm::Float64 d1 = this->Distance(points[i1]);
+        if((d0 < iso) == (d1 < iso))
         {
-          data.push_back(portal.Get(i));
+          continue;
         }
+        const vtkm::Float64 t = (iso - d0) / (d1 - d0);
+        const vtkm::Float64 v0 = values[i0];
+        const vtkm::Float64 v1 = values[i1];
+        this->AddValue(level, v0 + t * (v1 - v0), hist);
       }
     }
   }
-  //else
-    //cerr << "VTKH Data is empty" << endl;
-  return data;
-}
+}; //class SlicePointHistograms
+
+//
+// Cell fields are constant over the slice polygon, so each
+// intersected cell adds its value once per plane
+//
+class SliceCellHistograms : public vtkm::worklet::WorkletVisitCellsWithPoints,
+                            public SliceHistogramBase
+{
+public:
+  using SliceHistogramBase::SliceHistogramBase;
+
+  typedef void ControlSignature(CellSetIn,
+                                FieldInPoint,
+                                FieldInCell,
+                                WholeArrayIn,
+                                AtomicArrayInOut);
+  typedef void ExecutionSignature(PointCount, _2, _3, _4, _5);
+
+  template<typename PointVecType,
+           typename LevelPortal,
+           typename HistPortal>
+  VTKM_EXEC
+  void operator()(const vtkm::IdComponent &num_points,
+                  const PointVecType &points,
+                  const vtkm::Float64 &value,
+                  const LevelPortal &levels,
+                  const HistPortal &hist) const
+  {
+    vtkm::Float64 dmin = vtkm::Infinity64();
+    vtkm::Float64 dmax = vtkm::NegativeInfinity64();
+    for(vtkm::IdComponent i = 0; i < num_points; ++i)
+    {
+      const vtkm::Float64 d = this->Distance(points[i]);
+      dmin = vtkm::Min(dmin, d);
+      dmax = vtkm::Max(dmax, d);
+    }
 
-template< typename T >
-T calcEntropyMM( const std::vector<T> array, long len, int nBins , T field_min, T field_max)
+    for(vtkm::Id level = 0; level < m_num_levels; ++level)
+    {
+      const vtkm::Float64 iso = levels.Get(level);
+      if(iso >= dmin && iso <= dmax && dmin < dmax)
+      {
+        this->AddValue(level, value, hist);
+      }
+    }
+  }
+}; //class SliceCellHistograms
+
+//
+// fills one histogram of nBins per level with the field values on the
+// planes through the given points, summed over all domains and ranks
+//
+std::vector<vtkm::Id>
+SliceHistograms(vtkh::DataSet &input,
+                const std::string &field_name,
+                const std::vector<vtkm::Vec<vtkm::Float32,3>> &points,
+                const vtkm::Vec<vtkm::Float32,3> &normal,
+                const int nBins)
 {
-  T min = field_min;
-  T max = field_max;
+  const vtkm::Id num_levels = static_cast<vtkm::Id>(points.size());
+  const vtkm::Range range = input.GetGlobalRange(field_name).ReadPortal().Get(0);
 
-  T stepSize = (max-min) / (T)nBins;
-  if(stepSize == 0)
-    return 0.0;
+  vtkm::Vec<vtkm::Float32,3> unit_normal = normal;
+  vtkm::Normalize(unit_normal);
+  std::vector<vtkm::Float64> level_values(num_levels);
+  for(vtkm::Id i = 0; i < num_levels; ++i)
+  {
+    level_values[i] = vtkm::Float64(points[i][0]) * unit_normal[0] +
+                      vtkm::Float64(points[i][1]) * unit_normal[1] +
+                      vtkm::Float64(points[i][2]) * unit_normal[2];
+  }
+  vtkm::cont::ArrayHandle<vtkm::Float64> levels =
+    vtkm::cont::make_ArrayHandle(level_values, vtkm::CopyFlag::On);
 
-  long* hist = new long[ nBins ];
-  for(int i = 0; i < nBins; i++ )
-    hist[i] = 0;
+  vtkm::cont::ArrayHandle<vtkm::Id> hist;
+  vtkm::cont::ArrayCopy(
+    vtkm::cont::ArrayHandleConstant<vtkm::Id>(0, num_levels * nBins), hist);
 
-  for(long i = 0; i < len; i++ )
+  vtkm::cont::Invoker invoke;
+  const int num_domains = input.GetNumberOfDomains();
+  for(int i = 0; i < num_domains; ++i)
   {
-    T idx = (std::abs(array[i]) - min) / stepSize;
-    if((int)idx == nBins )
-      idx -= 1.0;
-    hist[(int)idx]++;
+    vtkm::cont::DataSet &dom = input.GetDomain(i);
+    if(!dom.HasField(field_name) || dom.GetNumberOfCells() == 0)
+    {
+      continue;
+    }
+    const vtkm::cont::Field &field = dom.GetField(field_name);
+    vtkm::cont::ArrayHandle<vtkm::Float64> values;
+    vtkm::cont::ArrayCopyShallowIfPossible(field.GetData(), values);
+
+    if(field.IsFieldPoint())
+    {
+      invoke(SlicePointHistograms(normal, num_levels, nBins, range),
+             dom.GetCellSet(),
+             dom.GetCoordinateSystem().GetData(),
+             values,
+             levels,
+             hist);
+    }
+    else if(field.IsFieldCell())
+    {
+      invoke(SliceCellHistograms(normal, num_levels, nBins, range),
+             dom.GetCellSet(),
+             dom.GetCoordinateSystem().GetData(),
+             values,
+             levels,
+             hist);
+    }
   }
 
-  T entropy = 0.0;
-  for(int i = 0; i < nBins; i++ )
+  std::vector<vtkm::Id> counts(num_levels * nBins);
+  auto portal = hist.ReadPortal();
+  for(vtkm::Id i = 0; i < num_levels * nBins; ++i)
   {
-    T prob = (T)hist[i] / (T)len;
-    if(prob != 0.0 )
-      entropy += prob * std::log( prob );
+    counts[i] = portal.Get(i);
   }
 
-  delete[] hist;
+#ifdef VTKH_PARALLEL
+  std::vector<long long> local(counts.begin(), counts.end());
+  std::vector<long long> global(counts.size());
+  MPI_Comm mpi_comm = MPI_Comm_f2c(vtkh::GetMPICommHandle());
+  MPI_Allreduce(local.data(),
+                global.data(),
+                static_cast<int>(local.size()),
+                MPI_LONG_LONG,
+                MPI_SUM,
+                mpi_comm);
+  counts.assign(global.begin(), global.end());
+#endif
 
-  return (entropy * -1.0);
+  return counts;
 }
 
+double
+Entropy(const vtkm::Id *hist, const int nBins)
+{
+  vtkm::Id len = 0;
+  for(int i = 0; i < nBins; ++i)
+  {
+    len += hist[i];
+  }
+  if(len == 0)
+  {
+    return 0.0;
+  }
+
+  double entropy = 0.0;
+  for(int i = 0; i < nBins; ++i)
+  {
+    double prob = (double)hist[i] / (double)len;
+    if(prob != 0.0)
+      entropy += prob * std::log(prob);
+  }
+  return (entropy * -1.0);
+}
 
 } // namespace detail
 
@@ -630,81 +830,72 @@ AutoSliceLevels::DoExecute()
   const int num_domains = this->m_input->GetNumberOfDomains();
   const int num_slices = this->m_levels;
   std::string field = this->m_field_name;
-  float current_score = -1;
-  float winning_score = -1;
+  const int num_bins = 256;
 
   if(num_slices == 0)
   {
     throw Error("AutoSliceLevels: no slice planes specified");
   }
-   
-  std::vector<float> field_data = vtkh::detail::GetScalarData<float>(*this->m_input, field.c_str());
 
-  float datafield_max = 0.;
-  float datafield_min = 0.;
-
-#if ASCENT_MPI_ENABLED
-
-  float local_datafield_max = 0.;
-  float local_datafield_min = 0.;
-
-  if(field_data.size())
-  { 
-    local_datafield_max = (float)*max_element(field_data.begin(),field_data.end());
-    local_datafield_min = (float)*min_element(field_data.begin(),field_data.end());
-  }
-  MPI_Reduce(&local_datafield_max, &datafield_max, 1, MPI_FLOAT, MPI_MAX, 0, MPI_COMM_WORLD);
-  MPI_Reduce(&local_datafield_min, &datafield_min, 1, MPI_FLOAT, MPI_MIN, 0, MPI_COMM_WORLD);
-
-#else
-
-  if(field_data.size())
-  { 
-    datafield_max = (float)*max_element(field_data.begin(),field_data.end());
-    datafield_min = (float)*min_element(field_data.begin(),field_data.end());
+  if(!this->m_input->GlobalFieldExists(field))
+  {
+    throw Error("AutoSliceLevels: field '" + field + "' does not exist");
   }
 
-#endif
-
   vtkm::Bounds bounds = this->m_input->GetGlobalBounds();
   vtkm::Vec<vtkm::Float32,3> normal = m_normals[0];
- 
+
+  std::vector<vtkm::Vec<vtkm::Float32,3>> points;
   for(int s = 0; s < num_slices; ++s)
   {
-    vtkm::Vec<vtkm::Float32,3> point = GetPoint(s, num_slices, bounds);
-    vtkh::DataSet temp_ds = *(this->m_input);
-    // shallow copy the input so we don't propagate the slice field
-    // to the input data set, since it might be used in other places
-    for(int i = 0; i < num_domains; ++i)
-    {
-      vtkm::cont::DataSet &dom = temp_ds.GetDomain(i);
-
-      vtkm::cont::ArrayHandle<vtkm::Float32> slice_field;
-      vtkm::worklet::DispatcherMapField<detail::SliceField>(detail::SliceField(point, normal))
-        .Invoke(dom.GetCoordinateSystem().GetData(), slice_field);
-
-      dom.AddField(vtkm::cont::Field(fname,
-                                      vtkm::cont::Field::Association::Points,
-                                      slice_field));
-    } // each domain
+    points.push_back(GetPoint(s, num_slices, bounds));
+  }
 
-    vtkh::MarchingCubes marcher;
-    marcher.SetInput(&temp_ds);
-    marcher.SetIsoValue(0.);
-    marcher.SetField(fname);
-    marcher.Update();
-    
-    vtkh::DataSet* output = marcher.GetOutput();
-    std::vector<float> slice_data = vtkh::detail::GetScalarData<float>(*output, field.c_str());
-    current_score = vtkh::detail::calcEntropyMM<float>(slice_data, slice_data.size(), 256, datafield_min, datafield_max);
-    
+  // score every candidate plane in one pass over the cells, the
+  // histograms are summed over all ranks so every rank picks the
+  // same winner
+  std::vector<vtkm::Id> hist = detail::SliceHistograms(*this->m_input,
+                                                       field,
+                                                       points,
+                                                       normal,
+                                                       num_bins);
+  int winner = 0;
+  double winning_score = -1;
+  for(int s = 0; s < num_slices; ++s)
+  {
+    double current_score = detail::Entropy(&hist[s * num_bins], num_bins);
     if(current_score > winning_score)
     {
       winning_score = current_score;
-      this->m_output = output;
+      winner = s;
     }
-  } // each slice
-  
+  }
+
+  // only extract the geometry of the winning plane
+  vtkm::Vec<vtkm::Float32,3> point = points[winner];
+  vtkh::DataSet temp_ds = *(this->m_input);
+  // shallow copy the input so we don't propagate the slice field
+  // to the input data set, since it might be used in other places
+  for(int i = 0; i < num_domains; ++i)
+  {
+    vtkm::cont::DataSet &dom = temp_ds.GetDomain(i);
+
+    vtkm::cont::ArrayHandle<vtkm::Float32> slice_field;
+    vtkm::worklet::DispatcherMapField<detail::SliceField>(detail::SliceField(point, normal))
+      .Invoke(dom.GetCoordinateSystem().GetData(), slice_field);
+
+    dom.AddField(vtkm::cont::Field(fname,
+                                    vtkm::cont::Field::Association::Points,
+                                    slice_field));
+  } // each domain
+
+  vtkh::MarchingCubes marcher;
+  marcher.SetInput(&temp_ds);
+  marcher.SetIsoValue(0.);
+  marcher.SetField(fname);
+  marcher.Update();
+  this->m_output = marcher.GetOutput();
+
   //TODO: needed for setting camera based on input normal
   //if(normal[0] == 1 && normal[1] == 1 &&  normal[2] == 1)
   //{
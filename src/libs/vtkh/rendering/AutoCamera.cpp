@@ -2,6 +2,7 @@
 #include "vtkh/rendering/ScalarRenderer.hpp"
 #include <vtkh/Error.hpp>
 
+#include <algorithm>
 #include <math.h>
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -614,7 +615,12 @@ calculateDiameter(vtkm::Bounds bounds, double &diameter)
 AutoCamera::AutoCamera()
   : m_bins(256),
     m_height(1024),
-    m_width(1024)
+    m_width(1024),
+    m_coarse_factor(1),
+    m_top_k(3),
+    m_seed_sample(-1),
+    m_winning_sample(-1),
+    m_winning_score(-1.)
 {
 
 }
@@ -696,6 +702,48 @@ AutoCamera::GetWidth()
   return m_width;
 }
 
+void
+AutoCamera::SetCoarseFactor(int factor)
+{
+  m_coarse_factor = factor;
+}
+
+int
+AutoCamera::GetCoarseFactor()
+{
+  return m_coarse_factor;
+}
+
+void
+AutoCamera::SetTopK(int top_k)
+{
+  m_top_k = top_k;
+}
+
+int
+AutoCamera::GetTopK()
+{
+  return m_top_k;
+}
+
+void
+AutoCamera::SetSeedSample(int sample)
+{
+  m_seed_sample = sample;
+}
+
+int
+AutoCamera::GetWinningSample()
+{
+  return m_winning_sample;
+}
+
+double
+AutoCamera::GetWinningScore()
+{
+  return m_winning_score;
+}
+
 vtkmCamera
 AutoCamera::GetCamera()
 {
@@ -708,83 +756,128 @@ AutoCamera::PreExecute()
   Filter::PreExecute();
 }
 
+void
+AutoCamera::ScoreSamples(const std::vector<int> &samples,
+                         const int width,
+                         const int height,
+                         vtkmCamera &camera,
+                         float *focus,
+                         double diameter,
+                         vtkm::Range field_range,
+                         std::vector<double> &scores)
+{
+  // bound the memory held by the images of a batch
+  const long long max_batch_pixels = 16ll * 1024ll * 1024ll;
+  const long long image_pixels = static_cast<long long>(width) * height;
+  const int batch_size = static_cast<int>(std::max(1ll, max_batch_pixels / image_pixels));
+
+  const int num_samples = static_cast<int>(samples.size());
+  scores.resize(num_samples);
+  for(int batch_start = 0; batch_start < num_samples; batch_start += batch_size)
+  {
+    const int batch_end = std::min(num_samples, batch_start + batch_size);
+
+    std::vector<vtkmCamera> cameras;
+    for(int i = batch_start; i < batch_end; ++i)
+    {
+      double cam_pos[3];
+      detail::GetCamera(samples[i], m_samples, diameter, focus, cam_pos);
+      vtkm::Vec<vtkm::Float64, 3> pos{cam_pos[0],
+                                      cam_pos[1],
+                                      cam_pos[2]};
+      camera.SetPosition(pos);
+      cameras.push_back(camera);
+    }
+
+    // one scene setup for every view in the batch
+    vtkh::ScalarRenderer tracer;
+    tracer.SetWidth(width);
+    tracer.SetHeight(height);
+    tracer.SetInput(this->m_input);
+    tracer.SetCameras(cameras);
+    tracer.Update();
+
+    std::vector<vtkh::DataSet*> outputs = tracer.GetOutputs();
+    for(int i = batch_start; i < batch_end; ++i)
+    {
+      vtkh::DataSet *output = outputs[i - batch_start];
+      scores[i] = detail::calculateMetricScore(output, m_metric, m_field,
+                                               field_range.Min, field_range.Max,
+                                               diameter, m_bins);
+      delete output;
+    }
+  }
+}
+
 void
 AutoCamera::DoExecute()
 {
-
-  int rank = 0;
-  int world_size = 0;
-  #if VTKH_PARALLEL
-  MPI_Comm mpi_comm = MPI_Comm_f2c(vtkh::GetMPICommHandle());
-  MPI_Comm_size(mpi_comm, &world_size);
-  MPI_Comm_rank(mpi_comm, &rank);
-  #endif
-  
   vtkm::Range range = this->m_input->GetGlobalRange(m_field).ReadPortal().Get(0);
-  vtkm::Float64 field_min = range.Min;
-  vtkm::Float64 field_max = range.Max;
 
   vtkm::Bounds g_bounds = this->m_input->GetGlobalBounds();
   double diameter = 0.0;
   detail::calculateDiameter(g_bounds, diameter);
 
-  vtkmCamera *camera = new vtkmCamera;
-  camera->ResetToBounds(g_bounds);
-  vtkm::Vec<vtkm::Float32,3> lookat = camera->GetLookAt();
+  vtkmCamera camera;
+  camera.ResetToBounds(g_bounds);
+  vtkm::Vec<vtkm::Float32,3> lookat = camera.GetLookAt();
   float focus[3] = {lookat[0],lookat[1],lookat[2]};
 
-  double winning_score  = -1;
-  double losing_score   = 10000;
-  int   winning_sample = -1;
-  int   losing_sample  = -1;
-
-  int count = 0;
-
-  //loop through number of camera samples.
-  for(int sample = 0; sample < m_samples; sample++)
+  std::vector<int> candidates;
+  for(int sample = 0; sample < m_samples; ++sample)
   {
-  /*================ Scalar Renderer Code ======================*/
-
-    double cam_pos[3];
-    detail::GetCamera(sample, m_samples, diameter, focus, cam_pos);
-    vtkm::Vec<vtkm::Float64, 3> pos{cam_pos[0],
-                            cam_pos[1],
-                            cam_pos[2]};
-
-    camera->SetPosition(pos);
-    vtkh::ScalarRenderer tracer;
-    tracer.SetWidth(m_width);
-    tracer.SetHeight(m_height);
-    tracer.SetInput(this->m_input); //vtkh dataset by toponame
-    tracer.SetCamera(*camera);
-    tracer.Update();
-
-    vtkh::DataSet *output = tracer.GetOutput();
-    //output->PrintSummary(std::cerr);
-
-    double score = detail::calculateMetricScore(output, m_metric, m_field, 
-						field_min, field_max, diameter, 
-						m_bins);
-    
-    //std::cerr << "sample " << sample << " score: " << score << std::endl;
-
-    delete output;
+    candidates.push_back(sample);
+  }
 
-  /*================ End Scalar Renderer  ======================*/
+  std::vector<double> scores;
+  const int coarse_factor = std::max(1, m_coarse_factor);
+  const int top_k = std::max(1, m_top_k);
+  if(coarse_factor > 1 && m_samples > top_k)
+  {
+    // rank every view at a coarse resolution and only
+    // render the best few at full resolution
+    const int coarse_width = std::max(1, m_width / coarse_factor);
+    const int coarse_height = std::max(1, m_height / coarse_factor);
+    ScoreSamples(candidates, coarse_width, coarse_height,
+                 camera, focus, diameter, range, scores);
+
+    std::vector<int> order(candidates.size());
+    for(size_t i = 0; i < order.size(); ++i)
+    {
+      order[i] = static_cast<int>(i);
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&scores](int a, int b) { return scores[a] > scores[b]; });
 
-    //original
-    if(winning_score < score)
+    std::vector<int> refine;
+    for(int i = 0; i < top_k; ++i)
+    {
+      refine.push_back(candidates[order[i]]);
+    }
+    // the previous winner always competes at full resolution
+    if(m_seed_sample >= 0 && m_seed_sample < m_samples &&
+       std::find(refine.begin(), refine.end(), m_seed_sample) == refine.end())
     {
-      winning_score = score;
-      winning_sample = sample;
+      refine.push_back(m_seed_sample);
     }
-    if(losing_score > score)
+    // keep the tie breaking of the exhaustive search
+    std::sort(refine.begin(), refine.end());
+    candidates = refine;
+  }
+
+  ScoreSamples(candidates, m_width, m_height,
+               camera, focus, diameter, range, scores);
+
+  double winning_score  = -1;
+  int   winning_sample = -1;
+  for(size_t i = 0; i < candidates.size(); ++i)
+  {
+    if(winning_score < scores[i])
     {
-      losing_score = score;
-      losing_sample = sample;
+      winning_score = scores[i];
+      winning_sample = candidates[i];
     }
-    count++;
-  } //end of sample loop
+  }
 
   if(winning_sample == -1)
   {
@@ -792,17 +885,17 @@ AutoCamera::DoExecute()
     msg<<"Something went terribly wrong; No camera position was chosen\n";
     throw Error(msg.str());
   }
-
-  //std::cerr << "winner is sample " << winning_sample << " with score: " << winning_score << std::endl;
+  m_winning_sample = winning_sample;
+  m_winning_score = winning_score;
 
   double best_c[3];
   detail::GetCamera(winning_sample, m_samples, diameter, focus, best_c);
 
-  vtkm::Vec<vtkm::Float64, 3> pos{best_c[0], 
-				best_c[1], 
-				best_c[2]}; 
-  camera->SetPosition(pos);
-  m_camera = *camera;
+  vtkm::Vec<vtkm::Float64, 3> pos{best_c[0],
+                                  best_c[1],
+                                  best_c[2]};
+  camera.SetPosition(pos);
+  m_camera = camera;
 
   this->m_output = this->m_input;
 }
@@ -7,6 +7,8 @@
 #include <vtkh/DataSet.hpp>
 #include <vtkm/rendering/Camera.h>
 
+#include <vector>
+
 
 namespace vtkh
 {
@@ -26,6 +28,12 @@ public:
   int GetNumBins();
   int GetHeight();
   int GetWidth();
+  int GetCoarseFactor();
+  int GetTopK();
+  // sample index of the chosen camera
+  int GetWinningSample();
+  // metric score of the chosen camera at full resolution
+  double GetWinningScore();
 
   vtkmCamera GetCamera();
 
@@ -35,15 +43,36 @@ public:
   void SetNumBins(int bins);
   void SetHeight(int height);
   void SetWidth(int width);
-  
+  // > 1 enables the progressive search: every sample is scored at
+  // width / factor x height / factor and only the best top_k are
+  // scored again at full resolution.
+  void SetCoarseFactor(int factor);
+  void SetTopK(int top_k);
+  // sample that is always scored at full resolution, e.g. the
+  // winner of the previous cycle (-1 for none)
+  void SetSeedSample(int sample);
+
 protected:
   void PreExecute() override;
   void PostExecute() override;
   void DoExecute() override;
+  void ScoreSamples(const std::vector<int> &samples,
+                    const int width,
+                    const int height,
+                    vtkmCamera &camera,
+                    float *focus,
+                    double diameter,
+                    vtkm::Range field_range,
+                    std::vector<double> &scores);
   int m_bins;
   int m_height;
   int m_width;
   int m_samples;
+  int m_coarse_factor;
+  int m_top_k;
+  int m_seed_sample;
+  int m_winning_sample;
+  double m_winning_score;
   std::string m_field;
   std::string m_metric;
   vtkmCamera m_camera;
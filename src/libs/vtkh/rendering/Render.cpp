@@ -1,11 +1,15 @@
 #include "Render.hpp"
 #include <vtkh/rendering/Annotator.hpp>
-#include <png_utils/ascent_png_encoder.hpp>
+#include <png_utils/ascent_png_writer.hpp>
 #include <vtkh/utils/vtkm_array_utils.hpp>
 #include <vtkm/rendering/MapperRayTracer.h>
 #include <vtkm/rendering/View2D.h>
 #include <vtkm/rendering/View3D.h>
 
+#ifdef VTKH_PARALLEL
+#include <mpi.h>
+#endif
+
 namespace vtkh
 {
 
@@ -295,18 +299,51 @@ Render::CreateCanvas() const
 
 void
 Render::Save()
+{
+  Save(0);
+}
+
+void
+Render::Save(int writer_rank)
 {
   // After rendering and compositing
   // Rank 0 contains the complete image.
+  int height = m_canvas.GetHeight();
+  int width = m_canvas.GetWidth();
 #ifdef VTKH_PARALLEL
-  if(vtkh::GetMPIRank() != 0) return;
+  const int rank = vtkh::GetMPIRank();
+  if(writer_rank != 0 && writer_rank < vtkh::GetMPISize())
+  {
+    if(rank != 0 && rank != writer_rank) return;
+
+    MPI_Comm comm = MPI_Comm_f2c(vtkh::GetMPICommHandle());
+    const int size = width * height * 4;
+    std::vector<unsigned char> rgba(size);
+    if(rank == 0)
+    {
+      // convert before sending, this is a quarter of the size
+      // and matches what the encoder does
+      const float* color_buffer = &GetVTKMPointer(m_canvas.GetColorBuffer())[0][0];
+#ifdef VTKH_OPENMP_ENABLED
+      #pragma omp parallel for
+#endif
+      for(int i = 0; i < size; ++i)
+      {
+        rgba[i] = (unsigned char)(color_buffer[i] * 255.f);
+      }
+      MPI_Send(&rgba[0], size, MPI_UNSIGNED_CHAR, writer_rank, 0, comm);
+    }
+    else
+    {
+      MPI_Recv(&rgba[0], size, MPI_UNSIGNED_CHAR, 0, 0, comm, MPI_STATUS_IGNORE);
+      ascent::PNGWriter::Write(rgba, width, height, m_image_name + ".png", m_comments);
+    }
+    return;
+  }
+  if(rank != 0) return;
 #endif
   float* color_buffer = &GetVTKMPointer(m_canvas.GetColorBuffer())[0][0];
-  int height = m_canvas.GetHeight();
-  int width = m_canvas.GetWidth();
-  ascent::PNGEncoder encoder;
-  encoder.Encode(color_buffer, width, height, m_comments);
-  encoder.Save(m_image_name + ".png");
+  ascent::PNGWriter::Write(color_buffer, width, height, m_image_name + ".png", m_comments);
 }
 
 vtkh::Render
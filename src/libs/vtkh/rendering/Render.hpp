@@ -60,6 +60,9 @@ public:
                                                           const std::vector<vtkm::Range> &ranges,
                                                           const std::vector<vtkm::cont::ColorTable> &colors);
   void                            Save();
+  // rank 0 holds the composited image, if writer_rank is another
+  // rank the image is sent there to be encoded and written
+  void                            Save(int writer_rank);
 protected:
   vtkm::rendering::Camera      m_camera;
   std::string                  m_image_name;
@@ -131,6 +131,8 @@ void
 Renderer::PreExecute()
 {
   bool range_set = m_range.IsNonEmpty();
+  // one round of communication for all of the global queries below
+  m_input->UpdateGlobalMetadata({m_field_name});
   Filter::CheckForRequiredField(m_field_name);
 
   if(!range_set)
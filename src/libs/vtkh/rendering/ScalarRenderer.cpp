@@ -75,6 +75,18 @@ ScalarRenderer::SetCamera(vtkmCamera &camera)
   m_camera = camera;
 }
 
+void
+ScalarRenderer::SetCameras(const std::vector<vtkmCamera> &cameras)
+{
+  m_cameras = cameras;
+}
+
+std::vector<DataSet*>
+ScalarRenderer::GetOutputs()
+{
+  return m_outputs;
+}
+
 void
 ScalarRenderer::PreExecute()
 {
@@ -105,7 +117,6 @@ ScalarRenderer::DoExecute()
 {
 
   int num_domains = static_cast<int>(m_input->GetNumberOfDomains());
-  this->m_output = new DataSet();
 
   //
   // There external faces + bvh construction happens
@@ -135,6 +146,28 @@ ScalarRenderer::DoExecute()
     cell_counts.push_back(data_set.GetCellSet().GetNumberOfCells());
   }
 
+  // the renderers are set up once and shared by all of the cameras
+  std::vector<vtkmCamera> cameras = m_cameras;
+  if(cameras.empty())
+  {
+    cameras.push_back(m_camera);
+  }
+
+  m_outputs.clear();
+  for(size_t i = 0; i < cameras.size(); ++i)
+  {
+    m_outputs.push_back(RenderCamera(renderers, cameras[i]));
+  }
+  this->m_output = m_outputs[0];
+}
+
+DataSet *
+ScalarRenderer::RenderCamera(std::vector<vtkm::rendering::ScalarRenderer> &renderers,
+                             vtkmCamera &camera)
+{
+  int num_domains = static_cast<int>(m_input->GetNumberOfDomains());
+  DataSet *output = new DataSet();
+
   // basic sanity checking
   int min_p = std::numeric_limits<int>::max();
   int max_p = std::numeric_limits<int>::min();
@@ -161,7 +194,7 @@ ScalarRenderer::DoExecute()
     {
       no_data = num_cells == 0;
 
-      Result res = renderers[dom].Render(m_camera);
+      Result res = renderers[dom].Render(camera);
 
       field_names = res.ScalarNames;
       PayloadImage *pimage = Convert(res);
@@ -269,11 +302,11 @@ ScalarRenderer::DoExecute()
       {
         vtkm::cont::DataSet dset = final_result.ToDataSet();
         const int domain_id = 0;
-        this->m_output->AddDomain(dset, domain_id);
+        output->AddDomain(dset, domain_id);
       }
     }
   }
-
+  return output;
 }
 
 ScalarRenderer::Result
@@ -25,6 +25,12 @@ public:
   virtual std::string GetName() const override;
 
   void SetCamera(vtkmCamera &camera);
+  // renders an image for each camera, replacing the single camera.
+  // The scene is only set up once for all of them.
+  void SetCameras(const std::vector<vtkmCamera> &cameras);
+  // one output per camera, in order. The first is also GetOutput(),
+  // and the caller owns all of them.
+  std::vector<DataSet*> GetOutputs();
 
   int GetNumberOfCameras() const;
   vtkh::DataSet *GetInput();
@@ -36,11 +42,15 @@ protected:
   int m_height;
   // image related data with cinema support
   vtkmCamera  m_camera;
+  std::vector<vtkmCamera> m_cameras;
+  std::vector<DataSet*>   m_outputs;
   // methods
   virtual void PreExecute() override;
   virtual void PostExecute() override;
   virtual void DoExecute() override;
 
+  DataSet * RenderCamera(std::vector<vtkm::rendering::ScalarRenderer> &renderers,
+                         vtkmCamera &camera);
   PayloadImage * Convert(Result &result);
   ScalarRenderer::Result Convert(PayloadImage &image, std::vector<std::string> &names);
   //void ImageToDataSet(Image &image, vtkm::rendering::Canvas &canvas, bool get_depth);
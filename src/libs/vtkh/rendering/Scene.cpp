@@ -2,6 +2,7 @@
 #include <vtkh/rendering/MeshRenderer.hpp>
 #include <vtkh/rendering/VolumeRenderer.hpp>
 #include <vtkh/utils/vtkm_array_utils.hpp>
+#include <png_utils/ascent_png_writer.hpp>
 
 #ifdef VTKH_PARALLEL
 #include <mpi.h>
@@ -138,6 +139,8 @@ Scene::Render()
   // are limited.
   //
   const int render_size = m_renders.size();
+  const bool distribute_writes = render_size > 1 &&
+                                 ascent::PNGWriter::Distributed();
   int batch_start = 0;
   while(batch_start < render_size)
   {
@@ -234,7 +237,14 @@ Scene::Render()
       current_batch[i].RenderWorldAnnotations();
       current_batch[i].RenderScreenAnnotations(field_names, ranges, color_tables);
       current_batch[i].RenderBackground();
-      current_batch[i].Save();
+      // spread the encoding of multi-image scenes (e.g. cinema)
+      // over the ranks
+      int writer_rank = 0;
+      if(distribute_writes)
+      {
+        writer_rank = (batch_start + i) % vtkh::GetMPISize();
+      }
+      current_batch[i].Save(writer_rank);
     }
 
     batch_start = batch_end;
@@ -0,0 +1,174 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_apcomp_partial_sort.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <apcomp/apcomp.hpp>
+#include <apcomp/internal/apcomp_partial_sort.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+using namespace std;
+
+//-----------------------------------------------------------------------------
+// random partials with many ties in pixel id and depth, negative depths,
+// and the original position stored in the color to check stability
+std::vector<apcomp::VolumePartial<float>>
+random_volume_partials(const int size, const int num_pixels, const unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> pixel_dist(0, num_pixels - 1);
+  // steps of 0.25 in [-8,8] so the same depths show up often
+  std::uniform_int_distribution<int> depth_dist(-32, 32);
+  std::vector<apcomp::VolumePartial<float>> partials(size);
+  for(int i = 0; i < size; ++i)
+  {
+    partials[i].m_pixel_id = pixel_dist(gen);
+    partials[i].m_depth = depth_dist(gen) * 0.25f;
+    partials[i].m_pixel[0] = static_cast<float>(i);
+    partials[i].m_alpha = 0.5f;
+  }
+  // 0 * 0.25 is +0, add a few large values as well
+  if(size > 2)
+  {
+    partials[0].m_depth = 1e30f;
+    partials[1].m_depth = -1e30f;
+  }
+  return partials;
+}
+
+//-----------------------------------------------------------------------------
+TEST(apcomp_partial_sort, volume_partials_match_std_sort)
+{
+  // sizes around the thread chunk boundaries
+  for(int size : {0, 1, 2, 17, 1000, 65537})
+  {
+    std::vector<apcomp::VolumePartial<float>> partials
+      = random_volume_partials(size, 300, 12345u + size);
+    std::vector<apcomp::VolumePartial<float>> expected = partials;
+    std::stable_sort(expected.begin(), expected.end());
+
+    apcomp::detail::radix_sort_partials(partials);
+
+    ASSERT_EQ(partials.size(), expected.size());
+    for(int i = 0; i < size; ++i)
+    {
+      EXPECT_EQ(partials[i].m_pixel_id, expected[i].m_pixel_id);
+      EXPECT_EQ(partials[i].m_depth, expected[i].m_depth);
+      // ties keep their input order
+      EXPECT_EQ(partials[i].m_pixel[0], expected[i].m_pixel[0]);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(apcomp_partial_sort, pixel_ids_above_byte_range)
+{
+  // pixel ids that differ only in the high bytes
+  std::vector<apcomp::VolumePartial<float>> partials(6);
+  const int ids[6] = {1 << 24, 5, 1 << 16, 1 << 8, 0, (1 << 24) + 1};
+  for(int i = 0; i < 6; ++i)
+  {
+    partials[i].m_pixel_id = ids[i];
+    partials[i].m_depth = -static_cast<float>(i);
+  }
+  std::vector<apcomp::VolumePartial<float>> expected = partials;
+  std::stable_sort(expected.begin(), expected.end());
+
+  apcomp::detail::radix_sort_partials(partials);
+  for(int i = 0; i < 6; ++i)
+  {
+    EXPECT_EQ(partials[i].m_pixel_id, expected[i].m_pixel_id);
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(apcomp_partial_sort, signed_zero_depths_tie)
+{
+  // -0 and +0 are equal depths, so they keep their input order
+  std::vector<apcomp::VolumePartial<float>> partials(6);
+  const float depths[6] = {0.f, -0.f, -0.f, 0.f, -1.f, 1.f};
+  for(int i = 0; i < 6; ++i)
+  {
+    partials[i].m_pixel_id = 3;
+    partials[i].m_depth = depths[i];
+    partials[i].m_pixel[0] = static_cast<float>(i);
+  }
+  std::vector<apcomp::VolumePartial<float>> expected = partials;
+  std::stable_sort(expected.begin(), expected.end());
+
+  apcomp::detail::radix_sort_partials(partials);
+  for(int i = 0; i < 6; ++i)
+  {
+    EXPECT_EQ(partials[i].m_depth, expected[i].m_depth);
+    EXPECT_EQ(partials[i].m_pixel[0], expected[i].m_pixel[0]);
+  }
+  EXPECT_EQ(apcomp::detail::depth_key(-0.), apcomp::detail::depth_key(0.));
+}
+
+//-----------------------------------------------------------------------------
+TEST(apcomp_partial_sort, absorption_partials_ignore_depth)
+{
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> pixel_dist(0, 50);
+  std::uniform_real_distribution<double> depth_dist(-10., 10.);
+  const int size = 5000;
+  std::vector<apcomp::AbsorptionPartial<float>> partials(size);
+  for(int i = 0; i < size; ++i)
+  {
+    partials[i].m_pixel_id = pixel_dist(gen);
+    partials[i].m_depth = depth_dist(gen);
+    partials[i].m_bins.push_back(static_cast<float>(i));
+  }
+  std::vector<apcomp::AbsorptionPartial<float>> expected = partials;
+  std::stable_sort(expected.begin(), expected.end());
+
+  apcomp::detail::radix_sort_partials(partials);
+  for(int i = 0; i < size; ++i)
+  {
+    EXPECT_EQ(partials[i].m_pixel_id, expected[i].m_pixel_id);
+    EXPECT_EQ(partials[i].m_bins[0], expected[i].m_bins[0]);
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(apcomp_partial_sort, flagged_indices)
+{
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> flag_dist(0, 1);
+  for(int size : {0, 1, 3, 1001, 100000})
+  {
+    for(int fill : {-1, 0, 1})
+    {
+      std::vector<unsigned char> flags(size);
+      for(int i = 0; i < size; ++i)
+      {
+        flags[i] = static_cast<unsigned char>(fill < 0 ? flag_dist(gen) : fill);
+      }
+
+      std::vector<int> expected;
+      for(int i = 0; i < size; ++i)
+      {
+        if(flags[i] == 1)
+        {
+          expected.push_back(i);
+        }
+      }
+
+      std::vector<int> indices;
+      apcomp::detail::flagged_indices(flags, indices);
+      EXPECT_EQ(indices, expected);
+    }
+  }
+}
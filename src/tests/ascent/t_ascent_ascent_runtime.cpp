@@ -269,3 +269,116 @@ TEST(ascent_pipeline, test_register_transform)
     EXPECT_TRUE(check_test_image(output_file));
 }
 
+
+//-----------------------------------------------------------------------------
+class MyStateExtract: public ::flow::Filter
+{
+    public:
+        static const DataObject *s_input;
+        static int s_cycle;
+
+        MyStateExtract():Filter()
+        {}
+        ~MyStateExtract()
+        {}
+
+        void declare_interface(Node &i)
+        {
+            i["type_name"]   = "my_state_extract";
+            i["port_names"].append() = "in";
+            i["output_port"] = "true";
+        }
+
+        void execute()
+        {
+            DataObject *data_object = input<DataObject>(0);
+            s_input = data_object;
+            s_cycle = -1;
+            std::shared_ptr<Node> n_data = data_object->as_low_order_bp();
+            if(n_data->number_of_children() > 0 &&
+               n_data->child(0).has_path("state/cycle"))
+            {
+                s_cycle = n_data->child(0)["state/cycle"].to_int32();
+            }
+            set_output(input(0));
+        }
+};
+
+const DataObject *MyStateExtract::s_input = NULL;
+int MyStateExtract::s_cycle = -1;
+
+//-----------------------------------------------------------------------------
+TEST(ascent_pipeline, test_incremental_execution_refreshes_cycle)
+{
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping test");
+        return;
+    }
+
+    AscentRuntime::register_filter_type<MyStateExtract>("extracts",
+                                                        "my_state_extract");
+
+    Node data, info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               10,
+                                               10,
+                                               10,
+                                               data);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,info));
+
+    // mark everything as unchanged between publishes
+    const std::string categories[3] = {"coordsets", "topologies", "fields"};
+    for(int c = 0; c < 3; ++c)
+    {
+        NodeConstIterator itr = data[categories[c]].children();
+        while(itr.has_next())
+        {
+            itr.next();
+            data["state/revisions/" + categories[c] + "/" + itr.name()] = 0;
+        }
+    }
+
+    conduit::Node pipelines;
+    pipelines["pl1/f1/type"] = "contour";
+    pipelines["pl1/f1/params/field"] = "braid";
+    pipelines["pl1/f1/params/iso_values"] = 0.0;
+
+    conduit::Node extracts;
+    extracts["e1/type"]  = "my_state_extract";
+    extracts["e1/pipeline"]  = "pl1";
+
+    conduit::Node actions;
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    add_pipelines["pipelines"] = pipelines;
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    add_extracts["extracts"] = extracts;
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["incremental_execution"] = "true";
+    ascent.open(ascent_opts);
+
+    data["state/cycle"] = 100;
+    ascent.publish(data);
+    ascent.execute(actions);
+    const DataObject *first_result = MyStateExtract::s_input;
+    EXPECT_EQ(MyStateExtract::s_cycle, 100);
+
+    // same data, new cycle: the contour is reused, but
+    // carries the cycle of the current execution
+    data["state/cycle"] = 200;
+    ascent.publish(data);
+    ascent.execute(actions);
+    EXPECT_EQ(MyStateExtract::s_input, first_result);
+    EXPECT_EQ(MyStateExtract::s_cycle, 200);
+
+    ascent.info(info);
+    info.print();
+    ascent.close();
+}
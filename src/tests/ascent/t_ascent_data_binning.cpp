@@ -84,6 +84,23 @@ TEST(ascent_binning, binning_basic_meshes)
             "[4.0, 100.0, 5.0, 100.0, 100.0, 100.0, 100.0, 100.0, 6.0, 100.0, "
             "7.0, 100.0, 100.0, 100.0, 100.0, 100.0]");
 
+  // sparse binning expands to the same dense bins
+  expr =
+      "binning('field', 'max', [axis('x', num_bins=4), axis('y', num_bins=4)], "
+      "empty_bin_val=100, sparse=True)";
+  res = eval.evaluate(expr);
+  EXPECT_EQ(res["attrs/value/value"].to_json(),
+            "[4.0, 100.0, 5.0, 100.0, 100.0, 100.0, 100.0, 100.0, 6.0, 100.0, "
+            "7.0, 100.0, 100.0, 100.0, 100.0, 100.0]");
+
+  // or only holds the occupied bins
+  expr =
+      "binning('field', 'max', [axis('x', num_bins=4), axis('y', num_bins=4)], "
+      "empty_bin_val=100, sparse=True, sparse_output=True)";
+  res = eval.evaluate(expr);
+  EXPECT_EQ(res["attrs/bin_ids/value"].to_json(), "[0, 2, 8, 10]");
+  EXPECT_EQ(res["attrs/value/value"].to_json(), "[4.0, 5.0, 6.0, 7.0]");
+
   expr =
       "binning('field', 'sum', [axis('x', num_bins=2), axis('y', num_bins=2), "
       "axis('z', num_bins=2)])";
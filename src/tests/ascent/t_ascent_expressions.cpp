@@ -14,8 +14,10 @@
 
 #include <ascent_expression_eval.hpp>
 #include <expressions/ascent_blueprint_architect.hpp>
+#include <expressions/ascent_expression_history.hpp>
 #include <runtimes/expressions/ascent_memory_manager.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -402,6 +404,19 @@ TEST(ascent_expressions, functional_correctness)
   EXPECT_EQ(res["value"].to_float64(), 2);
   EXPECT_EQ(res["type"].as_string(), "double");
 
+  expr = "quantile(quantile_sketch(field('ele_example')), 0.5)";
+  res = eval.evaluate(expr);
+  EXPECT_NEAR(res["value"].to_float64(), 7.0, 7.0 * 0.01);
+  EXPECT_EQ(res["type"].as_string(), "double");
+
+  expr = "quantile(quantile_sketch(field('ele_example')), 1.0)";
+  res = eval.evaluate(expr);
+  EXPECT_EQ(res["value"].to_float64(), 15);
+
+  expr = "quantile_sketch(field('ele_example'), relative_accuracy=0.001).count";
+  res = eval.evaluate(expr);
+  EXPECT_EQ(res["value"].to_float64(), 16);
+
   expr = "16.0/256 == avg(histogram(field('ele_example')).value)";
   res = eval.evaluate(expr);
   EXPECT_EQ(res["value"].to_uint8(), 1);
@@ -423,6 +438,108 @@ TEST(ascent_expressions, functional_correctness)
   EXPECT_EQ(res["type"].as_string(), "bool");
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_expressions, quantile_sketch_accuracy)
+{
+  Node n;
+  ascent::about(n);
+
+  //
+  // three domains of a field that spans nine orders of magnitude
+  // with negative values and zeros
+  //
+  const int num_domains = 3;
+  const int dom_elems = 20 * 20;
+  std::vector<double> all_vals;
+  Node multi_dom;
+  unsigned int seed = 12345;
+  for(int d = 0; d < num_domains; ++d)
+  {
+    Node &data = multi_dom.append();
+    data["coordsets/coords/type"] = "uniform";
+    data["coordsets/coords/dims/i"] = 21;
+    data["coordsets/coords/dims/j"] = 21;
+    data["coordsets/coords/origin/x"] = 20.0 * d;
+    data["coordsets/coords/origin/y"] = 0.0;
+    data["topologies/topo/type"] = "uniform";
+    data["topologies/topo/coordset"] = "coords";
+    data["fields/wide/association"] = "element";
+    data["fields/wide/topology"] = "topo";
+    data["fields/wide/values"].set(DataType::float64(dom_elems));
+    float64 *vals = data["fields/wide/values"].value();
+    for(int i = 0; i < dom_elems; ++i)
+    {
+      seed = seed * 1103515245u + 12345u;
+      const double u = double((seed >> 8) % 100000) / 100000.;
+      double val = std::pow(10., -3. + 9. * u);
+      if(i % 5 == 0)
+      {
+        val = -val;
+      }
+      if(i % 37 == 0)
+      {
+        val = 0.;
+      }
+      vals[i] = val;
+      all_vals.push_back(val);
+    }
+    data["state/cycle"] = 100;
+    data["state/domain_id"] = d;
+
+    Node verify_info;
+    EXPECT_TRUE(blueprint::mesh::verify(data, verify_info));
+  }
+
+  std::sort(all_vals.begin(), all_vals.end());
+  const int count = all_vals.size();
+  const double qs[10] = {0., 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 1.};
+  const double accuracies[2] = {0.01, 0.001};
+
+  for(int a = 0; a < 2; ++a)
+  {
+    const double accuracy = accuracies[a];
+    runtime::expressions::clear_quantile_sketch_cache();
+    Node sketch =
+      runtime::expressions::field_quantile_sketch(multi_dom, "wide", accuracy);
+    EXPECT_EQ(sketch["count"].to_int64(), count);
+
+    for(int i = 0; i < 10; ++i)
+    {
+      // the sketch returns the value with rank floor(q * (count - 1))
+      const double exact = all_vals[int(qs[i] * (count - 1))];
+      Node res = runtime::expressions::sketch_quantile(sketch, qs[i]);
+      const double approx = res["value"].to_float64();
+      EXPECT_LE(std::abs(approx - exact), accuracy * std::abs(exact) + 1e-12)
+        << "q " << qs[i] << " accuracy " << accuracy;
+    }
+  }
+
+  // the same through the expression language
+  runtime::expressions::register_builtin();
+  runtime::expressions::clear_quantile_sketch_cache();
+  runtime::expressions::ExpressionEval eval(&multi_dom);
+  const double exact = all_vals[int(0.99 * (count - 1))];
+  Node res = eval.evaluate("quantile(quantile_sketch(field('wide'), "
+                           "relative_accuracy=0.001), 0.99)");
+  EXPECT_LE(std::abs(res["value"].to_float64() - exact),
+            0.001 * std::abs(exact));
+
+  // the cache is keyed on the arrays, so data changed in place is only
+  // seen once the cache is cleared, which the runtime does every execute
+  for(int d = 0; d < num_domains; ++d)
+  {
+    float64 *vals = multi_dom.child(d)["fields/wide/values"].value();
+    for(int i = 0; i < dom_elems; ++i)
+    {
+      vals[i] = 2.0;
+    }
+  }
+  runtime::expressions::clear_quantile_sketch_cache();
+  res = eval.evaluate("quantile(quantile_sketch(field('wide'), "
+                      "relative_accuracy=0.001), 0.99)");
+  EXPECT_NEAR(res["value"].to_float64(), 2.0, 2.0 * 0.001);
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_expressions, expressions_named_params)
 {
@@ -1196,6 +1313,145 @@ TEST(ascent_expressions, if_expressions)
   EXPECT_EQ(threw, true);
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_expressions, reuse_expression_plans)
+{
+  Node n;
+  ascent::about(n);
+
+  //
+  // Create an example mesh.
+  //
+  Node data, verify_info;
+  conduit::blueprint::mesh::examples::braid("hexs",
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            data);
+  // ascent normally adds this but we are doing an end around
+  data["state/domain_id"] = 0;
+  Node multi_dom;
+  blueprint::mesh::to_multi_domain(data, multi_dom);
+
+  runtime::expressions::register_builtin();
+  runtime::expressions::ExpressionEval::reset_plan_cache();
+
+  conduit::Node res;
+  std::string expr = "max(field('braid')).value";
+  double max_val = 0;
+  {
+    runtime::expressions::ExpressionEval eval(&multi_dom);
+    res = eval.evaluate(expr);
+    max_val = res["value"].to_float64();
+    EXPECT_EQ(runtime::expressions::ExpressionEval::plan_cache_hits(), 0);
+    // the second evaluation reuses the plan
+    res = eval.evaluate(expr);
+    EXPECT_EQ(res["value"].to_float64(), max_val);
+    EXPECT_EQ(runtime::expressions::ExpressionEval::plan_cache_hits(), 1);
+  }
+
+  // new values, same schema: the plan is reused with the new data
+  conduit::Node &values = multi_dom.child(0)["fields/braid/values"];
+  float64_array vals = values.value();
+  for(index_t i = 0; i < vals.number_of_elements(); ++i)
+  {
+    vals[i] = vals[i] * 2.0;
+  }
+
+  {
+    runtime::expressions::ExpressionEval eval(&multi_dom);
+    res = eval.evaluate(expr);
+    EXPECT_NEAR(res["value"].to_float64(), max_val * 2.0, 1e-8);
+    EXPECT_EQ(runtime::expressions::ExpressionEval::plan_cache_hits(), 2);
+  }
+
+  // same names, new data type: jitted plans can't be reused
+  {
+    conduit::Node vals32;
+    values.to_float32_array(vals32);
+    values.set(vals32);
+    runtime::expressions::ExpressionEval eval(&multi_dom);
+    res = eval.evaluate(expr);
+    EXPECT_NEAR(res["value"].to_float64(), max_val * 2.0, 1e-4);
+    EXPECT_EQ(runtime::expressions::ExpressionEval::plan_cache_hits(), 2);
+  }
+
+  // failing expressions keep failing on later evaluations
+  for(int i = 0; i < 2; ++i)
+  {
+    runtime::expressions::ExpressionEval eval(&multi_dom);
+    bool threw = false;
+    try
+    {
+      res = eval.evaluate("max(field('bananas'))");
+    }
+    catch(...)
+    {
+      threw = true;
+    }
+    EXPECT_EQ(threw, true);
+  }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_expressions, history_store)
+{
+  string output_path = prepare_output_dir();
+  string history_file =
+    conduit::utils::join_file_path(output_path,
+                                   "tout_history_store.ascent_history");
+  if(conduit::utils::is_file(history_file))
+  {
+    conduit::utils::remove_file(history_file);
+  }
+
+  conduit::Node entry;
+  entry["value"] = 1.0;
+  entry["type"] = "double";
+  entry["time"] = 0.5;
+
+  runtime::expressions::HistoryStore store;
+  store.file_name(history_file);
+  store.append("val/100", entry);
+  store.flush();
+
+  // appending only adds the new records
+  entry["value"] = 2.0;
+  entry["time"] = 1.0;
+  store.append("val/200", entry);
+  conduit::Node vec;
+  vec["value"].set(std::vector<double>({1.0, 2.0, 3.0}));
+  vec["type"] = "vector";
+  store.append("vec/200", vec);
+  store.flush();
+
+  conduit::Node loaded;
+  runtime::expressions::HistoryStore::load(history_file, loaded);
+  EXPECT_EQ(loaded["val"].number_of_children(), 2);
+  EXPECT_EQ(loaded["val/100/value"].to_float64(), 1.0);
+  EXPECT_EQ(loaded["val/200/value"].to_float64(), 2.0);
+  EXPECT_EQ(loaded["vec/200/type"].as_string(), "vector");
+  EXPECT_EQ(loaded["vec/200/value"].dtype().number_of_elements(), 3);
+
+  // rewriting replaces the old contents
+  loaded["val"].remove("200");
+  store.rewrite(loaded);
+  store.flush();
+  conduit::Node rewritten;
+  runtime::expressions::HistoryStore::load(history_file, rewritten);
+  EXPECT_EQ(rewritten["val"].number_of_children(), 1);
+  EXPECT_FALSE(rewritten.has_path("val/200"));
+  EXPECT_TRUE(rewritten.has_path("vec/200"));
+
+  // yaml export
+  string yaml_file =
+    conduit::utils::join_file_path(output_path, "tout_history_store.yaml");
+  runtime::expressions::HistoryStore::convert(history_file, yaml_file);
+  conduit::Node yaml;
+  yaml.load(yaml_file, "yaml");
+  EXPECT_EQ(yaml["val/100/value"].to_float64(), 1.0);
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_expressions, lineout)
 {
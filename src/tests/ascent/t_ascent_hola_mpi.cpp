@@ -164,6 +164,64 @@ TEST(ascent_hola_mpi, test_hola_mpi_helpers)
         EXPECT_EQ(data.number_of_children(),9);
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_hola_mpi, test_hola_mpi_pipelined)
+{
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank = relay::mpi::rank(comm);
+    int rank_split = 5;
+
+    Node opts;
+    opts["mpi_comm"]   = MPI_Comm_c2f(comm);
+    opts["rank_split"] = rank_split;
+    opts["pipelined"]  = "true";
+
+    // the first call sends schemas, the second only data
+    for(int cycle = 0; cycle < 2; cycle++)
+    {
+        Node data;
+        if(rank < rank_split)
+        {
+            hola_mpi_helpers_test_setup_src_data(rank,data);
+            NodeIterator itr = data.children();
+            while(itr.has_next())
+            {
+                itr.next()["cycle"] = cycle;
+            }
+        }
+
+        int num_arrived = 0;
+        hola_mpi(opts,
+                 data,
+                 [&](Node &dom)
+                 {
+                     EXPECT_EQ(dom["cycle"].to_int(), cycle);
+                     num_arrived++;
+                 });
+
+        if(rank < rank_split)
+        {
+            EXPECT_EQ(num_arrived,0);
+            continue;
+        }
+
+        int num_doms = rank == 7 ? 9 : 7;
+        EXPECT_EQ(num_arrived,num_doms);
+        EXPECT_EQ(data.number_of_children(),num_doms);
+        // domains keep their global order
+        if(rank == 5)
+        {
+            EXPECT_EQ(data.child(0)["src_rank"].to_int(),0);
+            EXPECT_EQ(data.child(6)["src_rank"].to_int(),1);
+            EXPECT_EQ(data.child(6)["src_local_domain_id"].to_int(),1);
+        }
+    }
+
+    hola_mpi_finish();
+    MPI_Barrier(comm);
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_hola_mpi, test_hola_mpi)
 {
@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_ascent_mfem_linearize.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <ascent.hpp>
+#include <ascent_mfem_data_adapter.hpp>
+
+#include <iostream>
+#include <math.h>
+
+#include <conduit_blueprint.hpp>
+
+#include "t_config.hpp"
+#include "t_utils.hpp"
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+
+//-----------------------------------------------------------------------------
+double
+node_field(const mfem::Vector &x)
+{
+  double res = 0.0;
+  for(int i = 0; i < x.Size(); ++i)
+  {
+    res += (i + 1) * x(i) + x(i) * x(i);
+  }
+  return res;
+}
+
+//-----------------------------------------------------------------------------
+// a single high order domain whose nodes are scaled and shifted by
+// move, with an H1 and an L2 field of the moved coordinates
+MFEMDomains *
+make_domains(const std::string &mesh_name, const double move)
+{
+  std::string mesh_file = conduit::utils::join_file_path(ASCENT_T_DATA_DIR,
+                                                         mesh_name);
+  mfem::Mesh *mesh = new mfem::Mesh(mesh_file.c_str(), 1, 1);
+  mesh->EnsureNodes();
+  mfem::GridFunction *nodes = mesh->GetNodes();
+  for(int i = 0; i < nodes->Size(); ++i)
+  {
+    (*nodes)(i) = (1.0 + move) * (*nodes)(i) + 0.5 * move;
+  }
+
+  const int dim = mesh->Dimension();
+  mfem::FunctionCoefficient coeff(node_field);
+
+  mfem::FiniteElementCollection *h1_col = new mfem::H1_FECollection(2, dim);
+  mfem::FiniteElementSpace *h1_fes = new mfem::FiniteElementSpace(mesh, h1_col);
+  mfem::GridFunction *h1_gf = new mfem::GridFunction(h1_fes);
+  h1_gf->MakeOwner(h1_col);
+  h1_gf->ProjectCoefficient(coeff);
+
+  mfem::FiniteElementCollection *l2_col = new mfem::L2_FECollection(1, dim);
+  mfem::FiniteElementSpace *l2_fes = new mfem::FiniteElementSpace(mesh, l2_col);
+  mfem::GridFunction *l2_gf = new mfem::GridFunction(l2_fes);
+  l2_gf->MakeOwner(l2_col);
+  l2_gf->ProjectCoefficient(coeff);
+
+  MFEMDataSet *dset = new MFEMDataSet(mesh);
+  dset->add_field(h1_gf, "h1");
+  dset->add_field(l2_gf, "l2");
+
+  MFEMDomains *domains = new MFEMDomains;
+  domains->m_data_sets.push_back(dset);
+  domains->m_domain_ids.push_back(0);
+  return domains;
+}
+
+//-----------------------------------------------------------------------------
+// linearizes the mesh with a cache, moves the nodes and linearizes
+// again through the cached plan. The result must match linearizing
+// the moved mesh from scratch.
+void
+check_cached_linearize(const std::string &mesh_name)
+{
+  const int refinement = 2;
+  MFEMRefinementCache cache;
+
+  MFEMDomains *first = make_domains(mesh_name, 0.0);
+  Node first_out;
+  MFEMDataAdapter::Linearize(first, first_out, refinement, &cache);
+  delete first;
+  EXPECT_EQ(cache.size(), 1);
+
+  MFEMDomains *moved = make_domains(mesh_name, 0.25);
+  Node cached_out;
+  MFEMDataAdapter::Linearize(moved, cached_out, refinement, &cache);
+
+  // the second call reused the plan built by the first one
+  bool reused = false;
+  cache.plan(0, moved->m_data_sets[0]->get_mesh(), refinement, reused);
+  EXPECT_TRUE(reused);
+  delete moved;
+
+  MFEMDomains *fresh = make_domains(mesh_name, 0.25);
+  Node fresh_out;
+  MFEMDataAdapter::Linearize(fresh, fresh_out, refinement);
+  delete fresh;
+
+  Node info;
+  // the coordinates did move
+  EXPECT_TRUE(first_out.child(0)["coordsets"].diff(cached_out.child(0)["coordsets"],
+                                                   info,
+                                                   1e-8));
+  bool differ = cached_out.diff(fresh_out, info, 1e-8);
+  if(differ)
+  {
+    info.print();
+  }
+  EXPECT_FALSE(differ);
+
+  // another refinement level does not reuse the plan
+  MFEMDomains *other = make_domains(mesh_name, 0.25);
+  cache.plan(0, other->m_data_sets[0]->get_mesh(), refinement + 1, reused);
+  EXPECT_FALSE(reused);
+  delete other;
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mfem_linearize, cached_hex_p2)
+{
+  check_cached_linearize("escher-p2.mesh");
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mfem_linearize, cached_quad_p3)
+{
+  check_cached_linearize("star-q3.mesh");
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mfem_linearize, cached_tri)
+{
+  check_cached_linearize("beam-tri.mesh");
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+    return result;
+}
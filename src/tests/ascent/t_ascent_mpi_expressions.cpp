@@ -13,11 +13,14 @@
 #include "gtest/gtest.h"
 
 #include <ascent.hpp>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <math.h>
 
 
 #include <ascent_expression_eval.hpp>
+#include <expressions/ascent_blueprint_architect.hpp>
 #include <flow_workspace.hpp>
 
 #include <mpi.h>
@@ -312,6 +315,229 @@ TEST(ascent_mpi_expressions, mpi_expressoins)
     }
 }
 
+//-----------------------------------------------------------------------------
+// sparse and dense bins are reduced in a different order, so only
+// compare up to rounding
+void
+expect_same_bins(const Node &dense, const Node &sparse)
+{
+    ASSERT_EQ(dense.dtype().number_of_elements(),
+              sparse.dtype().number_of_elements());
+    const float64_accessor dense_vals = dense.as_float64_accessor();
+    const float64_accessor sparse_vals = sparse.as_float64_accessor();
+    const index_t size = dense_vals.number_of_elements();
+    for(index_t i = 0; i < size; ++i)
+    {
+      const double tol = 1e-10 * std::max(1.0, std::abs(dense_vals[i]));
+      EXPECT_NEAR(dense_vals[i], sparse_vals[i], tol) << "bin " << i;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// binning axes that leave bins empty: the x range is wider than
+// the mesh and most radial bins are not hit by the first axis bins
+const std::string sparse_test_axes =
+    "[axis('x', num_bins=6, min_val=-4, max_val=20), "
+    "axis('radial_ele', num_bins=30)]";
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_expressions, mpi_sparse_binning_matches_dense)
+{
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    Node data, verify_info;
+    create_3d_example_dataset(data, 8, par_rank, par_size);
+    Node multi_dom;
+    blueprint::mesh::to_multi_domain(data, multi_dom);
+
+    flow::Workspace::set_default_mpi_comm(MPI_Comm_c2f(comm));
+
+    runtime::expressions::register_builtin();
+    runtime::expressions::ExpressionEval eval(&multi_dom);
+
+    const std::vector<std::string> ops = {"sum", "min", "max", "avg",
+                                          "pdf", "var", "std"};
+    for(const std::string &op : ops)
+    {
+      const std::string args =
+          "binning('radial_ele', '" + op + "', " + sparse_test_axes +
+          ", empty_bin_val=-1";
+      Node dense = eval.evaluate(args + ")");
+      Node sparse = eval.evaluate(args + ", sparse=True)");
+      Node packed = eval.evaluate(args + ", sparse=True, sparse_output=True)");
+
+      SCOPED_TRACE(op);
+      EXPECT_FALSE(sparse.has_path("attrs/bin_ids"));
+      expect_same_bins(dense["attrs/value/value"],
+                       sparse["attrs/value/value"]);
+
+      // only the occupied bins are kept, and all ranks agree on them
+      ASSERT_TRUE(packed.has_path("attrs/bin_ids"));
+      const index_t num_bins =
+          dense["attrs/value/value"].dtype().number_of_elements();
+      const index_t num_occupied =
+          packed["attrs/bin_ids/value"].dtype().number_of_elements();
+      EXPECT_GT(num_occupied, 0);
+      EXPECT_LT(num_occupied, num_bins);
+      int64 local_occupied = num_occupied;
+      int64 max_occupied = 0;
+      MPI_Allreduce(&local_occupied, &max_occupied, 1, MPI_INT64_T, MPI_MAX, comm);
+      EXPECT_EQ(max_occupied, local_occupied);
+
+      Node expanded = runtime::expressions::dense_bin_values(packed);
+      expect_same_bins(dense["attrs/value/value"], expanded);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_expressions, mpi_sparse_binning_paint)
+{
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    Node data, verify_info;
+    create_3d_example_dataset(data, 8, par_rank, par_size);
+    Node multi_dom;
+    blueprint::mesh::to_multi_domain(data, multi_dom);
+
+    flow::Workspace::set_default_mpi_comm(MPI_Comm_c2f(comm));
+
+    runtime::expressions::register_builtin();
+    runtime::expressions::ExpressionEval eval(&multi_dom);
+
+    const std::string args =
+        "binning('radial_ele', 'avg', " + sparse_test_axes +
+        ", empty_bin_val=-1";
+    Node dense = eval.evaluate(args + ")");
+    Node packed = eval.evaluate(args + ", sparse=True, sparse_output=True)");
+    ASSERT_TRUE(packed.has_path("attrs/bin_ids"));
+
+    // drop the first occupied bin, so painting has to fall back
+    // to the empty bin value for the elements in it
+    const int64_array ids = packed["attrs/bin_ids/value"].value();
+    const float64_array vals = packed["attrs/value/value"].value();
+    const index_t num_occupied = ids.number_of_elements();
+    ASSERT_GT(num_occupied, 1);
+    const int64 dropped = ids[0];
+    std::vector<int64> kept_ids(num_occupied - 1);
+    std::vector<float64> kept_vals(num_occupied - 1);
+    for(index_t i = 1; i < num_occupied; ++i)
+    {
+      kept_ids[i - 1] = ids[i];
+      kept_vals[i - 1] = vals[i];
+    }
+    packed["attrs/bin_ids/value"].set(kept_ids);
+    packed["attrs/value/value"].set(kept_vals);
+    float64_array dense_vals = dense["attrs/value/value"].value();
+    dense_vals[dropped] = -1.0;
+
+    Node dense_painted, sparse_painted;
+    dense_painted.set_external(multi_dom);
+    sparse_painted.set(multi_dom);
+    runtime::expressions::paint_binning(dense, dense_painted, "painted");
+    runtime::expressions::paint_binning(packed, sparse_painted, "painted");
+
+    index_t num_empty = 0;
+    for(index_t d = 0; d < multi_dom.number_of_children(); ++d)
+    {
+      const Node &expected = dense_painted.child(d)["fields/painted/values"];
+      const Node &actual = sparse_painted.child(d)["fields/painted/values"];
+      expect_same_bins(expected, actual);
+      const float64_accessor painted = actual.as_float64_accessor();
+      for(index_t i = 0; i < painted.number_of_elements(); ++i)
+      {
+        num_empty += painted[i] == -1.0 ? 1 : 0;
+      }
+    }
+    int64 local_empty = num_empty;
+    int64 total_empty = 0;
+    MPI_Allreduce(&local_empty, &total_empty, 1, MPI_INT64_T, MPI_SUM, comm);
+    EXPECT_GT(total_empty, 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_expressions, mpi_sparse_binning_filter)
+{
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    Node data, verify_info;
+    create_3d_example_dataset(data, 8, par_rank, par_size);
+    conduit::blueprint::mesh::verify(data, verify_info);
+
+    // paint the same binning with and without the sparse option
+    conduit::Node pipelines;
+    const std::vector<std::string> outputs = {"dense_avg", "sparse_avg"};
+    for(int f = 0; f < 2; ++f)
+    {
+      conduit::Node &filter = pipelines["pl1/f" + std::to_string(f + 1)];
+      filter["type"] = "binning";
+      conduit::Node &params = filter["params"];
+      params["reduction_op"] = "avg";
+      params["reduction_field"] = "radial_ele";
+      params["output_field"] = outputs[f];
+      params["output_type"] = "mesh";
+      if(f == 1)
+      {
+        params["sparse"] = "true";
+      }
+
+      conduit::Node &axis0 = params["axes"].append();
+      axis0["field"] = "x";
+      axis0["num_bins"] = 6;
+      axis0["min_val"] = -4.0;
+      axis0["max_val"] = 20.0;
+
+      conduit::Node &axis1 = params["axes"].append();
+      axis1["field"] = "radial_ele";
+      axis1["num_bins"] = 30;
+    }
+
+    // the painted fields summed over finer bins than they were made on
+    conduit::Node queries;
+    for(const std::string &output : outputs)
+    {
+      conduit::Node &query = queries[output];
+      query["params/expression"] =
+          "binning('" + output + "', 'sum', [axis('x', num_bins=12), "
+          "axis('y', num_bins=4), axis('z', num_bins=4)])";
+      query["params/name"] = output;
+      query["pipeline"] = "pl1";
+    }
+
+    conduit::Node actions;
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    add_pipelines["pipelines"] = pipelines;
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries"] = queries;
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["mpi_comm"] = MPI_Comm_c2f(comm);
+    ascent_opts["exceptions"] = "forward";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    Node info;
+    ascent.info(info);
+    ascent.close();
+
+    expect_same_bins(info["expressions/dense_avg/100/attrs/value/value"],
+                     info["expressions/sparse_avg/100/attrs/value/value"]);
+}
+
 int main(int argc, char* argv[])
 {
     int result = 0;
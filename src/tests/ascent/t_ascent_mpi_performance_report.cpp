@@ -0,0 +1,173 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_ascent_mpi_performance_report.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <ascent.hpp>
+#include <ascent_performance_report.hpp>
+#include <iostream>
+#include <math.h>
+
+#include <mpi.h>
+
+#include <conduit_blueprint.hpp>
+
+#include "t_config.hpp"
+#include "t_utils.hpp"
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_performance_report, aggregate)
+{
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    flow::Workspace::set_default_mpi_comm(MPI_Comm_c2f(comm));
+
+    // a record as the workspace and report build it. The wall time
+    // grows with the rank and the allocations only happen on rank 0
+    Node record;
+    Node &a = record["filters/a"];
+    a["type"] = "filter_a";
+    a["wall_time"] = 1.0 + par_rank;
+    a["host_bytes_allocated"] = par_rank == 0 ? 100.0 : 0.0;
+    a["cached"] = 0;
+    Node &b = record["filters/b"];
+    b["type"] = "filter_b";
+    b["wall_time"] = 2.0;
+    record["total/wall_time"] = 3.0 + par_rank;
+
+    Node report;
+    PerformanceReport::aggregate(record, 7, report);
+
+    if(par_rank == 0)
+    {
+      report.print();
+    }
+
+    EXPECT_EQ(report["cycle"].to_int32(), 7);
+    EXPECT_EQ(report["ranks"].to_int32(), par_size);
+
+    EXPECT_EQ(report["filters/a/type"].as_string(), "filter_a");
+    EXPECT_EQ(report["filters/b/type"].as_string(), "filter_b");
+    // only numeric metrics are reduced, and not the cache flag
+    EXPECT_FALSE(report.has_path("filters/a/cached"));
+
+    const double ranks = par_size;
+    const Node &wall = report["filters/a/wall_time"];
+    EXPECT_EQ(wall["min"].to_float64(), 1.0);
+    EXPECT_EQ(wall["max"].to_float64(), ranks);
+    EXPECT_NEAR(wall["avg"].to_float64(), (ranks + 1.0) / 2.0, 1e-12);
+    EXPECT_NEAR(wall["imbalance"].to_float64(),
+                ranks / ((ranks + 1.0) / 2.0),
+                1e-12);
+    EXPECT_EQ(wall["max_rank"].to_int32(), par_size - 1);
+
+    const Node &bytes = report["filters/a/host_bytes_allocated"];
+    EXPECT_EQ(bytes["min"].to_float64(), par_size > 1 ? 0.0 : 100.0);
+    EXPECT_EQ(bytes["max"].to_float64(), 100.0);
+    EXPECT_NEAR(bytes["avg"].to_float64(), 100.0 / ranks, 1e-12);
+    EXPECT_NEAR(bytes["imbalance"].to_float64(), ranks, 1e-12);
+    EXPECT_EQ(bytes["max_rank"].to_int32(), 0);
+
+    // the same value everywhere is perfectly balanced
+    const Node &b_wall = report["filters/b/wall_time"];
+    EXPECT_EQ(b_wall["min"].to_float64(), 2.0);
+    EXPECT_EQ(b_wall["max"].to_float64(), 2.0);
+    EXPECT_NEAR(b_wall["avg"].to_float64(), 2.0, 1e-12);
+    EXPECT_NEAR(b_wall["imbalance"].to_float64(), 1.0, 1e-12);
+
+    const Node &total = report["total/wall_time"];
+    EXPECT_EQ(total["min"].to_float64(), 3.0);
+    EXPECT_EQ(total["max"].to_float64(), 2.0 + ranks);
+    EXPECT_EQ(total["max_rank"].to_int32(), par_size - 1);
+
+    // all ranks get the whole report
+    double rank_avg = report["filters/a/wall_time/avg"].to_float64();
+    double avg_sum = 0.0;
+    MPI_Allreduce(&rank_avg, &avg_sum, 1, MPI_DOUBLE, MPI_SUM, comm);
+    EXPECT_NEAR(avg_sum, ranks * (ranks + 1.0) / 2.0, 1e-12);
+
+    // nothing to reduce
+    Node empty_record;
+    PerformanceReport::aggregate(empty_record, 8, report);
+    EXPECT_EQ(report["cycle"].to_int32(), 8);
+    EXPECT_EQ(report["filters"].number_of_children(), 0);
+    EXPECT_FALSE(report.has_child("total"));
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_performance_report, runtime_report)
+{
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    Node data, verify_info;
+    create_3d_example_dataset(data, 16, par_rank, par_size);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data, verify_info));
+    data["state/cycle"] = 5;
+
+    conduit::Node actions;
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries/q1/params/expression"] = "max(field('radial_vert'))";
+    add_queries["queries/q1/params/name"] = "max_radial";
+
+    Node ascent_opts;
+    ascent_opts["mpi_comm"] = MPI_Comm_c2f(comm);
+    ascent_opts["performance_report"] = "true";
+
+    Ascent ascent;
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    Node info;
+    ascent.info(info);
+    ascent.close();
+
+    EXPECT_TRUE(info.has_child("performance"));
+    const Node &report = info["performance"];
+    if(par_rank == 0)
+    {
+      report.print();
+    }
+    EXPECT_EQ(report["cycle"].to_int32(), 5);
+    EXPECT_EQ(report["ranks"].to_int32(), par_size);
+    EXPECT_TRUE(report["filters"].number_of_children() > 0);
+    EXPECT_TRUE(report.has_path("total/host_bytes_allocated/max"));
+    EXPECT_TRUE(report.has_path("total/mpi_wait_time/max"));
+    EXPECT_TRUE(report["total/mpi_wait_time/min"].to_float64() >= 0.0);
+    EXPECT_TRUE(report["total/host_bytes_allocated/min"].to_float64() >= 0.0);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+
+    return result;
+}
@@ -13,6 +13,8 @@
 #include "gtest/gtest.h"
 
 #include <ascent.hpp>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <math.h>
 
@@ -28,6 +30,55 @@ using namespace std;
 using namespace conduit;
 using namespace ascent;
 
+//-----------------------------------------------------------------------------
+// where vtkh places auto slice level 'level' of 'levels' along an axis
+// spanning [min, max]
+double
+auto_slice_level(int level, int levels, double min, double max)
+{
+    const double offset = level * (100.0 / levels) * 4.0 / 100.0 - 2.0;
+    double t = (offset + 1.0) / 2.0;
+    t = std::max(1e-5, std::min(1.0 - 1e-5, t));
+    return min + t * (max - min);
+}
+
+//-----------------------------------------------------------------------------
+// adds the vertex fields 'slice_probe' and 'z_coord'. slice_probe is
+// zero except within width of the plane z = plane_z, where it grows
+// with x, so only that plane sees more than one value. z_coord lets
+// queries on the slice report where the slice was taken.
+void
+add_slice_probe(Node &data, double plane_z, double x_min, double width)
+{
+    const Node &values = data["coordsets/coords/values"];
+    const bool rectilinear = data["coordsets/coords/type"].as_string() == "rectilinear";
+    float64_array x = values["x"].value();
+    float64_array y = values["y"].value();
+    float64_array z = values["z"].value();
+    const index_t nx = x.number_of_elements();
+    const index_t ny = y.number_of_elements();
+    const index_t npts = rectilinear ? nx * ny * z.number_of_elements() :
+                                       x.number_of_elements();
+
+    data["fields/slice_probe/association"] = "vertex";
+    data["fields/slice_probe/topology"] = data["topologies"].child(0).name();
+    data["fields/slice_probe/values"].set(DataType::float64(npts));
+    data["fields/z_coord/association"] = "vertex";
+    data["fields/z_coord/topology"] = data["topologies"].child(0).name();
+    data["fields/z_coord/values"].set(DataType::float64(npts));
+    float64_array probe = data["fields/slice_probe/values"].value();
+    float64_array z_coord = data["fields/z_coord/values"].value();
+
+    for(index_t p = 0; p < npts; ++p)
+    {
+        const double px = rectilinear ? x[p % nx] : x[p];
+        const double pz = rectilinear ? z[p / (nx * ny)] : z[p];
+        const double bump = std::max(0.0, 1.0 - std::abs(pz - plane_z) / width);
+        probe[p] = (px - x_min + 1.0) * bump;
+        z_coord[p] = pz;
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_mpi_slice, mpi_3slice)
 {
@@ -242,6 +293,104 @@ TEST(ascent_mpi_slice, mpi_auto_slice)
     EXPECT_TRUE(check_test_image(output_file));
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_mpi_slice, mpi_auto_slice_chosen_plane)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent vtkm support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Set Up MPI
+    //
+    int par_rank;
+    int par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    //
+    // Create the data. Each rank holds a slab in x, the
+    // global mesh spans [-size/2, size/2] in x and
+    // [-size/4, 3 size/4] in z with unit spacing
+    //
+    const int cell_dim = 32;
+    Node data, verify_info;
+    create_3d_example_dataset(data,cell_dim,par_rank,par_size);
+    const double size = par_size * cell_dim;
+
+    // rank 0 only sees spread on plane_a, the other ranks on plane_b.
+    // Summed over all ranks plane_b holds more distinct values and
+    // has to win on every rank, while rank 0 alone would pick plane_a
+    const int levels = 10;
+    const double plane_a = auto_slice_level(3, levels, -size / 4., 3. * size / 4.);
+    const double plane_b = auto_slice_level(6, levels, -size / 4., 3. * size / 4.);
+    const double plane_z = par_rank == 0 ? plane_a : plane_b;
+    add_slice_probe(data, plane_z, -size / 2., 1.5);
+    const double expected_z = par_size > 1 ? plane_b : plane_a;
+
+    conduit::blueprint::mesh::verify(data,verify_info);
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node pipelines;
+    pipelines["pl1/f1/type"] = "auto_slice";
+    conduit::Node &slice_params = pipelines["pl1/f1/params"];
+    slice_params["field"]    = "slice_probe";
+    slice_params["levels"]   = levels;
+    slice_params["normal/x"] = 0.0;
+    slice_params["normal/y"] = 0.0;
+    slice_params["normal/z"] = 1.0;
+
+    conduit::Node queries;
+    queries["q1/params/expression"] = "min(field('z_coord'))";
+    queries["q1/params/name"] = "slice_z_min";
+    queries["q1/pipeline"] = "pl1";
+    queries["q2/params/expression"] = "max(field('z_coord'))";
+    queries["q2/params/name"] = "slice_z_max";
+    queries["q2/pipeline"] = "pl1";
+
+    conduit::Node actions;
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    add_pipelines["pipelines"] = pipelines;
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries"] = queries;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["mpi_comm"] = MPI_Comm_c2f(comm);
+    ascent_opts["runtime"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    conduit::Node info;
+    ascent.info(info);
+    ascent.close();
+
+    // the query results are global, so if any rank had sliced a
+    // different plane, min and max would differ
+    const double z_min = info["expressions/slice_z_min/100/attrs/value/value"].to_float64();
+    const double z_max = info["expressions/slice_z_max/100/attrs/value/value"].to_float64();
+    EXPECT_NEAR(z_min, expected_z, 1e-3);
+    EXPECT_NEAR(z_max, expected_z, 1e-3);
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
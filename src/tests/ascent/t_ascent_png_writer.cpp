@@ -0,0 +1,219 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) Lawrence Livermore National Security, LLC and other Ascent
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Ascent.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_ascent_png_writer.cpp
+///
+//-----------------------------------------------------------------------------
+
+
+#include "gtest/gtest.h"
+
+#include <ascent.hpp>
+#include <png_utils/ascent_png_writer.hpp>
+#include <png_utils/ascent_png_decoder.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#include "t_config.hpp"
+#include "t_utils.hpp"
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+
+const int width = 64;
+const int height = 32;
+
+//-----------------------------------------------------------------------------
+std::string
+image_file(const std::string &prefix, int i)
+{
+    std::stringstream ss;
+    ss << prefix << "_" << i << ".png";
+    return conduit::utils::join_file_path(prepare_output_dir(), ss.str());
+}
+
+//-----------------------------------------------------------------------------
+void
+remove_image(const std::string &file_name)
+{
+    if(conduit::utils::is_file(file_name))
+    {
+        conduit::utils::remove_file(file_name);
+    }
+}
+
+//-----------------------------------------------------------------------------
+std::vector<unsigned char>
+make_image(int i)
+{
+    std::vector<unsigned char> rgba(width * height * 4);
+    for(int p = 0; p < width * height; ++p)
+    {
+        rgba[p * 4 + 0] = static_cast<unsigned char>(p % 256);
+        rgba[p * 4 + 1] = static_cast<unsigned char>(i * 10);
+        rgba[p * 4 + 2] = 128;
+        rgba[p * 4 + 3] = 255;
+    }
+    return rgba;
+}
+
+//-----------------------------------------------------------------------------
+// checks the image made by make_image(i) is on disk
+void
+check_image(const std::string &file_name, int i)
+{
+    ASSERT_TRUE(conduit::utils::is_file(file_name)) << file_name;
+    unsigned char *rgba = nullptr;
+    int w = 0, h = 0;
+    PNGDecoder decoder;
+    decoder.Decode(rgba, w, h, file_name);
+    ASSERT_TRUE(rgba != nullptr);
+    EXPECT_EQ(w, width);
+    EXPECT_EQ(h, height);
+    std::vector<unsigned char> expected = make_image(i);
+    int diffs = 0;
+    for(int p = 0; p < width * height * 4; ++p)
+    {
+        diffs += rgba[p] != expected[p] ? 1 : 0;
+    }
+    EXPECT_EQ(diffs, 0);
+    free(rgba);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_png_writer, queued_images_written_on_flush)
+{
+    const int num_images = 8;
+    std::vector<std::string> files;
+    for(int i = 0; i < num_images; ++i)
+    {
+        files.push_back(image_file("tout_png_writer_flush", i));
+        remove_image(files.back());
+    }
+
+    PNGWriteQueue queue;
+    queue.SetAsync(true);
+    queue.SetNumberOfThreads(2);
+    // smaller than the number of images, so writes have to wait
+    queue.SetMaxQueueSize(3);
+    {
+        PNGWriter::Scope scope(queue);
+        for(int i = 0; i < num_images; ++i)
+        {
+            std::vector<unsigned char> rgba = make_image(i);
+            PNGWriter::Write(rgba, width, height, files[i]);
+        }
+        PNGWriter::Flush();
+    }
+
+    for(int i = 0; i < num_images; ++i)
+    {
+        check_image(files[i], i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_png_writer, queued_images_written_on_destroy)
+{
+    const int num_images = 4;
+    std::vector<std::string> files;
+    for(int i = 0; i < num_images; ++i)
+    {
+        files.push_back(image_file("tout_png_writer_destroy", i));
+        remove_image(files.back());
+    }
+
+    {
+        PNGWriteQueue queue;
+        queue.SetAsync(true);
+        PNGWriter::Scope scope(queue);
+        for(int i = 0; i < num_images; ++i)
+        {
+            std::vector<unsigned char> rgba = make_image(i);
+            PNGWriter::Write(rgba, width, height, files[i]);
+        }
+    }
+
+    for(int i = 0; i < num_images; ++i)
+    {
+        check_image(files[i], i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_png_writer, failed_writes_raised_on_flush)
+{
+    const std::string bad_file
+        = conduit::utils::join_file_path(prepare_output_dir(),
+                                         "tout_png_writer_missing_dir/bad.png");
+    const std::string good_file = image_file("tout_png_writer_after_fail", 0);
+    remove_image(good_file);
+
+    PNGWriteQueue queue;
+    queue.SetAsync(true);
+    {
+        PNGWriter::Scope scope(queue);
+        std::vector<unsigned char> rgba = make_image(0);
+        // the directory does not exist, so the worker fails to save
+        PNGWriter::Write(rgba, width, height, bad_file);
+        EXPECT_THROW(PNGWriter::Flush(), conduit::Error);
+        // the failure is only reported once
+        EXPECT_NO_THROW(PNGWriter::Flush());
+
+        // the workers are still alive after the failure
+        PNGWriter::Write(rgba, width, height, good_file);
+        EXPECT_NO_THROW(PNGWriter::Flush());
+    }
+    EXPECT_FALSE(conduit::utils::is_file(bad_file));
+    check_image(good_file, 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_png_writer, queues_are_independent)
+{
+    const std::string file_a = image_file("tout_png_writer_queue_a", 0);
+    const std::string file_b = image_file("tout_png_writer_queue_b", 1);
+    remove_image(file_a);
+    remove_image(file_b);
+
+    PNGWriteQueue queue_a;
+    queue_a.SetAsync(true);
+    queue_a.SetDistributed(true);
+
+    // a second queue (e.g. of a trigger's runtime) with the
+    // default options does not change the options of the first
+    PNGWriteQueue queue_b;
+    EXPECT_FALSE(queue_b.Async());
+    EXPECT_FALSE(queue_b.Distributed());
+    EXPECT_TRUE(queue_a.Async());
+
+    {
+        PNGWriter::Scope scope_a(queue_a);
+        EXPECT_TRUE(PNGWriter::Distributed());
+        std::vector<unsigned char> rgba = make_image(0);
+        PNGWriter::Write(rgba, width, height, file_a);
+        {
+            PNGWriter::Scope scope_b(queue_b);
+            EXPECT_FALSE(PNGWriter::Distributed());
+            // synchronous, on disk when write returns
+            std::vector<unsigned char> rgba_b = make_image(1);
+            PNGWriter::Write(rgba_b, width, height, file_b);
+            check_image(file_b, 1);
+        }
+        // the outer queue is active again
+        EXPECT_TRUE(PNGWriter::Distributed());
+        PNGWriter::Flush();
+    }
+    check_image(file_a, 0);
+
+    // no active queue: writes are synchronous
+    EXPECT_FALSE(PNGWriter::Distributed());
+}
@@ -20,6 +20,7 @@
 
 #include <conduit_blueprint.hpp>
 #include <conduit_relay.hpp>
+#include <conduit_relay_io_blueprint.hpp>
 
 #include "t_config.hpp"
 #include "t_utils.hpp"
@@ -259,6 +260,106 @@ TEST(ascent_relay, test_relay_hdf5_opts)
 
 }//
 
+//-----------------------------------------------------------------------------
+TEST(ascent_relay, test_relay_hdf5_async)
+{
+    Node n;
+    ascent::about(n);
+
+    ASCENT_INFO("Testing async relay extract in serial with hdf5 gzip opts");
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::basic("uniform",
+                                              1001,
+                                              11,
+                                              11,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+    float64_array vals = data["fields/field/values"].value();
+    vals.fill(0);
+    // one non zero value to check on read back
+    vals[42] = 42.0;
+
+    string output_path = prepare_output_dir();
+
+    string output_file_pre = conduit::utils::join_file_path(output_path,"tout_relay_hdf5_async_000");
+    string output_root_pre = output_file_pre + ".cycle_000100.root";
+
+    string output_file_opts = conduit::utils::join_file_path(output_path,"tout_relay_hdf5_async_001");
+    string output_root_opts = output_file_opts + ".cycle_000100.root";
+
+    string output_file_post = conduit::utils::join_file_path(output_path,"tout_relay_hdf5_async_002");
+    string output_root_post = output_file_post + ".cycle_000100.root";
+
+    // remove old files before executing
+    remove_test_image(output_root_pre);
+    remove_test_image(output_root_opts);
+    remove_test_image(output_root_post);
+
+    conduit::Node actions;
+    // add the extracts
+    conduit::Node &add_extracts = actions.append();
+    add_extracts["action"] = "add_extracts";
+    Node &extracts = add_extracts["extracts"];
+
+    extracts["e1/type"]  = "relay";
+    extracts["e1/params/path"] = output_file_pre;
+    extracts["e1/params/protocol"] = "hdf5";
+    extracts["e1/params/async/enabled"] = "true";
+
+    //
+    // Run Ascent
+    //
+    Ascent ascent;
+    ascent.open();
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    // the staged writes use the hdf5 options of their extract
+    extracts["e1/params/path"] = output_file_opts;
+    extracts["e1/params/hdf5_options/chunking/enabled"]  = "true";
+    extracts["e1/params/hdf5_options/chunking/threshold"]  = 800000-1;
+    extracts["e1/params/hdf5_options/chunking/chunk_size"] = 800000;
+    extracts["e1/params/hdf5_options/chunking/compression/level"] = 9;
+
+    ascent.execute(actions);
+
+    extracts["e1/params/path"] = output_file_post;
+    extracts.remove("e1/params/hdf5_options");
+
+    ascent.execute(actions);
+
+    // close waits for the staged writes
+    ascent.close();
+
+    const string roots[3] = {output_root_pre, output_root_opts, output_root_post};
+    for(int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(conduit::utils::is_file(roots[i])) << roots[i];
+        Node mesh;
+        conduit::relay::io::blueprint::load_mesh(roots[i], mesh);
+        ASSERT_EQ(mesh.number_of_children(), 1);
+        Node &field = mesh.child(0)["fields/field/values"];
+        Node field_dbls;
+        field.to_float64_array(field_dbls);
+        float64_array res = field_dbls.value();
+        ASSERT_EQ(res.number_of_elements(), vals.number_of_elements());
+        EXPECT_EQ(res[42], 42.0);
+        EXPECT_EQ(res[0], 0.0);
+    }
+
+    index_t fsize_pre  = conduit::utils::file_size(output_root_pre);
+    index_t fsize_opts = conduit::utils::file_size(output_root_opts);
+    index_t fsize_post = conduit::utils::file_size(output_root_post);
+    // the options only applied to the second write
+    EXPECT_EQ(fsize_pre,fsize_post);
+    EXPECT_TRUE(fsize_pre > fsize_opts);
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_relay, test_relay_json)
 {
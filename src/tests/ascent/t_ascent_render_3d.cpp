@@ -104,6 +104,138 @@ TEST(ascent_render_3d, test_render_3d_render_default_runtime)
     EXPECT_TRUE(check_test_image(output_file));
 }
 
+TEST(ascent_render_3d, test_render_3d_reused_topology)
+{
+    // the ascent runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping 3D reused "
+                      "topology test");
+
+        return;
+    }
+
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+    data["state/revisions/coordsets/coords"] = 0;
+    data["state/revisions/topologies/mesh"] = 0;
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing 3D Rendering with a reused topology");
+
+    string output_path = prepare_output_dir();
+    // same image as test_render_3d_render_default_runtime
+    string output_file = conduit::utils::join_file_path(output_path,"tout_render_3d_default_runtime");
+    string moved_file = conduit::utils::join_file_path(output_path,
+                                                       "tout_render_3d_reused_topology_moved");
+    string fresh_file = conduit::utils::join_file_path(output_path,
+                                                       "tout_render_3d_fresh_topology_moved");
+
+    // remove old images before rendering
+    remove_test_image(output_file);
+    remove_test_image(moved_file);
+    remove_test_image(fresh_file);
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]         = "pseudocolor";
+    scenes["s1/plots/p1/field"] = "braid";
+    scenes["s1/image_prefix"] = output_file;
+
+    conduit::Node actions;
+    conduit::Node &add_plots = actions.append();
+    add_plots["action"] = "add_scenes";
+    add_plots["scenes"] = scenes;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    // the report counts the conversions that reused a topology
+    ascent_opts["performance_report"] = "true";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    // the second cycle reuses the cells and coordinates
+    remove_test_image(output_file);
+    ascent.publish(data);
+    ascent.execute(actions);
+    EXPECT_TRUE(check_test_image(output_file));
+
+    Node info;
+    ascent.info(info);
+    EXPECT_GT(info["performance/total/reused_cell_sets/max"].to_float64(), 0.0);
+    EXPECT_GT(info["performance/total/reused_coordsets/max"].to_float64(), 0.0);
+
+    // move the points and bump the coordset revision, the cells are
+    // still reused but the coordinates are not
+    Node &coords = data["coordsets/coords/values"];
+    for(int c = 0; c < coords.number_of_children(); ++c)
+    {
+        float64_array values = coords.child(c).value();
+        for(index_t i = 0; i < values.number_of_elements(); ++i)
+        {
+            values[i] = 1.5 * values[i] + 0.25 * c;
+        }
+    }
+    data["state/revisions/coordsets/coords"] = 1;
+    scenes["s1/image_prefix"] = moved_file;
+    actions.child(0)["scenes"] = scenes;
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.info(info);
+    ascent.close();
+
+    EXPECT_GT(info["performance/total/reused_cell_sets/max"].to_float64(), 0.0);
+
+    // the same moved mesh without revisions is converted from scratch
+    Node fresh_data;
+    fresh_data.set(data);
+    fresh_data["state"].remove("revisions");
+    scenes["s1/image_prefix"] = fresh_file;
+    actions.child(0)["scenes"] = scenes;
+
+    Ascent fresh_ascent;
+    Node fresh_opts;
+    fresh_opts["runtime/type"] = "ascent";
+    fresh_ascent.open(fresh_opts);
+    fresh_ascent.publish(fresh_data);
+    fresh_ascent.execute(actions);
+    fresh_ascent.close();
+
+    // the reused cells render the moved mesh the same way
+    Node compare_info;
+    ascent::PNGCompare compare;
+    bool same = compare.Compare(moved_file + "100.png",
+                                fresh_file + "100.png",
+                                compare_info,
+                                0.001f);
+    if(!same)
+    {
+        compare_info.print();
+    }
+    EXPECT_TRUE(same);
+}
+
 TEST(ascent_render_3d, test_render_3d_original_bounds)
 {
     // the ascent runtime is currently our only rendering runtime
@@ -13,6 +13,9 @@
 #include "gtest/gtest.h"
 
 #include <ascent.hpp>
+#include <ascent_transmogrifier.hpp>
+
+#include <math.h>
 
 #include "t_config.hpp"
 #include "t_utils.hpp"
@@ -20,6 +23,150 @@
 using namespace std;
 using namespace conduit;
 using namespace ascent;
+
+//-----------------------------------------------------------------------------
+// a polychain with its points scaled and a vertex field of the points
+void
+make_moved_polychain(double scale, Node &data)
+{
+    conduit::blueprint::mesh::examples::polychain(5, data);
+    Node &values = data["coordsets/coords/values"];
+    NodeIterator itr = values.children();
+    while(itr.has_next())
+    {
+        Node &comp = itr.next();
+        Node moved;
+        comp.to_float64_array(moved);
+        float64_array moved_vals = moved.value();
+        for(index_t i = 0; i < moved_vals.number_of_elements(); ++i)
+        {
+            moved_vals[i] *= scale;
+        }
+        comp.set(moved);
+    }
+
+    float64_array x = values["x"].value();
+    float64_array y = values["y"].value();
+    float64_array z = values["z"].value();
+    const index_t num_points = x.number_of_elements();
+    Node &field = data["fields/point_sum"];
+    field["association"] = "vertex";
+    field["topology"] = "topo";
+    field["values"].set(DataType::float64(num_points));
+    float64_array field_vals = field["values"].value();
+    for(index_t i = 0; i < num_points; ++i)
+    {
+        field_vals[i] = x[i] + 2.0 * y[i] + 3.0 * z[i];
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+expect_close_values(const Node &expected, const Node &actual)
+{
+    ASSERT_EQ(expected.number_of_children(), actual.number_of_children());
+    if(expected.number_of_children() != 0)
+    {
+        for(int i = 0; i < expected.number_of_children(); ++i)
+        {
+            expect_close_values(expected.child(i), actual.child(i));
+        }
+        return;
+    }
+
+    Node e_node, a_node;
+    expected.to_float64_array(e_node);
+    actual.to_float64_array(a_node);
+    float64_array e_vals = e_node.value();
+    float64_array a_vals = a_node.value();
+    ASSERT_EQ(e_vals.number_of_elements(), a_vals.number_of_elements());
+    for(index_t i = 0; i < e_vals.number_of_elements(); ++i)
+    {
+        EXPECT_NEAR(e_vals[i], a_vals[i], 1e-6 * (1.0 + fabs(e_vals[i])));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// checks to_poly's output against generate_sides run from scratch
+void
+expect_fresh_sides(const Node &dom, const Node &res)
+{
+    const Node &topo = dom["topologies/topo"];
+    Node fresh, s2dmap, d2smap, options;
+    conduit::blueprint::mesh::topology::unstructured::generate_sides(
+      topo,
+      fresh["topologies/topo"],
+      fresh["coordsets/coords"],
+      fresh["fields"],
+      s2dmap,
+      d2smap,
+      options);
+
+    Node info;
+    EXPECT_FALSE(fresh["topologies/topo/elements/connectivity"].diff(
+                   res["topologies/topo/elements/connectivity"], info));
+    expect_close_values(fresh["coordsets/coords/values"],
+                        res["coordsets/coords/values"]);
+
+    EXPECT_TRUE(fresh["fields"].has_child("chain"));
+    EXPECT_TRUE(fresh["fields"].has_child("point_sum"));
+    NodeConstIterator itr = fresh["fields"].children();
+    while(itr.has_next())
+    {
+        const Node &field = itr.next();
+        EXPECT_TRUE(res["fields"].has_child(itr.name()));
+        expect_close_values(field["values"],
+                            res["fields/" + itr.name() + "/values"]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_pipeline, test_to_poly_cached_sides)
+{
+    Transmogrifier::clear_poly_cache();
+
+    Node data, doms, res;
+    std::vector<std::shared_ptr<Node>> sides;
+    make_moved_polychain(1.0, data);
+    blueprint::mesh::to_multi_domain(data, doms);
+    Transmogrifier::to_poly(doms, res, sides);
+    ASSERT_EQ(sides.size(), (size_t)1);
+    std::shared_ptr<Node> first = sides[0];
+    // both maps reproduced conduit, so later cycles use them
+    EXPECT_TRUE(first->has_child("side_elements"));
+    EXPECT_TRUE(first->has_child("center_map"));
+    expect_fresh_sides(doms.child(0), res.child(0));
+    Node first_coords;
+    first_coords.set((*first)["coordsets"]);
+
+    // the same mesh again is a cache hit
+    Node same_data, same_doms, same_res;
+    std::vector<std::shared_ptr<Node>> same_sides;
+    make_moved_polychain(1.0, same_data);
+    blueprint::mesh::to_multi_domain(same_data, same_doms);
+    Transmogrifier::to_poly(same_doms, same_res, same_sides);
+    ASSERT_EQ(same_sides.size(), (size_t)1);
+    EXPECT_EQ(same_sides[0].get(), first.get());
+    expect_fresh_sides(same_doms.child(0), same_res.child(0));
+
+    // moved points keep the sides and recompute the centers
+    Node moved_data, moved_doms, moved_res;
+    std::vector<std::shared_ptr<Node>> moved_sides;
+    make_moved_polychain(1.5, moved_data);
+    blueprint::mesh::to_multi_domain(moved_data, moved_doms);
+    Transmogrifier::to_poly(moved_doms, moved_res, moved_sides);
+    ASSERT_EQ(moved_sides.size(), (size_t)1);
+    EXPECT_NE(moved_sides[0].get(), first.get());
+    expect_fresh_sides(moved_doms.child(0), moved_res.child(0));
+
+    // the first entry is still referenced by res, so it did not change
+    Node info;
+    EXPECT_FALSE(first_coords.diff((*first)["coordsets"], info));
+    expect_fresh_sides(doms.child(0), res.child(0));
+
+    Transmogrifier::clear_poly_cache();
+}
+
 //-----------------------------------------------------------------------------
 TEST(ascent_pipeline, test_render_3d_poly)
 {
@@ -166,3 +313,69 @@ TEST(ascent_pipeline, test_render_3d_poly_multi)
     // // check that we created an image
     EXPECT_TRUE(check_test_image(output_file, 0.001f, "0"));
 }
+
+//-----------------------------------------------------------------------------
+TEST(ascent_pipeline, test_render_3d_poly_cached_sides)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent vtkm support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    index_t length = 10;
+
+    conduit::blueprint::mesh::examples::polychain(length, data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data, verify_info));
+
+    string output_path = prepare_output_dir();
+    // same image as test_render_3d_poly
+    string output_file = conduit::utils::join_file_path(output_path,
+                                                        "tout_render_3d_poly");
+    // remove old images before rendering
+    remove_test_image(output_file);
+
+    //
+    // Create the actions.
+    //
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"] = "pseudocolor";
+    scenes["s1/plots/p1/field"] = "chain";
+    scenes["s1/image_prefix"] = output_file;
+
+    conduit::Node actions;
+    conduit::Node &add_plots = actions.append();
+    add_plots["action"] = "add_scenes";
+    add_plots["scenes"] = scenes;
+    actions.print();
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    // the second cycle reuses the sides of the first
+    remove_test_image(output_file);
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.close();
+
+    //
+    // // check that we created an image
+    EXPECT_TRUE(check_test_image(output_file, 0.001f, "0"));
+}
@@ -122,6 +122,74 @@ TEST(ascent_iso_volume, test_iso_volume)
     ASCENT_ACTIONS_DUMP(actions,output_file,msg);
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_auto_camera, test_progressive_search)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent vtkm support disabled, skipping test");
+        return;
+    }
+
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing the progressive auto camera search");
+
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,
+                                                        "tout_auto_camera_progressive");
+
+    // remove old images before rendering
+    remove_test_image(output_file);
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]         = "pseudocolor";
+    scenes["s1/plots/p1/field"] = "radial";
+    scenes["s1/renders/r1/type"] = "auto_camera";
+    scenes["s1/renders/r1/auto_camera/metric"] = "dds_entropy";
+    scenes["s1/renders/r1/auto_camera/samples"] = 10;
+    scenes["s1/renders/r1/auto_camera/field"] = "radial";
+    scenes["s1/renders/r1/auto_camera/height"] = 256;
+    scenes["s1/renders/r1/auto_camera/width"] = 256;
+    scenes["s1/renders/r1/auto_camera/coarse_factor"] = 4;
+    scenes["s1/renders/r1/auto_camera/top_k"] = 2;
+    scenes["s1/renders/r1/auto_camera/seed_previous"] = "true";
+    scenes["s1/renders/r1/image_prefix"] = output_file;
+
+    conduit::Node actions;
+    conduit::Node &add_scenes= actions.append();
+    add_scenes["action"] = "add_scenes";
+    add_scenes["scenes"] = scenes;
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    // the second execute is seeded with the winner of the first
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.close();
+
+    // check that we created an image. The winner of the progressive
+    // search is checked against the exhaustive one in
+    // t_vtk-h_auto_camera, where the scores are visible
+    EXPECT_TRUE(conduit::utils::is_file(output_file + "100.png"));
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -15,6 +15,8 @@
 
 #include <ascent.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <math.h>
 
@@ -33,6 +35,54 @@ using namespace ascent;
 
 index_t EXAMPLE_MESH_SIDE_DIM = 20;
 
+//-----------------------------------------------------------------------------
+// where vtkh places auto slice level 'level' of 'levels' along an axis
+// spanning [min, max]
+double
+auto_slice_level(int level, int levels, double min, double max)
+{
+    const double offset = level * (100.0 / levels) * 4.0 / 100.0 - 2.0;
+    double t = (offset + 1.0) / 2.0;
+    t = std::max(1e-5, std::min(1.0 - 1e-5, t));
+    return min + t * (max - min);
+}
+
+//-----------------------------------------------------------------------------
+// adds the vertex fields 'slice_probe' and 'z_coord'. slice_probe is
+// zero except within width of the plane z = plane_z, where it grows
+// with x, so only that plane sees more than one value. z_coord lets
+// queries on the slice report where the slice was taken.
+void
+add_slice_probe(Node &data, double plane_z, double x_min, double width)
+{
+    const Node &values = data["coordsets/coords/values"];
+    const bool rectilinear = data["coordsets/coords/type"].as_string() == "rectilinear";
+    float64_array x = values["x"].value();
+    float64_array y = values["y"].value();
+    float64_array z = values["z"].value();
+    const index_t nx = x.number_of_elements();
+    const index_t ny = y.number_of_elements();
+    const index_t npts = rectilinear ? nx * ny * z.number_of_elements() :
+                                       x.number_of_elements();
+
+    data["fields/slice_probe/association"] = "vertex";
+    data["fields/slice_probe/topology"] = data["topologies"].child(0).name();
+    data["fields/slice_probe/values"].set(DataType::float64(npts));
+    data["fields/z_coord/association"] = "vertex";
+    data["fields/z_coord/topology"] = data["topologies"].child(0).name();
+    data["fields/z_coord/values"].set(DataType::float64(npts));
+    float64_array probe = data["fields/slice_probe/values"].value();
+    float64_array z_coord = data["fields/z_coord/values"].value();
+
+    for(index_t p = 0; p < npts; ++p)
+    {
+        const double px = rectilinear ? x[p % nx] : x[p];
+        const double pz = rectilinear ? z[p / (nx * ny)] : z[p];
+        const double bump = std::max(0.0, 1.0 - std::abs(pz - plane_z) / width);
+        probe[p] = (px - x_min + 1.0) * bump;
+        z_coord[p] = pz;
+    }
+}
 
 //-----------------------------------------------------------------------------
 TEST(ascent_slice, test_slice)
@@ -816,6 +866,93 @@ TEST(ascent_slice, test_auto_slice_xy_axis)
     std::string msg = "An example of the automaic slice filter using an xy-axis normal, 10 levels, and an adusted camera.";
     ASCENT_ACTIONS_DUMP(actions,output_file,msg);
 }
+//-----------------------------------------------------------------------------
+TEST(ascent_slice, test_auto_slice_chosen_plane)
+{
+    // the vtkm runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/vtkm/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent vtkm support disabled, skipping test");
+        return;
+    }
+
+    //
+    // Create an example mesh, braid spans [-10,10] on every axis
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    const int levels = 10;
+    const int target = 6;
+    const double plane_z = auto_slice_level(target, levels, -10., 10.);
+    // wide enough to reach the nodes on both sides of the plane,
+    // but far from every other level
+    const double width = 1.5 * 20. / (EXAMPLE_MESH_SIDE_DIM - 1);
+    add_slice_probe(data, plane_z, -10., width);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing the plane picked by the automatic slice");
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node pipelines;
+    pipelines["pl1/f1/type"] = "auto_slice";
+    conduit::Node &slice_params = pipelines["pl1/f1/params"];
+    slice_params["field"]    = "slice_probe";
+    slice_params["levels"]   = levels;
+    slice_params["normal/x"] = 0.f;
+    slice_params["normal/y"] = 0.f;
+    slice_params["normal/z"] = 1.f;
+
+    conduit::Node queries;
+    queries["q1/params/expression"] = "min(field('z_coord'))";
+    queries["q1/params/name"] = "slice_z_min";
+    queries["q1/pipeline"] = "pl1";
+    queries["q2/params/expression"] = "max(field('z_coord'))";
+    queries["q2/params/name"] = "slice_z_max";
+    queries["q2/pipeline"] = "pl1";
+
+    conduit::Node actions;
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    add_pipelines["pipelines"] = pipelines;
+    conduit::Node &add_queries = actions.append();
+    add_queries["action"] = "add_queries";
+    add_queries["queries"] = queries;
+
+    //
+    // Run Ascent
+    //
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    conduit::Node info;
+    ascent.info(info);
+    ascent.close();
+
+    // only the target plane has any spread in the field
+    const double z_min = info["expressions/slice_z_min/100/attrs/value/value"].to_float64();
+    const double z_max = info["expressions/slice_z_max/100/attrs/value/value"].to_float64();
+    EXPECT_NEAR(z_min, plane_z, 1e-3);
+    EXPECT_NEAR(z_max, plane_z, 1e-3);
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -17,6 +17,7 @@
 #include <math.h>
 
 #include <conduit_blueprint.hpp>
+#include <conduit_relay_io_blueprint.hpp>
 
 #include "t_config.hpp"
 #include "t_utils.hpp"
@@ -384,6 +385,152 @@ TEST(ascent_triggers, trigger_extract_inline_actions)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(ascent_triggers, trigger_runtime_reuse)
+{
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,"tout_trigger_reuse");
+    string first_root_file = output_file + ".cycle_000100.root";
+    string second_root_file = output_file + ".cycle_000101.root";
+    for(const string &file : {first_root_file, second_root_file})
+    {
+        if(conduit::utils::is_file(file))
+        {
+            conduit::utils::remove_file(file);
+        }
+    }
+
+    conduit::Node trigger_actions;
+    conduit::Node &add_ext= trigger_actions.append();
+    add_ext["action"] = "add_extracts";
+    add_ext["extracts/e1/type"]  = "relay";
+    add_ext["extracts/e1/params/path"] = output_file;
+    add_ext["extracts/e1/params/protocol"] = "blueprint/mesh/hdf5";
+
+    Node actions;
+    conduit::Node &add_triggers= actions.append();
+    add_triggers["action"] = "add_triggers";
+    add_triggers["triggers/t1/params/condition"] = "1 == 1";
+    add_triggers["triggers/t1/params/actions"] = trigger_actions;
+
+    //
+    // Run Ascent, firing the same trigger on two cycles
+    //
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    // new values for the second firing
+    Node data2;
+    data2.set(data);
+    data2["state/cycle"] = 101;
+    float64_array vals = data2["fields/braid/values"].value();
+    for(index_t i = 0; i < vals.number_of_elements(); ++i)
+    {
+        vals[i] = 2.0 * vals[i];
+    }
+    ascent.publish(data2);
+    ascent.execute(actions);
+    ascent.close();
+
+    // the second firing has to see the second publish
+    EXPECT_TRUE(conduit::utils::is_file(first_root_file));
+    ASSERT_TRUE(conduit::utils::is_file(second_root_file));
+    Node second;
+    conduit::relay::io::blueprint::load_mesh(second_root_file, second);
+    Node &dom = second.child(0);
+    EXPECT_EQ(dom["state/cycle"].to_int64(), 101);
+    Node diff_info;
+    EXPECT_FALSE(dom["fields/braid/values"].diff(data2["fields/braid/values"],
+                                                 diff_info,
+                                                 1e-12));
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_triggers, trigger_actions_file_change)
+{
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    string output_path = prepare_output_dir();
+    string output_a = conduit::utils::join_file_path(output_path,"tout_trigger_file_a");
+    string output_b = conduit::utils::join_file_path(output_path,"tout_trigger_file_b");
+    string file_a = conduit::utils::join_file_path(output_path,"trigger_file_a_actions.json");
+    string file_b = conduit::utils::join_file_path(output_path,"trigger_file_b_actions.json");
+    string root_a_100 = output_a + ".cycle_000100.root";
+    string root_a_101 = output_a + ".cycle_000101.root";
+    string root_b_101 = output_b + ".cycle_000101.root";
+    for(const string &file : {root_a_100, root_a_101, root_b_101})
+    {
+        if(conduit::utils::is_file(file))
+        {
+            conduit::utils::remove_file(file);
+        }
+    }
+
+    // each actions file writes to its own extract
+    const string files[2] = {file_a, file_b};
+    const string outputs[2] = {output_a, output_b};
+    for(int i = 0; i < 2; ++i)
+    {
+        Node trigger_actions;
+        conduit::Node &add_ext= trigger_actions.append();
+        add_ext["action"] = "add_extracts";
+        add_ext["extracts/e1/type"]  = "relay";
+        add_ext["extracts/e1/params/path"] = outputs[i];
+        add_ext["extracts/e1/params/protocol"] = "blueprint/mesh/hdf5";
+        trigger_actions.save(files[i], "json");
+    }
+
+    Ascent ascent;
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+
+    for(int i = 0; i < 2; ++i)
+    {
+        data["state/cycle"] = 100 + i;
+        Node actions;
+        conduit::Node &add_triggers= actions.append();
+        add_triggers["action"] = "add_triggers";
+        add_triggers["triggers/t1/params/condition"] = "1 == 1";
+        add_triggers["triggers/t1/params/actions_file"] = files[i];
+        ascent.publish(data);
+        ascent.execute(actions);
+    }
+    ascent.close();
+
+    // the second firing runs the actions of the new file only
+    EXPECT_TRUE(conduit::utils::is_file(root_a_100));
+    EXPECT_FALSE(conduit::utils::is_file(root_a_101));
+    EXPECT_TRUE(conduit::utils::is_file(root_b_101));
+}
+
 
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
@@ -13,14 +13,20 @@
 
 #include <dray/io/blueprint_reader.hpp>
 #include <dray/io/blueprint_low_order.hpp>
+#include <dray/data_model/structured_mesh.hpp>
+#include <dray/data_model/structured_field.hpp>
 #include <dray/filters/mesh_boundary.hpp>
+#include <dray/rendering/contour.hpp>
+#include <dray/rendering/slice_plane.hpp>
 #include <dray/rendering/surface.hpp>
 #include <dray/rendering/renderer.hpp>
+#include <dray/rendering/volume.hpp>
 
 #include <dray/utils/appstats.hpp>
 
 #include <dray/math.hpp>
 
+#include <cmath>
 #include <fstream>
 #include <stdlib.h>
 
@@ -133,6 +139,213 @@ void render_3d(conduit::Node &data, std::string name, double diff_perc = 0.05)
 
 }
 
+// the implicit mesh and field should match their explicit representation
+void check_structured(conduit::Node &data)
+{
+  dray::DataSet domain = dray::BlueprintLowOrder::import(data);
+
+  dray::StructuredMesh *mesh = dynamic_cast<dray::StructuredMesh*>(domain.mesh());
+  ASSERT_TRUE(mesh != nullptr);
+  dray::StructuredScalar *field
+    = dynamic_cast<dray::StructuredScalar*>(domain.field("braid"));
+  ASSERT_TRUE(field != nullptr);
+
+  std::shared_ptr<dray::Mesh> umesh = mesh->unstructured();
+  std::shared_ptr<dray::Field> ufield = field->unstructured();
+
+  EXPECT_EQ(mesh->cells(), umesh->cells());
+  EXPECT_EQ(mesh->dims(), umesh->dims());
+
+  dray::AABB<3> bounds = mesh->bounds();
+  dray::AABB<3> ubounds = umesh->bounds();
+  for(int i = 0; i < 3; ++i)
+  {
+    EXPECT_NEAR(bounds.m_ranges[i].min(), ubounds.m_ranges[i].min(), 1e-5);
+    EXPECT_NEAR(bounds.m_ranges[i].max(), ubounds.m_ranges[i].max(), 1e-5);
+  }
+
+  EXPECT_NEAR(field->range()[0].min(), ufield->range()[0].min(), 1e-5);
+  EXPECT_NEAR(field->range()[0].max(), ufield->range()[0].max(), 1e-5);
+
+  // sample a lattice that does not line up with the cells
+  const int samples = 7;
+  dray::Array<dray::Vec<dray::Float,3>> points;
+  points.resize(samples * samples * samples);
+  dray::Vec<dray::Float,3> *points_ptr = points.get_host_ptr();
+  int idx = 0;
+  for(int k = 0; k < samples; ++k)
+    for(int j = 0; j < samples; ++j)
+      for(int i = 0; i < samples; ++i)
+      {
+        dray::Vec<dray::Float,3> point;
+        point[0] = bounds.m_ranges[0].min() + bounds.m_ranges[0].length() * (i + 0.37f) / samples;
+        point[1] = bounds.m_ranges[1].min() + bounds.m_ranges[1].length() * (j + 0.37f) / samples;
+        point[2] = bounds.m_ranges[2].min() + bounds.m_ranges[2].length() * (k + 0.37f) / samples;
+        points_ptr[idx++] = point;
+      }
+
+  dray::Array<dray::Location> locs = mesh->locate(points);
+  dray::Array<dray::Location> ulocs = umesh->locate(points);
+
+  dray::Array<dray::Float> values;
+  dray::Array<dray::Float> uvalues;
+  field->eval(locs, values);
+  ufield->eval(ulocs, uvalues);
+
+  const dray::Location *locs_ptr = locs.get_host_ptr_const();
+  const dray::Location *ulocs_ptr = ulocs.get_host_ptr_const();
+  const dray::Float *values_ptr = values.get_host_ptr_const();
+  const dray::Float *uvalues_ptr = uvalues.get_host_ptr_const();
+  for(int i = 0; i < points.size(); ++i)
+  {
+    EXPECT_EQ(locs_ptr[i].m_cell_id, ulocs_ptr[i].m_cell_id);
+    EXPECT_NEAR(values_ptr[i], uvalues_ptr[i], 1e-3);
+  }
+}
+
+// the braid of the implicit domain on its explicit representation
+dray::Collection explicit_collection(dray::DataSet &domain)
+{
+  dray::StructuredMesh *mesh = dynamic_cast<dray::StructuredMesh*>(domain.mesh());
+  dray::StructuredScalar *field
+    = dynamic_cast<dray::StructuredScalar*>(domain.field("braid"));
+  dray::DataSet explicit_domain(mesh->unstructured());
+  explicit_domain.add_field(field->unstructured());
+  dray::Collection collection;
+  collection.add_domain(explicit_domain);
+  return collection;
+}
+
+dray::Camera structured_camera(dray::Collection &collection)
+{
+  dray::Camera camera;
+  camera.set_width (256);
+  camera.set_height (256);
+  camera.reset_to_bounds (collection.bounds());
+  camera.azimuth (30);
+  camera.elevate (20);
+  return camera;
+}
+
+// the native structured paths and the explicit elements only differ
+// by rounding, which changes a few pixels on cell and mesh boundaries
+void expect_same_image(dray::Framebuffer &expected, dray::Framebuffer &actual)
+{
+  dray::Array<dray::Vec<dray::float32,4>> expected_colors = expected.colors();
+  dray::Array<dray::Vec<dray::float32,4>> actual_colors = actual.colors();
+  ASSERT_EQ(expected_colors.size(), actual_colors.size());
+  const dray::Vec<dray::float32,4> *expected_ptr = expected_colors.get_host_ptr();
+  const dray::Vec<dray::float32,4> *actual_ptr = actual_colors.get_host_ptr();
+  const int size = expected_colors.size();
+  int differ = 0;
+  int colored = 0;
+  for(int i = 0; i < size; ++i)
+  {
+    bool same = true;
+    for(int c = 0; c < 4; ++c)
+    {
+      same &= std::abs(expected_ptr[i][c] - actual_ptr[i][c]) < 1e-2f;
+    }
+    differ += same ? 0 : 1;
+    colored += expected_ptr[i][3] > 0.f ? 1 : 0;
+  }
+  EXPECT_TRUE(colored > 0);
+  EXPECT_LE(differ, size / 100);
+}
+
+// renders the implicit domain and its explicit representation with
+// the traceable made by make_traceable and compares the images
+template<typename MakeTraceable>
+void check_structured_render(conduit::Node &data, MakeTraceable make_traceable)
+{
+  dray::DataSet domain = dray::BlueprintLowOrder::import(data);
+  ASSERT_TRUE(dynamic_cast<dray::StructuredMesh*>(domain.mesh()) != nullptr);
+  dray::Collection structured;
+  structured.add_domain(domain);
+  dray::Collection unstructured = explicit_collection(domain);
+
+  dray::Camera camera = structured_camera(structured);
+
+  dray::Renderer structured_renderer;
+  structured_renderer.add(make_traceable(structured));
+  dray::Framebuffer structured_fb = structured_renderer.render(camera);
+
+  dray::Renderer unstructured_renderer;
+  unstructured_renderer.add(make_traceable(unstructured));
+  dray::Framebuffer unstructured_fb = unstructured_renderer.render(camera);
+
+  expect_same_image(unstructured_fb, structured_fb);
+}
+
+void check_structured_volume(conduit::Node &data)
+{
+  dray::ColorTable color_table ("cool2warm");
+  color_table.add_alpha (0.f, 0.0f);
+  color_table.add_alpha (0.5f, 0.1f);
+  color_table.add_alpha (1.0f, 0.8f);
+
+  dray::DataSet domain = dray::BlueprintLowOrder::import(data);
+  dray::Collection structured;
+  structured.add_domain(domain);
+  dray::Collection unstructured = explicit_collection(domain);
+  dray::Camera camera = structured_camera(structured);
+
+  dray::Framebuffer fbs[2];
+  dray::Collection *collections[2] = {&unstructured, &structured};
+  for(int i = 0; i < 2; ++i)
+  {
+    std::shared_ptr<dray::Volume> volume
+      = std::make_shared<dray::Volume>(*collections[i]);
+    volume->field("braid");
+    volume->samples(100);
+    volume->use_lighting(false);
+    volume->color_map().color_table(color_table);
+
+    dray::Renderer renderer;
+    renderer.volume(volume);
+    fbs[i] = renderer.render(camera);
+  }
+  expect_same_image(fbs[0], fbs[1]);
+}
+
+void check_structured_slice(conduit::Node &data)
+{
+  check_structured_render(data, [](dray::Collection &collection)
+  {
+    // a plane through the middle that cuts the cells at an angle
+    dray::AABB<3> bounds = collection.bounds();
+    dray::Vec<dray::float32,3> point;
+    for(int i = 0; i < 3; ++i)
+    {
+      point[i] = bounds.m_ranges[i].center();
+    }
+    dray::Vec<dray::float32,3> normal = {{1.f, 0.5f, 0.25f}};
+    normal.normalize();
+
+    std::shared_ptr<dray::SlicePlane> slicer
+      = std::make_shared<dray::SlicePlane>(collection);
+    slicer->field("braid");
+    slicer->point(point);
+    slicer->normal(normal);
+    return slicer;
+  });
+}
+
+// isosurfaces have no native structured path and dispatch to the
+// explicit elements built for the call
+void check_structured_contour(conduit::Node &data)
+{
+  check_structured_render(data, [](dray::Collection &collection)
+  {
+    std::shared_ptr<dray::Contour> contour
+      = std::make_shared<dray::Contour>(collection);
+    contour->field("braid");
+    contour->iso_field("braid");
+    contour->iso_value(1.f);
+    return contour;
+  });
+}
+
 TEST (dray_low_order, dray_uniform_quads)
 {
 
@@ -224,3 +437,52 @@ TEST (dray_low_order, dray_structured_hexs)
 
   render_3d(data, "structured_hexs");
 }
+
+
+TEST (dray_low_order, dray_implicit_uniform)
+{
+  conduit::Node data;
+  conduit::blueprint::mesh::examples::braid("uniform",
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             data);
+  check_structured(data);
+}
+
+TEST (dray_low_order, dray_implicit_rectilinear)
+{
+  conduit::Node data;
+  conduit::blueprint::mesh::examples::braid("rectilinear",
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             data);
+  check_structured(data);
+}
+
+TEST (dray_low_order, dray_implicit_uniform_render)
+{
+  conduit::Node data;
+  conduit::blueprint::mesh::examples::braid("uniform",
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             data);
+  check_structured_volume(data);
+  check_structured_slice(data);
+  check_structured_contour(data);
+}
+
+TEST (dray_low_order, dray_implicit_rectilinear_render)
+{
+  conduit::Node data;
+  conduit::blueprint::mesh::examples::braid("rectilinear",
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             EXAMPLE_MESH_SIDE_DIM,
+                                             data);
+  check_structured_volume(data);
+  check_structured_slice(data);
+  check_structured_contour(data);
+}
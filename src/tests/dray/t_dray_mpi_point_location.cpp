@@ -0,0 +1,123 @@
+// Copyright 2019 Lawrence Livermore National Security, LLC and other
+// Devil Ray Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+#include <dray/dray.hpp>
+#include <mpi.h>
+
+#include "t_utils.hpp"
+#include <dray/io/blueprint_low_order.hpp>
+#include <dray/queries/point_location.hpp>
+
+#include <conduit_blueprint.hpp>
+
+using namespace dray;
+
+//---------------------------------------------------------------------------//
+// a 2x2x2 uniform block of unit cells starting at x = 2 * dom_id with a
+// vertex field that is the domain id everywhere, so the value found on
+// a face shared by two domains tells which domain won the tie
+DataSet
+make_block(const int dom_id)
+{
+  conduit::Node n_dom;
+  n_dom["coordsets/coords/type"] = "uniform";
+  n_dom["coordsets/coords/dims/i"] = 3;
+  n_dom["coordsets/coords/dims/j"] = 3;
+  n_dom["coordsets/coords/dims/k"] = 3;
+  n_dom["coordsets/coords/origin/x"] = 2.0 * dom_id;
+  n_dom["coordsets/coords/origin/y"] = 0.0;
+  n_dom["coordsets/coords/origin/z"] = 0.0;
+  n_dom["coordsets/coords/spacing/dx"] = 1.0;
+  n_dom["coordsets/coords/spacing/dy"] = 1.0;
+  n_dom["coordsets/coords/spacing/dz"] = 1.0;
+  n_dom["topologies/mesh/type"] = "uniform";
+  n_dom["topologies/mesh/coordset"] = "coords";
+  n_dom["fields/dom_id/association"] = "vertex";
+  n_dom["fields/dom_id/topology"] = "mesh";
+  n_dom["fields/dom_id/values"].set(conduit::DataType::float64(27));
+  conduit::float64_array vals = n_dom["fields/dom_id/values"].value();
+  vals.fill(static_cast<conduit::float64>(dom_id));
+
+  conduit::Node info;
+  EXPECT_TRUE(conduit::blueprint::mesh::verify(n_dom, info));
+  return BlueprintLowOrder::import(n_dom);
+}
+
+//---------------------------------------------------------------------------//
+TEST (dray_mpi_point_location, shared_face_ties)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  ::dray::dray::mpi_comm(MPI_Comm_c2f(comm));
+
+  const int rank = ::dray::dray::mpi_rank();
+  const int size = ::dray::dray::mpi_size();
+
+  // two domains per rank so ties are resolved both between local
+  // domains and between ranks
+  const int num_domains = size * 2;
+  Collection collection;
+  collection.add_domain(make_block(rank * 2));
+  collection.add_domain(make_block(rank * 2 + 1));
+
+  // for each domain: one interior point and one point on its
+  // max x face, plus a point outside of everything
+  const int num_points = num_domains * 2 + 1;
+  Array<Vec<Float,3>> points;
+  points.resize(num_points);
+  Vec<Float,3> *points_ptr = points.get_host_ptr();
+  for(int d = 0; d < num_domains; ++d)
+  {
+    points_ptr[d * 2] = {{Float(2 * d) + 0.5f, 0.5f, 1.5f}};
+    points_ptr[d * 2 + 1] = {{Float(2 * d + 2), 1.f, 1.f}};
+  }
+  points_ptr[num_points - 1] = {{-5.f, 1.f, 1.f}};
+
+  const Float empty_val = -1.f;
+  PointLocation locator;
+  locator.empty_val(empty_val);
+  locator.add_var("dom_id");
+  PointLocation::Result res = locator.execute(collection, points);
+
+  ASSERT_EQ(res.m_values.size(), 1u);
+  ASSERT_EQ(res.m_values[0].size(), static_cast<size_t>(num_points));
+  const Float *values_ptr = res.m_values[0].get_host_ptr_const();
+
+  for(int d = 0; d < num_domains; ++d)
+  {
+    // interior points only live in one domain
+    EXPECT_NEAR(values_ptr[d * 2], Float(d), 1e-5f);
+    // the face shared by domains d and d + 1 goes to the larger value.
+    // The last face is on the boundary and only found by domain d
+    const Float expected = d + 1 < num_domains ? Float(d + 1) : Float(d);
+    EXPECT_NEAR(values_ptr[d * 2 + 1], expected, 1e-5f);
+  }
+  EXPECT_EQ(values_ptr[num_points - 1], empty_val);
+
+  // every rank must end up with the same answer
+  std::vector<Float> mine(values_ptr, values_ptr + num_points);
+  std::vector<Float> root(mine);
+  MPI_Bcast(root.data(),
+            num_points * sizeof(Float),
+            MPI_BYTE,
+            0,
+            comm);
+  for(int i = 0; i < num_points; ++i)
+  {
+    EXPECT_EQ(mine[i], root[i]);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+    result = RUN_ALL_TESTS();
+    MPI_Finalize();
+
+    return result;
+}
@@ -9,14 +9,23 @@
 #include "t_utils.hpp"
 #include "t_config.hpp"
 
+#include <conduit_blueprint.hpp>
+
 #include <dray/io/blueprint_reader.hpp>
+#include <dray/io/blueprint_low_order.hpp>
 
+#include <dray/filters/mesh_boundary.hpp>
 #include <dray/filters/vector_component.hpp>
+#include <dray/rendering/domain_bvh.hpp>
 #include <dray/rendering/renderer.hpp>
 #include <dray/rendering/slice_plane.hpp>
+#include <dray/rendering/surface.hpp>
 #include <dray/rendering/contour.hpp>
 #include <dray/rendering/volume.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 //---------------------------------------------------------------------------//
 bool
 mfem_enabled()
@@ -113,3 +122,168 @@ TEST (dray_multi_render, dray_simple)
    // note: dray diff tolerance was 0.2f prior to import
   EXPECT_TRUE (check_test_image (output_file,dray_baselines_dir(),0.05));
 }
+
+//---------------------------------------------------------------------------//
+// builds a 2x2 tiling of braid hex domains so rays looking down
+// the z axis only cross one column of domains
+dray::Collection
+tiled_braid_collection()
+{
+  dray::Collection collection;
+  const int dim = 10;
+  for(int j = 0; j < 2; ++j)
+  {
+    for(int i = 0; i < 2; ++i)
+    {
+      conduit::Node data;
+      conduit::blueprint::mesh::examples::braid("hexs", dim, dim, dim, data);
+      // braid spans [-10,10] in every direction
+      conduit::float64_array x = data["coordsets/coords/values/x"].value();
+      conduit::float64_array y = data["coordsets/coords/values/y"].value();
+      for(conduit::index_t p = 0; p < x.number_of_elements(); ++p)
+      {
+        x[p] += 20. * i;
+        y[p] += 20. * j;
+      }
+      dray::DataSet domain = dray::BlueprintLowOrder::import(data);
+      dray::MeshBoundary boundary;
+      dray::Collection single;
+      single.add_domain(domain);
+      dray::Collection faces = boundary.execute(single);
+      collection.add_domain(faces.domain(0));
+    }
+  }
+  return collection;
+}
+
+TEST (dray_multi_render, dray_domain_bvh)
+{
+  dray::Collection collection = tiled_braid_collection();
+  const int num_domains = collection.local_size();
+  ASSERT_EQ(num_domains, 4);
+
+  dray::Camera camera;
+  camera.set_width (128);
+  camera.set_height (128);
+  camera.reset_to_bounds(collection.bounds());
+
+  dray::Array<dray::Ray> rays;
+  camera.create_rays (rays);
+
+  dray::DomainBVH domain_bvh(collection);
+  EXPECT_TRUE(domain_bvh.valid());
+
+  std::vector<dray::Array<dray::int32>> ray_ids;
+  domain_bvh.bin_rays(rays, ray_ids);
+  ASSERT_EQ(ray_ids.size(), num_domains);
+
+  // looking down z, no domain should see every ray
+  for(int d = 0; d < num_domains; ++d)
+  {
+    EXPECT_LT(ray_ids[d].size(), rays.size());
+  }
+
+  // every ray that crosses the bounds of a domain has to be binned
+  const dray::Ray *ray_ptr = rays.get_host_ptr_const();
+  for(int d = 0; d < num_domains; ++d)
+  {
+    dray::AABB<3> bounds = collection.domain(d).mesh()->bounds();
+    std::vector<bool> binned(rays.size(), false);
+    const dray::int32 *ids_ptr = ray_ids[d].get_host_ptr_const();
+    for(int i = 0; i < ray_ids[d].size(); ++i)
+    {
+      binned[ids_ptr[i]] = true;
+    }
+
+    for(int i = 0; i < rays.size(); ++i)
+    {
+      const dray::Ray &ray = ray_ptr[i];
+      float tmin = ray.m_near;
+      float tmax = ray.m_far;
+      for(int a = 0; a < 3; ++a)
+      {
+        const float inv = 1.f / ray.m_dir[a];
+        float t0 = (bounds.m_ranges[a].min() - ray.m_orig[a]) * inv;
+        float t1 = (bounds.m_ranges[a].max() - ray.m_orig[a]) * inv;
+        if(t0 > t1) std::swap(t0, t1);
+        tmin = std::max(tmin, t0);
+        tmax = std::min(tmax, t1);
+      }
+      if(tmax > tmin)
+      {
+        EXPECT_TRUE(binned[i]);
+      }
+    }
+  }
+
+  // every domain appears once in the traversal order
+  std::vector<dray::int32> order = domain_bvh.front_to_back(camera.get_pos());
+  std::sort(order.begin(), order.end());
+  for(int d = 0; d < num_domains; ++d)
+  {
+    EXPECT_EQ(order[d], d);
+  }
+}
+
+TEST (dray_multi_render, dray_domain_bvh_render)
+{
+  dray::Collection collection = tiled_braid_collection();
+
+  dray::Camera camera;
+  camera.set_width (256);
+  camera.set_height (256);
+  camera.reset_to_bounds(collection.bounds());
+  camera.azimuth(-30);
+  camera.elevate(-30);
+
+  dray::ColorTable color_table ("cool2warm");
+  std::shared_ptr<dray::Surface> surface
+    = std::make_shared<dray::Surface>(collection);
+  surface->field("braid");
+  surface->color_map().color_table(color_table);
+
+  dray::Renderer renderer;
+  renderer.add(surface);
+  renderer.color_bar(false);
+
+  dray::Framebuffer culled = renderer.render(camera);
+  // the domains are disjoint, so some rays must have been skipped
+  EXPECT_GT(renderer.culled_rays(), 0);
+
+  renderer.domain_culling(false);
+  dray::Framebuffer unculled = renderer.render(camera);
+  EXPECT_EQ(renderer.culled_rays(), 0);
+
+  dray::Array<dray::Vec<dray::float32,4>> culled_colors = culled.colors();
+  dray::Array<dray::Vec<dray::float32,4>> unculled_colors = unculled.colors();
+  dray::Array<dray::float32> culled_depths = culled.depths();
+  dray::Array<dray::float32> unculled_depths = unculled.depths();
+  ASSERT_EQ(culled_colors.size(), unculled_colors.size());
+
+  const dray::Vec<dray::float32,4> *c_ptr = culled_colors.get_host_ptr_const();
+  const dray::Vec<dray::float32,4> *u_ptr = unculled_colors.get_host_ptr_const();
+  const dray::float32 *cd_ptr = culled_depths.get_host_ptr_const();
+  const dray::float32 *ud_ptr = unculled_depths.get_host_ptr_const();
+  const int size = culled_colors.size();
+  int diffs = 0;
+  int hits = 0;
+  for(int i = 0; i < size; ++i)
+  {
+    if(ud_ptr[i] != dray::infinity32())
+    {
+      hits++;
+    }
+    bool same = cd_ptr[i] == ud_ptr[i];
+    for(int c = 0; c < 4; ++c)
+    {
+      same = same && std::abs(c_ptr[i][c] - u_ptr[i][c]) < 1e-5f;
+    }
+    if(!same)
+    {
+      diffs++;
+    }
+  }
+  EXPECT_GT(hits, 0);
+  // only ties on the seams between domains may resolve differently
+  EXPECT_LT(diffs, size / 200);
+}
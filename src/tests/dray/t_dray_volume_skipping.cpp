@@ -0,0 +1,137 @@
+// Copyright 2019 Lawrence Livermore National Security, LLC and other
+// Devil Ray Developers. See the top-level COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+
+#include "gtest/gtest.h"
+
+#include "t_utils.hpp"
+#include "t_config.hpp"
+
+#include <conduit_blueprint.hpp>
+
+#include <dray/io/blueprint_low_order.hpp>
+#include <dray/rendering/renderer.hpp>
+#include <dray/rendering/volume.hpp>
+#include <dray/math.hpp>
+
+#include <cmath>
+
+const int EXAMPLE_MESH_SIDE_DIM = 20;
+
+// transparent over the lower half of the field range
+dray::ColorTable half_transparent_table()
+{
+  dray::ColorTable color_table ("cool2warm");
+  color_table.add_alpha (0.f, 0.0f);
+  color_table.add_alpha (0.5f, 0.0f);
+  color_table.add_alpha (0.6f, 0.3f);
+  color_table.add_alpha (1.0f, 0.8f);
+  return color_table;
+}
+
+// renders the braid field with skipping on or off and returns the
+// number of samples the volume skipped
+int render_braid(dray::Collection &dataset,
+                 const dray::ColorTable &color_table,
+                 bool skip_empty_space,
+                 dray::Array<dray::Vec<dray::float32,4>> &colors)
+{
+  dray::Camera camera;
+  camera.set_width (256);
+  camera.set_height (256);
+  camera.reset_to_bounds (dataset.bounds());
+  camera.azimuth (30);
+  camera.elevate (20);
+
+  std::shared_ptr<dray::Volume> volume
+    = std::make_shared<dray::Volume>(dataset);
+  volume->field("braid");
+  volume->samples(100);
+  volume->use_lighting(false);
+  volume->color_map().color_table(color_table);
+  volume->skip_empty_space(skip_empty_space);
+
+  dray::Renderer renderer;
+  renderer.volume(volume);
+  dray::Framebuffer fb = renderer.render(camera);
+  colors = fb.colors();
+  return volume->skipped_samples();
+}
+
+// skipping keeps the samples on the same positions, so the only
+// differences come from rounding where a ray leaves the mesh
+void expect_same_image(dray::Array<dray::Vec<dray::float32,4>> &expected,
+                       dray::Array<dray::Vec<dray::float32,4>> &actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  const dray::Vec<dray::float32,4> *expected_ptr = expected.get_host_ptr();
+  const dray::Vec<dray::float32,4> *actual_ptr = actual.get_host_ptr();
+  const int size = expected.size();
+  int differ = 0;
+  int colored = 0;
+  for(int i = 0; i < size; ++i)
+  {
+    bool same = true;
+    for(int c = 0; c < 4; ++c)
+    {
+      same &= std::abs(expected_ptr[i][c] - actual_ptr[i][c]) < 1e-3f;
+    }
+    differ += same ? 0 : 1;
+    colored += expected_ptr[i][3] > 0.f ? 1 : 0;
+  }
+  EXPECT_TRUE(colored > 0);
+  EXPECT_LE(differ, size / 1000);
+}
+
+void check_skipping(conduit::Node &data)
+{
+  dray::DataSet domain = dray::BlueprintLowOrder::import(data);
+  dray::Collection dataset;
+  dataset.add_domain(domain);
+
+  dray::ColorTable color_table = half_transparent_table();
+
+  dray::Array<dray::Vec<dray::float32,4>> skipped_colors;
+  dray::Array<dray::Vec<dray::float32,4>> full_colors;
+  const int skipped = render_braid(dataset, color_table, true, skipped_colors);
+  const int not_skipped = render_braid(dataset, color_table, false, full_colors);
+
+  EXPECT_GT(skipped, 0);
+  EXPECT_EQ(not_skipped, 0);
+  expect_same_image(full_colors, skipped_colors);
+
+  // nothing is transparent, so nothing is skipped
+  dray::ColorTable opaque_table ("cool2warm");
+  opaque_table.add_alpha (0.f, 0.2f);
+  opaque_table.add_alpha (1.0f, 0.8f);
+  dray::Array<dray::Vec<dray::float32,4>> opaque_colors;
+  EXPECT_EQ(render_braid(dataset, opaque_table, true, opaque_colors), 0);
+}
+
+//---------------------------------------------------------------------------//
+TEST (dray_volume_skipping, dray_skip_macrocells)
+{
+  // uniform meshes skip whole macrocells
+  conduit::Node data;
+  conduit::blueprint::mesh::examples::braid("uniform",
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            data);
+  check_skipping(data);
+}
+
+//---------------------------------------------------------------------------//
+TEST (dray_volume_skipping, dray_skip_cells)
+{
+  // unstructured meshes skip one sample at a time
+  conduit::Node data;
+  conduit::blueprint::mesh::examples::braid("hexs",
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            data);
+  check_skipping(data);
+}
@@ -12,6 +12,7 @@
 
 #include "gtest/gtest.h"
 
+#include <Python.h>
 #include <flow.hpp>
 #include <flow_python_script_filter.hpp>
 
@@ -68,6 +69,44 @@ public:
 };
 
 
+//-----------------------------------------------------------------------------
+// records the integer result of a python script and the value of the
+// source node, which is still alive while its consumers execute
+class CaptureFilter: public Filter
+{
+public:
+    static long m_py_value;
+    static int  m_src_value;
+
+    CaptureFilter()
+    : Filter()
+    {}
+
+    virtual ~CaptureFilter()
+    {}
+
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "capture";
+        i["output_port"] = "false";
+        i["port_names"].append() = "py";
+        i["port_names"].append() = "src";
+    }
+
+
+    virtual void execute()
+    {
+        PyObject *py_res = input<PyObject>("py");
+        m_py_value = PyLong_AsLong(py_res);
+        m_src_value = input<Node>("src")->to_int32();
+    }
+};
+
+long CaptureFilter::m_py_value = 0;
+int  CaptureFilter::m_src_value = 0;
+
+
 //-----------------------------------------------------------------------------
 TEST(flow_python_script_filter, simple_execute)
 {
@@ -337,3 +376,135 @@ TEST(flow_python_script_filter, exe_override_interface_mod_and_func_names)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(flow_python_script_filter, warm_execute)
+{
+    flow::filters::register_builtin();
+
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<CaptureFilter>();
+
+    Workspace w;
+
+    Node src_params;
+    src_params["value"] = 21;
+
+    w.graph().add_filter("src","v",src_params);
+
+    // the script body only runs once, later executes just call the function
+    Node py_params;
+    py_params["source"] = "flow_warm_setups = globals().get('flow_warm_setups', 0) + 1\n"
+                          "def flow_warm_execute():\n"
+                          "    assert flow_warm_setups == 1\n"
+                          "    val = flow_input().value() * 2\n"
+                          "    assert val == 42\n"
+                          "    flow_set_output(val)\n";
+    py_params["interface/execute"] = "flow_warm_execute";
+
+    w.graph().add_filter("python_script","py", py_params);
+
+    w.graph().add_filter("capture","cap");
+
+    // // src, dest, port
+    w.graph().connect("v","py","in");
+    w.graph().connect("py","cap","py");
+    w.graph().connect("v","cap","src");
+
+    for(int i = 0; i < 3; ++i)
+    {
+        CaptureFilter::m_py_value = 0;
+        w.execute();
+        EXPECT_EQ(CaptureFilter::m_py_value, 42);
+    }
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(flow_python_script_filter, view_input)
+{
+    flow::filters::register_builtin();
+
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<CaptureFilter>();
+
+    Workspace w;
+
+    Node src_params;
+    src_params["value"] = 21;
+
+    w.graph().add_filter("src","v",src_params);
+
+    Node py_params;
+    py_params["source"] = "flow_set_output(flow_input().value() * 2)\n";
+    py_params["input_mode"] = "view";
+
+    w.graph().add_filter("python_script","py", py_params);
+
+    // runs after "py", which must have let go of its input
+    Node check_params;
+    check_params["source"] = "assert flow_script_filter._flow_input is None\n"
+                             "assert flow_script_filter._flow_output is None\n"
+                             "flow_check_set_output(flow_check_input())\n";
+    check_params["interface/module"] = "flow_check";
+    check_params["interface/input"] = "flow_check_input";
+    check_params["interface/set_output"] = "flow_check_set_output";
+
+    w.graph().add_filter("python_script","check", check_params);
+
+    w.graph().add_filter("capture","cap");
+
+    // // src, dest, port
+    w.graph().connect("v","py","in");
+    w.graph().connect("py","check","in");
+    w.graph().connect("check","cap","py");
+    w.graph().connect("v","cap","src");
+
+    w.execute();
+
+    EXPECT_EQ(CaptureFilter::m_py_value, 42);
+    EXPECT_EQ(CaptureFilter::m_src_value, 21);
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(flow_python_script_filter, copy_input)
+{
+    flow::filters::register_builtin();
+
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<CaptureFilter>();
+
+    Workspace w;
+
+    Node src_params;
+    src_params["value"] = 21;
+
+    w.graph().add_filter("src","v",src_params);
+
+    Node py_params;
+    py_params["source"] = "n = flow_input()\n"
+                          "n.set(n.value() * 2)\n"
+                          "assert n.value() == 42\n"
+                          "flow_set_output(n.value())\n";
+    py_params["input_mode"] = "copy";
+
+    w.graph().add_filter("python_script","py", py_params);
+
+    w.graph().add_filter("capture","cap");
+
+    // // src, dest, port
+    w.graph().connect("v","py","in");
+    w.graph().connect("py","cap","py");
+    w.graph().connect("v","cap","src");
+
+    w.execute();
+
+    EXPECT_EQ(CaptureFilter::m_py_value, 42);
+    // the script changed its copy, not the source
+    EXPECT_EQ(CaptureFilter::m_src_value, 21);
+
+    Workspace::clear_supported_filter_types();
+}
@@ -158,6 +158,87 @@ public:
 };
 
 
+//-----------------------------------------------------------------------------
+class ThreadSafeAddFilter: public Filter
+{
+public:
+    ThreadSafeAddFilter()
+    : Filter()
+    {}
+
+    virtual ~ThreadSafeAddFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "ts_add";
+        i["output_port"] = "true";
+        i["thread_safe"] = "true";
+        i["port_names"].append().set("a");
+        i["port_names"].append().set("b");
+    }
+
+    virtual void execute()
+    {
+        Node *a_in = input<Node>("a");
+        Node *b_in = input<Node>("b");
+
+        if(a_in->to_int() < 0)
+        {
+            CONDUIT_ERROR("ts_add: negative input");
+        }
+
+        Node *res = new Node();
+        res->set(a_in->to_int() + b_in->to_int());
+        set_output<Node>(res);
+    }
+
+};
+
+
+//-----------------------------------------------------------------------------
+class CachedIncFilter: public Filter
+{
+public:
+    static int num_executes;
+
+    CachedIncFilter()
+    : Filter()
+    {}
+
+    virtual ~CachedIncFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "cached_inc";
+        i["output_port"] = "true";
+        i["port_names"].append().set("in");
+        i["default_params"]["inc"].set((int)1);
+    }
+
+    virtual bool cache_signature(Node &sig)
+    {
+        sig["params"] = params();
+        return true;
+    }
+
+    virtual void execute()
+    {
+        num_executes++;
+        int inc  = params()["inc"].value();
+        Node *in = input<Node>("in");
+
+        Node *res = new Node();
+        res->set(in->to_int() + inc);
+        set_output<Node>(res);
+    }
+
+};
+
+int CachedIncFilter::num_executes = 0;
+
+
 
 
 //-----------------------------------------------------------------------------
@@ -752,3 +833,207 @@ TEST(ascent_flow_workspace, dag_graph_missing_input_error)
 
     Workspace::clear_supported_filter_types();
 }
+
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, dag_graph_parallel_exec)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<AddFilter>();
+    Workspace::register_filter_type<ThreadSafeAddFilter>();
+
+    Workspace w;
+    w.enable_parallel_execution(true);
+    w.set_number_of_threads(4);
+    EXPECT_TRUE(w.parallel_execution_enabled());
+    EXPECT_EQ(w.number_of_threads(),4);
+
+    Node p_vs;
+    p_vs["value"].set(int(10));
+
+    w.graph().add_filter("src","v1",p_vs);
+    w.graph().add_filter("src","v2",p_vs);
+
+    // independent thread safe branches
+    const int num_branches = 16;
+    for(int i = 0; i < num_branches; i++)
+    {
+        std::ostringstream oss;
+        oss << "b" << i;
+        w.graph().add_filter("ts_add",oss.str());
+        w.graph().connect("v1",oss.str(),"a");
+        w.graph().connect("v2",oss.str(),"b");
+    }
+
+    // serial (non thread safe) reduction of the branches
+    w.graph().add_filter("add","r0");
+    w.graph().connect("b0","r0","a");
+    w.graph().connect("b1","r0","b");
+    for(int i = 2; i < num_branches; i++)
+    {
+        std::ostringstream oss_prev, oss_curr, oss_b;
+        oss_prev << "r" << i-2;
+        oss_curr << "r" << i-1;
+        oss_b    << "b" << i;
+        w.graph().add_filter("add",oss_curr.str());
+        w.graph().connect(oss_prev.str(),oss_curr.str(),"a");
+        w.graph().connect(oss_b.str(),oss_curr.str(),"b");
+    }
+
+    w.execute();
+
+    std::ostringstream oss_res;
+    oss_res << "r" << num_branches - 2;
+    Node *res = w.registry().fetch<Node>(oss_res.str());
+    EXPECT_EQ(res->to_int(),20 * num_branches);
+    w.registry().consume(oss_res.str());
+
+    // results should match serial execution
+    w.enable_parallel_execution(false);
+    w.execute();
+    res = w.registry().fetch<Node>(oss_res.str());
+    EXPECT_EQ(res->to_int(),20 * num_branches);
+    w.registry().consume(oss_res.str());
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, dag_graph_parallel_exec_error)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<ThreadSafeAddFilter>();
+
+    Workspace w;
+    w.enable_parallel_execution(true);
+    w.set_number_of_threads(4);
+
+    Node p_vs;
+    p_vs["value"].set(int(-1));
+
+    w.graph().add_filter("src","v1",p_vs);
+    w.graph().add_filter("src","v2",p_vs);
+    w.graph().add_filter("ts_add","a1");
+    w.graph().add_filter("ts_add","a2");
+    w.graph().connect("v1","a1","a");
+    w.graph().connect("v2","a1","b");
+    w.graph().connect("v2","a2","a");
+    w.graph().connect("v1","a2","b");
+
+    // errors thrown on worker threads are forwarded
+    EXPECT_THROW(w.execute(),conduit::Error);
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, linear_graph_output_caching)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<CachedIncFilter>();
+
+    Workspace w;
+    w.enable_output_caching(true);
+    EXPECT_TRUE(w.output_caching_enabled());
+
+    w.graph().add_filter("src","s");
+    Filter *f_a = w.graph().add_filter("cached_inc","a");
+    w.graph().add_filter("cached_inc","b");
+
+    w.graph().connect("s","a","in");
+    w.graph().connect("a","b","in");
+
+    CachedIncFilter::num_executes = 0;
+    w.execute();
+    EXPECT_EQ(CachedIncFilter::num_executes,2);
+    EXPECT_EQ(w.number_of_cache_hits(),0);
+    EXPECT_EQ(w.registry().fetch<Node>("b")->to_int(),2);
+    w.registry().reset();
+
+    // nothing changed, both filters reuse their output
+    w.execute();
+    EXPECT_EQ(CachedIncFilter::num_executes,2);
+    EXPECT_EQ(w.number_of_cache_hits(),2);
+    EXPECT_EQ(w.registry().fetch<Node>("b")->to_int(),2);
+    w.registry().reset();
+
+    // changing a's params invalidates a and everything downstream
+    f_a->params()["inc"] = 10;
+    w.execute();
+    EXPECT_EQ(CachedIncFilter::num_executes,4);
+    EXPECT_EQ(w.number_of_cache_hits(),0);
+    EXPECT_EQ(w.registry().fetch<Node>("b")->to_int(),11);
+    w.registry().reset();
+
+    // disabling caching always executes
+    w.enable_output_caching(false);
+    w.execute();
+    EXPECT_EQ(CachedIncFilter::num_executes,6);
+    EXPECT_EQ(w.registry().fetch<Node>("b")->to_int(),11);
+    w.registry().consume("b");
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+class CountingProbe: public Workspace::PerformanceProbe
+{
+public:
+    CountingProbe()
+    : num_begins(0)
+    {}
+
+    virtual void begin(const Filter &)
+    {
+        num_begins++;
+    }
+
+    virtual void end(const Filter &f, Node &record)
+    {
+        record["probe/begins"] = num_begins;
+        record["probe/type"]   = f.type_name();
+    }
+
+    int num_begins;
+};
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, linear_graph_performance_records)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<CachedIncFilter>();
+
+    Workspace w;
+    CountingProbe probe;
+    w.enable_performance_records(true);
+    w.set_performance_probe(&probe);
+    w.enable_output_caching(true);
+    EXPECT_TRUE(w.performance_records_enabled());
+
+    w.graph().add_filter("src","s");
+    w.graph().add_filter("cached_inc","a");
+
+    w.graph().connect("s","a","in");
+
+    w.execute();
+    w.registry().reset();
+
+    const Node &rec = w.performance_record();
+    EXPECT_TRUE(rec.has_path("total/wall_time"));
+    EXPECT_EQ(rec["filters"].number_of_children(),2);
+    EXPECT_EQ(rec["filters/a/type"].as_string(),"cached_inc");
+    EXPECT_EQ(rec["filters/a/cached"].to_int(),0);
+    EXPECT_EQ(rec["filters/a/probe/type"].as_string(),"cached_inc");
+    EXPECT_EQ(probe.num_begins,2);
+
+    // a reuses its output, so the probe is not called for it
+    w.execute();
+    w.registry().reset();
+    EXPECT_EQ(w.performance_record()["filters/a/cached"].to_int(),1);
+    EXPECT_EQ(probe.num_begins,3);
+
+    w.enable_performance_records(false);
+    EXPECT_EQ(w.performance_record().number_of_children(),0);
+
+    Workspace::clear_supported_filter_types();
+}
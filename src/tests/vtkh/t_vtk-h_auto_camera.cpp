@@ -0,0 +1,80 @@
+//-----------------------------------------------------------------------------
+///
+/// file: t_vtk-h_auto_camera.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <vtkh/vtkh.hpp>
+#include <vtkh/DataSet.hpp>
+#include <vtkh/rendering/AutoCamera.hpp>
+#include "t_vtkm_test_utils.hpp"
+
+namespace
+{
+
+void run_auto_camera(vtkh::DataSet &data_set,
+                     int coarse_factor,
+                     int top_k,
+                     int seed,
+                     int &winner,
+                     double &score)
+{
+  vtkh::AutoCamera auto_cam;
+  auto_cam.SetInput(&data_set);
+  auto_cam.SetField("point_data_Float64");
+  auto_cam.SetMetric("dds_entropy");
+  auto_cam.SetNumSamples(20);
+  auto_cam.SetWidth(128);
+  auto_cam.SetHeight(128);
+  auto_cam.SetCoarseFactor(coarse_factor);
+  auto_cam.SetTopK(top_k);
+  auto_cam.SetSeedSample(seed);
+  auto_cam.Update();
+  winner = auto_cam.GetWinningSample();
+  score = auto_cam.GetWinningScore();
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
+TEST(vtkh_auto_camera, test_progressive_search)
+{
+#ifdef VTKM_ENABLE_KOKKOS
+  vtkh::InitializeKokkos();
+#endif
+  vtkh::DataSet data_set;
+
+  const int base_size = 32;
+  const int num_blocks = 2;
+
+  for(int i = 0; i < num_blocks; ++i)
+  {
+    data_set.AddDomain(CreateTestData(i, num_blocks, base_size), i);
+  }
+
+  int exhaustive_winner, progressive_winner, seeded_winner;
+  double exhaustive_score, progressive_score, seeded_score;
+  run_auto_camera(data_set, 1, 3, -1, exhaustive_winner, exhaustive_score);
+  run_auto_camera(data_set, 4, 3, -1, progressive_winner, progressive_score);
+
+  ASSERT_GE(exhaustive_winner, 0);
+  ASSERT_GE(progressive_winner, 0);
+
+  // the progressive search only scores a subset of the samples at
+  // full resolution, so it can never beat the exhaustive one
+  EXPECT_LE(progressive_score, exhaustive_score + 1e-9);
+  // and when the coarse ranking misses the winner, the view it
+  // picks has to be nearly as good
+  if(progressive_winner != exhaustive_winner)
+  {
+    EXPECT_GE(progressive_score, 0.95 * exhaustive_score);
+  }
+
+  // seeded with the exhaustive winner, the progressive search
+  // has to find it again
+  run_auto_camera(data_set, 4, 3, exhaustive_winner, seeded_winner, seeded_score);
+  EXPECT_EQ(seeded_winner, exhaustive_winner);
+  EXPECT_DOUBLE_EQ(seeded_score, exhaustive_score);
+}
@@ -0,0 +1,246 @@
+//-----------------------------------------------------------------------------
+///
+/// file: t_vtk-h_compositor.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <vtkh/vtkh.hpp>
+#include <vtkh/compositing/Compositor.hpp>
+#include <vtkh/compositing/Image.hpp>
+#include <vtkh/compositing/ImageCompositor.hpp>
+
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+//
+// color and depth buffers as a renderer would hand them over. Depths
+// cover the near plane, background (> 1), and negative values
+//
+struct Buffers
+{
+  std::vector<unsigned char> m_colors;
+  std::vector<float>         m_float_colors;
+  std::vector<float>         m_depths;
+};
+
+Buffers make_buffers(int width, int height, unsigned int seed)
+{
+  const int size = width * height;
+  Buffers buffers;
+  buffers.m_colors.resize(size * 4);
+  buffers.m_float_colors.resize(size * 4);
+  buffers.m_depths.resize(size);
+  for(int i = 0; i < size; ++i)
+  {
+    for(int c = 0; c < 4; ++c)
+    {
+      seed = seed * 1103515245u + 12345u;
+      buffers.m_colors[i * 4 + c] = static_cast<unsigned char>((seed >> 16) % 256);
+      buffers.m_float_colors[i * 4 + c] = buffers.m_colors[i * 4 + c] / 255.f;
+    }
+    seed = seed * 1103515245u + 12345u;
+    const int kind = (seed >> 16) % 8;
+    // a coarse depth grid so some depths tie between buffers
+    float depth = static_cast<float>((seed >> 20) % 16) / 16.f;
+    if(kind == 0)
+    {
+      depth = 1.5f;
+    }
+    else if(kind == 1)
+    {
+      depth = -depth - 0.25f;
+    }
+    buffers.m_depths[i] = depth;
+  }
+  return buffers;
+}
+
+void expect_same(const vtkh::Image &a, const vtkh::Image &b)
+{
+  ASSERT_EQ(a.m_pixels.size(), b.m_pixels.size());
+  ASSERT_EQ(a.m_depths.size(), b.m_depths.size());
+  for(size_t i = 0; i < a.m_pixels.size(); ++i)
+  {
+    EXPECT_EQ(a.m_pixels[i], b.m_pixels[i]) << "pixel component " << i;
+  }
+  for(size_t i = 0; i < a.m_depths.size(); ++i)
+  {
+    EXPECT_EQ(a.m_depths[i], b.m_depths[i]) << "depth " << i;
+  }
+}
+
+// the composite of the buffers through image copies, the way the
+// compositor worked before it composited raw buffers in place
+vtkh::Image reference_composite(const std::vector<Buffers> &inputs,
+                                int width,
+                                int height,
+                                bool float_colors)
+{
+  std::vector<vtkh::Image> images(inputs.size());
+  for(size_t i = 0; i < inputs.size(); ++i)
+  {
+    if(float_colors)
+    {
+      images[i].Init(&inputs[i].m_float_colors[0],
+                     &inputs[i].m_depths[0],
+                     width,
+                     height);
+    }
+    else
+    {
+      images[i].Init(&inputs[i].m_colors[0],
+                     &inputs[i].m_depths[0],
+                     width,
+                     height);
+    }
+  }
+  vtkh::ImageCompositor compositor;
+  compositor.ZBufferComposite(images);
+  return images[0];
+}
+
+vtkh::Image compositor_composite(const std::vector<Buffers> &inputs,
+                                 int width,
+                                 int height,
+                                 bool float_colors)
+{
+  vtkh::Compositor compositor;
+  compositor.SetCompositeMode(vtkh::Compositor::Z_BUFFER_SURFACE);
+  for(size_t i = 0; i < inputs.size(); ++i)
+  {
+    if(float_colors)
+    {
+      compositor.AddImage(&inputs[i].m_float_colors[0],
+                          &inputs[i].m_depths[0],
+                          width,
+                          height);
+    }
+    else
+    {
+      compositor.AddImage(&inputs[i].m_colors[0],
+                          &inputs[i].m_depths[0],
+                          width,
+                          height);
+    }
+  }
+  vtkh::Image result = compositor.Composite();
+  compositor.ClearImages();
+  return result;
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
+TEST(vtkh_compositor, raw_buffer_zbuffer_composite)
+{
+  const int width = 31;
+  const int height = 17;
+  Buffers front_buffers = make_buffers(width, height, 7);
+  Buffers back_buffers = make_buffers(width, height, 11);
+
+  for(int float_colors = 0; float_colors < 2; ++float_colors)
+  {
+    vtkh::Image front;
+    vtkh::Image back;
+    if(float_colors)
+    {
+      front.Init(&front_buffers.m_float_colors[0],
+                 &front_buffers.m_depths[0],
+                 width,
+                 height);
+      back.Init(&back_buffers.m_float_colors[0],
+                &back_buffers.m_depths[0],
+                width,
+                height);
+    }
+    else
+    {
+      front.Init(&front_buffers.m_colors[0],
+                 &front_buffers.m_depths[0],
+                 width,
+                 height);
+      back.Init(&back_buffers.m_colors[0],
+                &back_buffers.m_depths[0],
+                width,
+                height);
+    }
+
+    vtkh::Image expected = front;
+    vtkh::ImageCompositor compositor;
+    compositor.ZBufferComposite(expected, back);
+
+    vtkh::Image result = front;
+    if(float_colors)
+    {
+      compositor.ZBufferComposite(result,
+                                  &back_buffers.m_float_colors[0],
+                                  &back_buffers.m_depths[0]);
+    }
+    else
+    {
+      compositor.ZBufferComposite(result,
+                                  &back_buffers.m_colors[0],
+                                  &back_buffers.m_depths[0]);
+    }
+    expect_same(expected, result);
+  }
+}
+
+//----------------------------------------------------------------------------
+TEST(vtkh_compositor, pooled_images_match_unpooled)
+{
+  const int width = 23;
+  const int height = 19;
+  std::vector<Buffers> inputs;
+  inputs.push_back(make_buffers(width, height, 3));
+  inputs.push_back(make_buffers(width, height, 5));
+  inputs.push_back(make_buffers(width, height, 13));
+
+  for(int float_colors = 0; float_colors < 2; ++float_colors)
+  {
+    vtkh::Image expected =
+      reference_composite(inputs, width, height, float_colors == 1);
+
+    // nothing pooled
+    vtkh::Compositor::ReleaseImagePool();
+    vtkh::Image unpooled =
+      compositor_composite(inputs, width, height, float_colors == 1);
+    expect_same(expected, unpooled);
+
+    // the image released above is reused
+    vtkh::Image pooled =
+      compositor_composite(inputs, width, height, float_colors == 1);
+    expect_same(expected, pooled);
+
+    // pooled images from a larger render with other contents, in
+    // visibility order mode so several images go back to the pool
+    {
+      const int big_width = 64;
+      const int big_height = 48;
+      std::vector<Buffers> big_inputs;
+      big_inputs.push_back(make_buffers(big_width, big_height, 17));
+      big_inputs.push_back(make_buffers(big_width, big_height, 19));
+      vtkh::Compositor compositor;
+      compositor.SetCompositeMode(vtkh::Compositor::VIS_ORDER_BLEND);
+      for(size_t i = 0; i < big_inputs.size(); ++i)
+      {
+        compositor.AddImage(&big_inputs[i].m_colors[0],
+                            &big_inputs[i].m_depths[0],
+                            big_width,
+                            big_height,
+                            static_cast<int>(i));
+      }
+      compositor.ClearImages();
+    }
+    vtkh::Image resized =
+      compositor_composite(inputs, width, height, float_colors == 1);
+    expect_same(expected, resized);
+  }
+
+  vtkh::Compositor::ReleaseImagePool();
+}
@@ -68,3 +68,92 @@ TEST(vtkh_dataset, vtkh_range)
   EXPECT_EQ(3, topo_dims);
 
 }
+
+//-----------------------------------------------------------------------------
+TEST(vtkh_dataset, vtkh_global_metadata)
+{
+#ifdef VTKM_ENABLE_KOKKOS
+  vtkh::InitializeKokkos();
+#endif
+  vtkh::DataSet data_set;
+
+  const int base_size = 32;
+  const int num_blocks = 2;
+
+  data_set.AddDomain(CreateTestData(0, num_blocks, base_size), 0);
+  data_set.AddDomain(CreateTestData(1, num_blocks, base_size), 1);
+
+  // uncached answers
+  vtkm::Bounds bounds = data_set.GetGlobalBounds();
+  vtkm::Id num_cells = data_set.GetGlobalNumberOfCells();
+  vtkm::Range range = data_set.GetGlobalRange("point_data_Float64").ReadPortal().Get(0);
+
+  data_set.InvalidateGlobalMetadata();
+  data_set.UpdateGlobalMetadata({"point_data_Float64",
+                                 "vector_data_Float64",
+                                 "bananas"});
+
+  EXPECT_EQ(bounds, data_set.GetGlobalBounds());
+  EXPECT_EQ(num_cells, data_set.GetGlobalNumberOfCells());
+  EXPECT_EQ(2, data_set.GetGlobalNumberOfDomains());
+  EXPECT_FALSE(data_set.GlobalIsEmpty());
+  EXPECT_TRUE(data_set.GlobalFieldExists("point_data_Float64"));
+  EXPECT_FALSE(data_set.GlobalFieldExists("bananas"));
+  EXPECT_EQ(3, data_set.NumberOfComponents("vector_data_Float64"));
+
+  vtkm::cont::ArrayHandle<vtkm::Range> cached_range;
+  cached_range = data_set.GetGlobalRange("point_data_Float64");
+  EXPECT_EQ(1, cached_range.GetNumberOfValues());
+  EXPECT_EQ(range, cached_range.ReadPortal().Get(0));
+  EXPECT_EQ(3, data_set.GetGlobalRange("vector_data_Float64").GetNumberOfValues());
+
+  // adding a domain drops the cached values
+  data_set.AddDomain(CreateTestData(1, num_blocks, base_size), 2);
+  EXPECT_EQ(3, data_set.GetGlobalNumberOfDomains());
+  EXPECT_LT(num_cells, data_set.GetGlobalNumberOfCells());
+}
+
+//-----------------------------------------------------------------------------
+TEST(vtkh_dataset, vtkh_global_metadata_copy)
+{
+#ifdef VTKM_ENABLE_KOKKOS
+  vtkh::InitializeKokkos();
+#endif
+  vtkh::DataSet data_set;
+
+  const int base_size = 32;
+  const int num_blocks = 2;
+
+  data_set.AddDomain(CreateTestData(0, num_blocks, base_size), 0);
+  data_set.AddDomain(CreateTestData(1, num_blocks, base_size), 1);
+
+  // warm the cache of the source, including a miss
+  data_set.UpdateGlobalMetadata({"point_data_Float64", "bananas"});
+  EXPECT_FALSE(data_set.GlobalFieldExists("bananas"));
+  EXPECT_EQ(0, data_set.GetGlobalRange("bananas").GetNumberOfValues());
+
+  // this is what filters do: copy the input and add
+  // a field to the domains in place
+  vtkh::DataSet assigned;
+  assigned = data_set;
+  vtkh::DataSet constructed(data_set);
+  for(vtkm::Id i = 0; i < num_blocks; ++i)
+  {
+    vtkm::cont::DataSet &dom = assigned.GetDomain(i);
+    std::vector<vtkm::Float64> values(dom.GetNumberOfPoints(), 7.0);
+    dom.AddPointField("bananas", values);
+    constructed.GetDomain(i).AddPointField("bananas", values);
+  }
+
+  for(vtkh::DataSet *copy : {&assigned, &constructed})
+  {
+    EXPECT_TRUE(copy->GlobalFieldExists("bananas"));
+    EXPECT_EQ(1, copy->NumberOfComponents("bananas"));
+    vtkm::cont::ArrayHandle<vtkm::Range> range = copy->GetGlobalRange("bananas");
+    ASSERT_EQ(1, range.GetNumberOfValues());
+    EXPECT_EQ(vtkm::Range(7.0, 7.0), range.ReadPortal().Get(0));
+  }
+
+  // the source keeps its own answers
+  EXPECT_FALSE(data_set.GlobalFieldExists("bananas"));
+}
@@ -0,0 +1,195 @@
+//-----------------------------------------------------------------------------
+///
+/// file: t_vtk-h_sparse_image.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <vtkh/vtkh.hpp>
+#include <vtkh/compositing/Image.hpp>
+#include <vtkh/compositing/SparseImage.hpp>
+
+#include <iostream>
+
+namespace
+{
+
+const float background_depth = 1.5f;
+
+vtkm::Bounds image_bounds(int width, int height)
+{
+  vtkm::Bounds bounds;
+  bounds.X.Min = 1;
+  bounds.Y.Min = 1;
+  bounds.X.Max = width;
+  bounds.Y.Max = height;
+  return bounds;
+}
+
+void set_background(vtkh::Image &image)
+{
+  for(int i = 0; i < image.GetNumberOfPixels(); ++i)
+  {
+    image.m_pixels[i * 4 + 0] = 0;
+    image.m_pixels[i * 4 + 1] = 0;
+    image.m_pixels[i * 4 + 2] = 0;
+    image.m_pixels[i * 4 + 3] = 0;
+    image.m_depths[i] = background_depth;
+  }
+}
+
+void set_active(vtkh::Image &image, int index, float depth)
+{
+  image.m_pixels[index * 4 + 0] = static_cast<unsigned char>(index % 251);
+  image.m_pixels[index * 4 + 1] = 17;
+  image.m_pixels[index * 4 + 2] = 200;
+  image.m_pixels[index * 4 + 3] = 255;
+  image.m_depths[index] = depth;
+}
+
+void expect_same(const vtkh::Image &a, const vtkh::Image &b)
+{
+  ASSERT_EQ(a.m_pixels.size(), b.m_pixels.size());
+  ASSERT_EQ(a.m_depths.size(), b.m_depths.size());
+  for(size_t i = 0; i < a.m_pixels.size(); ++i)
+  {
+    EXPECT_EQ(a.m_pixels[i], b.m_pixels[i]) << "pixel component " << i;
+  }
+  for(size_t i = 0; i < a.m_depths.size(); ++i)
+  {
+    EXPECT_EQ(a.m_depths[i], b.m_depths[i]) << "depth " << i;
+  }
+}
+
+} // namespace
+
+//----------------------------------------------------------------------------
+TEST(vtkh_sparse_image, round_trip_partial)
+{
+  const int width = 37;
+  const int height = 23;
+  vtkh::Image image(image_bounds(width, height));
+  set_background(image);
+
+  int expected_active = 0;
+  for(int i = 0; i < image.GetNumberOfPixels(); ++i)
+  {
+    // a mix of short and long runs
+    if((i % 7) < 2 || (i > 300 && i < 360))
+    {
+      set_active(image, i, 0.25f + 0.001f * (i % 100));
+      expected_active++;
+    }
+  }
+  // fully transparent pixels that are not background must survive:
+  // one in front of the far plane and one with a different far depth
+  image.m_pixels[5 * 4 + 0] = 0;
+  image.m_pixels[5 * 4 + 1] = 0;
+  image.m_pixels[5 * 4 + 2] = 0;
+  image.m_pixels[5 * 4 + 3] = 0;
+  image.m_depths[5] = 0.5f;
+  expected_active++;
+  image.m_depths[6] = 3.0f;
+  expected_active++;
+
+  vtkh::SparseImage sparse;
+  sparse.Compress(image);
+  EXPECT_EQ(sparse.GetNumberOfPixels(), width * height);
+  EXPECT_EQ(sparse.GetNumberOfActivePixels(), expected_active);
+  EXPECT_EQ(sparse.m_background_depth, background_depth);
+
+  vtkh::Image result;
+  sparse.Decompress(result);
+  EXPECT_EQ(result.m_bounds, image.m_bounds);
+  expect_same(image, result);
+}
+
+//----------------------------------------------------------------------------
+TEST(vtkh_sparse_image, round_trip_all_background)
+{
+  const int width = 16;
+  const int height = 9;
+  vtkh::Image image(image_bounds(width, height));
+  set_background(image);
+
+  vtkh::SparseImage sparse;
+  sparse.Compress(image);
+  EXPECT_EQ(sparse.GetNumberOfActivePixels(), 0);
+  // a single inactive run covers the whole image
+  ASSERT_EQ(sparse.m_runs.size(), 2u);
+  EXPECT_EQ(sparse.m_runs[0], width * height);
+  EXPECT_EQ(sparse.m_runs[1], 0);
+
+  vtkh::Image result;
+  sparse.Decompress(result);
+  expect_same(image, result);
+}
+
+//----------------------------------------------------------------------------
+TEST(vtkh_sparse_image, round_trip_fully_covered)
+{
+  const int width = 16;
+  const int height = 9;
+  vtkh::Image image(image_bounds(width, height));
+  for(int i = 0; i < image.GetNumberOfPixels(); ++i)
+  {
+    set_active(image, i, 0.1f + 0.001f * i);
+  }
+
+  vtkh::SparseImage sparse;
+  sparse.Compress(image);
+  EXPECT_EQ(sparse.GetNumberOfActivePixels(), width * height);
+  // a single active run covers the whole image
+  ASSERT_EQ(sparse.m_runs.size(), 2u);
+  EXPECT_EQ(sparse.m_runs[0], 0);
+  EXPECT_EQ(sparse.m_runs[1], width * height);
+
+  vtkh::Image result;
+  sparse.Decompress(result);
+  expect_same(image, result);
+}
+
+//----------------------------------------------------------------------------
+TEST(vtkh_sparse_image, round_trip_sub_region)
+{
+  const int width = 20;
+  const int height = 12;
+  vtkh::Image image(image_bounds(width, height));
+  set_background(image);
+  for(int i = 0; i < image.GetNumberOfPixels(); i += 3)
+  {
+    set_active(image, i, 0.75f);
+  }
+
+  vtkm::Bounds sub_region;
+  sub_region.X.Min = 4;
+  sub_region.X.Max = 13;
+  sub_region.Y.Min = 3;
+  sub_region.Y.Max = 10;
+
+  vtkh::SparseImage sparse;
+  sparse.CompressFrom(image, sub_region);
+  EXPECT_EQ(sparse.GetNumberOfPixels(), 10 * 8);
+
+  // subsetting into a blank image only touches the sub region
+  vtkh::Image result(image_bounds(width, height));
+  set_background(result);
+  sparse.SubsetTo(result);
+
+  for(int y = 1; y <= height; ++y)
+  {
+    for(int x = 1; x <= width; ++x)
+    {
+      const int index = (y - 1) * width + (x - 1);
+      const bool inside = x >= 4 && x <= 13 && y >= 3 && y <= 10;
+      const float expected = inside ? image.m_depths[index] : background_depth;
+      EXPECT_EQ(result.m_depths[index], expected);
+      for(int c = 0; c < 4; ++c)
+      {
+        const unsigned char expected_c = inside ? image.m_pixels[index * 4 + c] : 0;
+        EXPECT_EQ(result.m_pixels[index * 4 + c], expected_c);
+      }
+    }
+  }
+}